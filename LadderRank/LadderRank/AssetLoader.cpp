@@ -0,0 +1,211 @@
+#include "AssetLoader.h"
+#include "IconBundle.h"
+
+#include <algorithm>
+#include <chrono>
+
+// ============================================================================
+// ASSET RESULT
+// ============================================================================
+
+size_t AssetResult::Failures() const {
+    return std::count_if(errors.begin(), errors.end(), [](const std::string& error) { return !error.empty(); });
+}
+
+// ============================================================================
+// ASSET LOADER
+// ============================================================================
+
+AssetLoader::AssetLoader(size_t capacity)
+    : capacity(std::max<size_t>(capacity, 1)) {
+}
+
+AssetLoader::~AssetLoader() {
+    Stop();
+}
+
+void AssetLoader::Start(int workers, CompletionCallback onComplete) {
+    Stop();
+
+    this->onComplete = std::move(onComplete);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = false;
+    }
+
+    for (int i = 0; i < std::max(workers, 1); i++) {
+        threads.emplace_back(&AssetLoader::Run, this);
+    }
+}
+
+void AssetLoader::Stop() {
+    CancelAll();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    wake.notify_all();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+}
+
+uint64_t AssetLoader::Submit(AssetRequest request) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stopRequested) {
+        return 0;
+    }
+
+    auto queued = std::find_if(queue.begin(), queue.end(), [&](const Job& job) { return job.request.key == request.key; });
+    if (queued != queue.end()) {
+        queued->request = std::move(request);
+        queued->ticket = nextTicket++;
+        replaced++;
+        submitted++;
+        return queued->ticket;
+    }
+
+    if (queue.size() >= capacity) {
+        rejected++;
+        return 0;
+    }
+
+    uint64_t ticket = nextTicket++;
+    queue.push_back(Job{ std::move(request), ticket, std::make_shared<std::atomic<bool>>(false) });
+    submitted++;
+    wake.notify_one();
+    return ticket;
+}
+
+bool AssetLoader::Cancel(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    bool found = false;
+
+    auto queued = std::find_if(queue.begin(), queue.end(), [&](const Job& job) { return job.request.key == key; });
+    if (queued != queue.end()) {
+        queue.erase(queued);
+        cancelled++;
+        found = true;
+    }
+
+    // The worker notices at its next source and counts the cancellation itself
+    for (const Job& job : running) {
+        if (job.request.key == key) {
+            job.cancel->store(true);
+            found = true;
+        }
+    }
+    return found;
+}
+
+void AssetLoader::CancelAll() {
+    std::lock_guard<std::mutex> lock(mutex);
+    cancelled += queue.size();
+    queue.clear();
+    for (const Job& job : running) {
+        job.cancel->store(true);
+    }
+}
+
+size_t AssetLoader::Pending() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size() + running.size();
+}
+
+void AssetLoader::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this]() { return stopRequested || !queue.empty(); });
+        if (stopRequested) {
+            break;
+        }
+
+        Job job = std::move(queue.front());
+        queue.pop_front();
+        running.push_back(job);
+        lock.unlock();
+
+        AssetResult result;
+        bool complete = Decode(job, result);
+
+        // Checked again after decoding, a cancelled result is never delivered
+        if (complete && !job.cancel->load()) {
+            for (const IconImage& image : result.images) {
+                decodedBytes += image.Bytes();
+            }
+            delivered++;
+            if (onComplete) {
+                onComplete(result);
+            }
+        }
+        else {
+            cancelled++;
+        }
+
+        lock.lock();
+        running.erase(std::find_if(running.begin(), running.end(),
+            [&](const Job& other) { return other.ticket == job.ticket; }));
+    }
+}
+
+bool AssetLoader::Decode(const Job& job, AssetResult& result) {
+    auto start = std::chrono::steady_clock::now();
+    const AssetRequest& request = job.request;
+
+    result.key = request.key;
+    result.ticket = job.ticket;
+    result.sources = request.sources;
+
+    if (!request.bundle.empty() && ReadBundle(request, result)) {
+        result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    result.images.resize(request.sources.size());
+    result.errors.resize(request.sources.size());
+
+    for (size_t i = 0; i < request.sources.size(); i++) {
+        if (job.cancel->load()) {
+            return false;
+        }
+
+        IconImage& image = result.images[i];
+        if (!LoadPNG(request.sources[i], image, result.errors[i])) {
+            image = IconImage();
+            continue;
+        }
+
+        // Scaled here so the consumer never touches full size pixels
+        int longest = std::max(image.width, image.height);
+        if (request.maxSide > 0 && longest > request.maxSide) {
+            image = ResizeIcon(image, std::max(1, image.width * request.maxSide / longest),
+                std::max(1, image.height * request.maxSide / longest));
+        }
+    }
+
+    result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+bool AssetLoader::ReadBundle(const AssetRequest& request, AssetResult& result) {
+    IconBundle bundle;
+    IconAtlas atlas;
+    if (!bundle.Open(request.bundle, result.bundleError) || !bundle.MatchesSources(request.sources, result.bundleError)) {
+        return false;
+    }
+
+    result.bundleCells = bundle.CellSizes();
+    size_t bucket = PickIconBucket(result.bundleCells, request.bundlePixels);
+    if (!bundle.ReadBucket(static_cast<int>(bucket), atlas, result.bundleError)) {
+        return false;
+    }
+
+    result.cellSize = result.bundleCells[bucket];
+    result.images.clear();
+    result.images.push_back(std::move(atlas.image));
+    result.errors.assign(1, std::string());
+    result.regions = std::move(atlas.regions);
+    return true;
+}
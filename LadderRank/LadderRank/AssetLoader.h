@@ -0,0 +1,157 @@
+#pragma once
+
+#include "IconAtlas.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// ASSET LOADER
+// ============================================================================
+
+/**
+ * @brief Images to decode together, identified by a caller chosen key
+ */
+struct AssetRequest {
+    int key = 0;
+    std::vector<std::filesystem::path> sources;
+    int maxSide = 0;               // Larger images are scaled down to fit, 0 keeps them as they are
+
+    // IconBundle baked from the sources. When set and up to date, the bucket
+    // for bundlePixels is read instead of decoding the sources.
+    std::filesystem::path bundle;
+    float bundlePixels = 0.0f;
+};
+
+/**
+ * @brief Decoded images of one request, in the order of its sources
+ */
+struct AssetResult {
+    int key = 0;
+    uint64_t ticket = 0;           // Returned by the Submit() that queued the request
+    std::vector<std::filesystem::path> sources;
+    std::vector<IconImage> images; // Empty image where a source failed
+    std::vector<std::string> errors;  // Why each source failed, empty when it decoded
+    double milliseconds = 0.0;     // Read, decode and scale time
+
+    // Set when the result came from the bundle: images holds the bucket's atlas alone
+    std::vector<AtlasRegion> regions;
+    int cellSize = 0;
+    std::vector<int> bundleCells;  // Every bucket of the bundle
+    std::string bundleError;       // Why the bundle was skipped and the sources decoded
+
+    size_t Failures() const;
+};
+
+/**
+ * @brief Reads and decodes PNG files on worker threads into RGBA buffers
+ *
+ * The queue holds at most `capacity` requests. Submitting a key that is
+ * still queued replaces the queued request instead of adding one. Cancel()
+ * drops a queued request, and a request already running stops at its next
+ * source; either way no result is delivered for it.
+ *
+ * Results are delivered on the worker thread that decoded them. Submit(),
+ * Cancel() and the counters can be used from any thread.
+ * Has no BakkesMod dependency.
+ */
+class AssetLoader {
+public:
+    /**
+     * @brief Called on a worker thread for every request that was not cancelled
+     */
+    using CompletionCallback = std::function<void(AssetResult& result)>;
+
+    explicit AssetLoader(size_t capacity);
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    /**
+     * @brief Starts the worker threads, stopping any previous ones
+     * @param workers Number of threads, at least one
+     * @param onComplete Called with every delivered result
+     */
+    void Start(int workers, CompletionCallback onComplete);
+
+    /**
+     * @brief Cancels everything and waits for the worker threads
+     */
+    void Stop();
+
+    /**
+     * @brief Queues a request
+     * @param request Sources to decode
+     * @return Ticket of the request, 0 if the queue is full or the loader stopped
+     */
+    uint64_t Submit(AssetRequest request);
+
+    /**
+     * @brief Cancels the queued or running request of a key
+     * @return True if there was one
+     */
+    bool Cancel(int key);
+
+    /**
+     * @brief Cancels every queued and running request
+     */
+    void CancelAll();
+
+    size_t Pending() const;
+
+    uint64_t Submitted() const { return submitted.load(); }
+    uint64_t Delivered() const { return delivered.load(); }
+    uint64_t Cancelled() const { return cancelled.load(); }
+    uint64_t Replaced() const { return replaced.load(); }
+    uint64_t Rejected() const { return rejected.load(); }
+    uint64_t DecodedBytes() const { return decodedBytes.load(); }
+
+private:
+    struct Job {
+        AssetRequest request;
+        uint64_t ticket = 0;
+        std::shared_ptr<std::atomic<bool>> cancel;
+    };
+
+    void Run();
+
+    /**
+     * @brief Decodes the sources of a job, stops early once it is cancelled
+     * @return False if the job was cancelled
+     */
+    bool Decode(const Job& job, AssetResult& result);
+
+    /**
+     * @brief Answers a job from its bundle
+     * @return False if the bundle cannot be used, result.bundleError says why
+     */
+    bool ReadBundle(const AssetRequest& request, AssetResult& result);
+
+    const size_t capacity;
+    CompletionCallback onComplete;
+
+    std::vector<std::thread> threads;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Job> queue;
+    std::vector<Job> running;      // Jobs a worker took, so Cancel() can reach them
+    uint64_t nextTicket = 1;
+    bool stopRequested = true;
+
+    std::atomic<uint64_t> submitted{ 0 };
+    std::atomic<uint64_t> delivered{ 0 };
+    std::atomic<uint64_t> cancelled{ 0 };     // Dropped from the queue or stopped while running
+    std::atomic<uint64_t> replaced{ 0 };      // Queued requests replaced by a newer one of the key
+    std::atomic<uint64_t> rejected{ 0 };      // Submits refused because the queue was full
+    std::atomic<uint64_t> decodedBytes{ 0 };  // RGBA bytes of delivered images
+};
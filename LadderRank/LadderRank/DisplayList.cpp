@@ -0,0 +1,74 @@
+#include "DisplayList.h"
+
+void DisplayList::Clear() {
+    commands.clear();
+    stringCount = 0;
+}
+
+void DisplayList::SetColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    DrawCommand& command = commands.emplace_back();
+    command.op = DrawOp::SetColor;
+    command.r = r;
+    command.g = g;
+    command.b = b;
+    command.a = a;
+}
+
+void DisplayList::FillBox(int x, int y, int width, int height) {
+    DrawCommand& command = commands.emplace_back();
+    command.op = DrawOp::FillBox;
+    command.x = x;
+    command.y = y;
+    command.width = width;
+    command.height = height;
+}
+
+void DisplayList::DrawString(int x, int y, std::string_view text, float scale) {
+    uint32_t index = Intern(text);
+
+    DrawCommand& command = commands.emplace_back();
+    command.op = DrawOp::DrawString;
+    command.x = x;
+    command.y = y;
+    command.scale = scale;
+    command.resource = index;
+}
+
+void DisplayList::DrawTexture(int x, int y, uint32_t texture, float scale) {
+    DrawCommand& command = commands.emplace_back();
+    command.op = DrawOp::DrawTexture;
+    command.x = x;
+    command.y = y;
+    command.scale = scale;
+    command.resource = texture;
+}
+
+void DisplayList::DrawTile(int x, int y, int width, int height, uint32_t texture,
+    float u, float v, float ul, float vl) {
+    DrawCommand& command = commands.emplace_back();
+    command.op = DrawOp::DrawTile;
+    command.x = x;
+    command.y = y;
+    command.width = width;
+    command.height = height;
+    command.u = u;
+    command.v = v;
+    command.ul = ul;
+    command.vl = vl;
+    command.resource = texture;
+}
+
+uint32_t DisplayList::Intern(std::string_view text) {
+    // A list holds a few dozen strings at most, a linear scan beats hashing
+    for (size_t i = 0; i < stringCount; i++) {
+        if (strings[i] == text) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+
+    if (stringCount == strings.size()) {
+        strings.emplace_back();
+    }
+    strings[stringCount].assign(text);
+    return static_cast<uint32_t>(stringCount++);
+}
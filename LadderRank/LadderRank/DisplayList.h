@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// DISPLAY LIST
+// ============================================================================
+
+enum class DrawOp : uint8_t {
+    SetColor,
+    FillBox,
+    DrawString,
+    DrawTexture,
+    DrawTile
+};
+
+/**
+ * @brief One precomputed canvas call, positions already in screen pixels
+ */
+struct DrawCommand {
+    DrawOp op = DrawOp::SetColor;
+    uint8_t r = 0;               // SetColor
+    uint8_t g = 0;
+    uint8_t b = 0;
+    uint8_t a = 0;
+    int x = 0;                   // Position of everything but SetColor
+    int y = 0;
+    int width = 0;               // FillBox and DrawTile size
+    int height = 0;
+    float scale = 1.0f;          // Text scale or texture scale
+    float u = 0.0f;              // DrawTile source rectangle in texels
+    float v = 0.0f;
+    float ul = 0.0f;
+    float vl = 0.0f;
+    uint32_t resource = 0;       // String index (DrawString) or texture index (DrawTexture, DrawTile)
+};
+
+/**
+ * @brief Canvas calls recorded once and replayed every frame
+ *
+ * The overlay only changes with the MMR snapshot, the screen size and the
+ * layout, so its draw calls are recorded when one of those changes and
+ * replayed as is in between. Strings are interned: each distinct string is
+ * stored once and commands refer to it by index. Textures are indices into
+ * a table the owner keeps alongside the list.
+ *
+ * Clear() keeps every buffer, so rebuilding a list of the same shape does
+ * not allocate. Single-threaded. Has no BakkesMod dependency.
+ */
+class DisplayList {
+public:
+    /**
+     * @brief Drops every command and string, keeping the capacity
+     */
+    void Clear();
+
+    void SetColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+    void FillBox(int x, int y, int width, int height);
+    void DrawString(int x, int y, std::string_view text, float scale);
+    void DrawTexture(int x, int y, uint32_t texture, float scale);
+    void DrawTile(int x, int y, int width, int height, uint32_t texture, float u, float v, float ul, float vl);
+
+    std::span<const DrawCommand> Commands() const { return commands; }
+    const std::string& String(uint32_t index) const { return strings[index]; }
+
+    size_t StringCount() const { return stringCount; }
+    bool Empty() const { return commands.empty(); }
+
+private:
+    /**
+     * @brief Returns the index of a string, storing it on first use
+     */
+    uint32_t Intern(std::string_view text);
+
+    std::vector<DrawCommand> commands;
+    std::vector<std::string> strings;  // The first stringCount are in use, the rest keep their buffers
+    size_t stringCount = 0;
+};
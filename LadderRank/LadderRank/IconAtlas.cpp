@@ -0,0 +1,109 @@
+#include "IconAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Own copy of the packer, static so it cannot clash with the one in imgui_draw.cpp
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"          // stbrp_setup_heuristic
+#endif
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "IMGUI/imstb_rectpack.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+constexpr int ATLAS_MAX_SIDE = 8192;
+
+bool BuildIconAtlas(const std::vector<IconImage>& icons, int cellSize, int padding, IconAtlas& atlas,
+    std::string& error) {
+    if (cellSize <= 0 || padding < 0) {
+        error = "invalid cell size";
+        return false;
+    }
+
+    // Scale down what does not fit a cell
+    std::vector<IconImage> scaled(icons.size());
+    std::vector<const IconImage*> sources(icons.size(), nullptr);
+    for (size_t i = 0; i < icons.size(); i++) {
+        const IconImage& icon = icons[i];
+        if (icon.Empty()) {
+            continue;
+        }
+        int longest = std::max(icon.width, icon.height);
+        if (longest > cellSize) {
+            int width = std::max(1, icon.width * cellSize / longest);
+            int height = std::max(1, icon.height * cellSize / longest);
+            scaled[i] = ResizeIcon(icon, width, height);
+            sources[i] = &scaled[i];
+        }
+        else {
+            sources[i] = &icon;
+        }
+    }
+
+    std::vector<stbrp_rect> rects;
+    long long area = 0;
+    for (size_t i = 0; i < sources.size(); i++) {
+        if (!sources[i]) {
+            continue;
+        }
+        stbrp_rect rect{};
+        rect.id = static_cast<int>(i);
+        rect.w = static_cast<stbrp_coord>(sources[i]->width + padding * 2);
+        rect.h = static_cast<stbrp_coord>(sources[i]->height + padding * 2);
+        area += static_cast<long long>(rect.w) * rect.h;
+        rects.push_back(rect);
+    }
+    if (rects.empty()) {
+        error = "no icons to pack";
+        return false;
+    }
+
+    // Smallest square that takes everything
+    int side = std::max(4, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(area)))));
+    std::vector<stbrp_node> nodes;
+    while (true) {
+        side = (side + 3) & ~3;
+        if (side > ATLAS_MAX_SIDE) {
+            error = "icons do not fit a " + std::to_string(ATLAS_MAX_SIDE) + " pixel atlas";
+            return false;
+        }
+
+        nodes.resize(side);
+        stbrp_context context;
+        stbrp_init_target(&context, side, side, nodes.data(), static_cast<int>(nodes.size()));
+        if (stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()))) {
+            break;
+        }
+        side += std::max(4, side / 8);
+    }
+
+    atlas.image.width = side;
+    atlas.image.height = side;
+    atlas.image.rgba.assign(static_cast<size_t>(side) * side * 4, 0);
+    atlas.regions.assign(icons.size(), AtlasRegion{});
+
+    for (const stbrp_rect& rect : rects) {
+        const IconImage& source = *sources[rect.id];
+        AtlasRegion& region = atlas.regions[rect.id];
+        region.x = rect.x + padding;
+        region.y = rect.y + padding;
+        region.width = source.width;
+        region.height = source.height;
+        region.u0 = static_cast<float>(region.x) / side;
+        region.v0 = static_cast<float>(region.y) / side;
+        region.u1 = static_cast<float>(region.x + region.width) / side;
+        region.v1 = static_cast<float>(region.y + region.height) / side;
+
+        for (int y = 0; y < source.height; y++) {
+            std::memcpy(atlas.image.rgba.data() + (static_cast<size_t>(region.y + y) * side + region.x) * 4,
+                source.rgba.data() + static_cast<size_t>(y) * source.width * 4,
+                static_cast<size_t>(source.width) * 4);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "IconImage.h"
+
+#include <string>
+#include <vector>
+
+// ============================================================================
+// ICON ATLAS
+// ============================================================================
+
+/**
+ * @brief Where one icon sits in the atlas
+ */
+struct AtlasRegion {
+    int x = 0;               // Top-left corner in atlas pixels
+    int y = 0;
+    int width = 0;           // 0 if the icon was missing
+    int height = 0;
+
+    float u0 = 0.0f;         // Normalized texture coordinates of the corners
+    float v0 = 0.0f;
+    float u1 = 0.0f;
+    float v1 = 0.0f;
+
+    bool Valid() const { return width > 0 && height > 0; }
+};
+
+/**
+ * @brief Every rank icon packed into one image, with a region per icon
+ */
+struct IconAtlas {
+    IconImage image;
+    std::vector<AtlasRegion> regions;  // Same order as the icons it was built from
+};
+
+/**
+ * @brief Packs icons into one atlas with stb_rect_pack
+ *
+ * Icons larger than cellSize are scaled down first (area filter, aspect
+ * kept), so one oversized source does not blow up the atlas. The atlas is
+ * the smallest square, grown in steps of 1/8, that holds every icon.
+ * Has no BakkesMod dependency.
+ * @param icons Icons to pack, empty ones get an invalid region
+ * @param cellSize Longest side of an icon in the atlas
+ * @param padding Transparent pixels around each icon, keeps filtering from bleeding
+ * @param atlas Receives the atlas
+ * @param error Receives the reason nothing was packed
+ * @return True on success
+ */
+bool BuildIconAtlas(const std::vector<IconImage>& icons, int cellSize, int padding, IconAtlas& atlas,
+    std::string& error);
@@ -0,0 +1,251 @@
+#include "IconBundle.h"
+#include "RankBinary.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+// ============================================================================
+// BUCKETS
+// ============================================================================
+
+size_t PickIconBucket(std::span<const int> cellSizes, float pixels) {
+    for (size_t i = 0; i < cellSizes.size(); i++) {
+        if (static_cast<float>(cellSizes[i]) >= pixels) {
+            return i;
+        }
+    }
+    return cellSizes.empty() ? 0 : cellSizes.size() - 1;
+}
+
+// ============================================================================
+// WRITER
+// ============================================================================
+
+static void AppendBytes(std::vector<uint8_t>& buffer, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+bool WriteIconBundle(std::vector<BakedBucket> buckets, const std::vector<uint32_t>& sourceSizes,
+    const std::filesystem::path& file, std::string& error) {
+    std::sort(buckets.begin(), buckets.end(),
+        [](const BakedBucket& a, const BakedBucket& b) { return a.cellSize < b.cellSize; });
+
+    uint32_t iconCount = static_cast<uint32_t>(sourceSizes.size());
+    for (size_t b = 0; b < buckets.size(); b++) {
+        const BakedBucket& bucket = buckets[b];
+        if (bucket.cellSize <= 0 || (b > 0 && bucket.cellSize == buckets[b - 1].cellSize)) {
+            error = "bucket sizes must be positive and distinct";
+            return false;
+        }
+        if (bucket.atlas.regions.size() != iconCount || bucket.atlas.image.Empty()) {
+            error = "bucket " + std::to_string(bucket.cellSize) + " does not hold every icon";
+            return false;
+        }
+    }
+    if (buckets.empty()) {
+        error = "no buckets to write";
+        return false;
+    }
+
+    // Directory first, the pixel offsets are known once its size is
+    std::vector<uint8_t> directory;
+    AppendBytes(directory, sourceSizes.data(), sourceSizes.size() * sizeof(uint32_t));
+
+    size_t pixelOffset = sizeof(IconBundleHeader) + directory.size()
+        + buckets.size() * (sizeof(IconBundleBucket) + iconCount * sizeof(IconBundleRegion));
+    for (const BakedBucket& bucket : buckets) {
+        const IconImage& image = bucket.atlas.image;
+        IconBundleBucket entry{};
+        entry.cellSize = static_cast<uint32_t>(bucket.cellSize);
+        entry.width = static_cast<uint32_t>(image.width);
+        entry.height = static_cast<uint32_t>(image.height);
+        entry.offset = static_cast<uint32_t>(pixelOffset);
+        entry.checksum = Fnv1a(image.rgba.data(), image.rgba.size());
+        AppendBytes(directory, &entry, sizeof(entry));
+        pixelOffset += image.rgba.size();
+    }
+    if (pixelOffset > UINT32_MAX) {
+        error = "bundle larger than 4 GB";
+        return false;
+    }
+
+    for (const BakedBucket& bucket : buckets) {
+        for (const AtlasRegion& region : bucket.atlas.regions) {
+            IconBundleRegion entry{ static_cast<uint32_t>(region.x), static_cast<uint32_t>(region.y),
+                static_cast<uint32_t>(region.width), static_cast<uint32_t>(region.height) };
+            AppendBytes(directory, &entry, sizeof(entry));
+        }
+    }
+
+    IconBundleHeader header{};
+    header.magic = ICON_BUNDLE_MAGIC;
+    header.version = ICON_BUNDLE_VERSION;
+    header.bucketCount = static_cast<uint32_t>(buckets.size());
+    header.iconCount = iconCount;
+    header.checksum = Fnv1a(directory.data(), directory.size());
+
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        error = "cannot create " + file.string();
+        return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(directory.data()), static_cast<std::streamsize>(directory.size()));
+    for (const BakedBucket& bucket : buckets) {
+        const std::vector<uint8_t>& rgba = bucket.atlas.image.rgba;
+        stream.write(reinterpret_cast<const char*>(rgba.data()), static_cast<std::streamsize>(rgba.size()));
+    }
+    if (!stream) {
+        error = "cannot write " + file.string();
+        return false;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+bool IconBundle::Open(const std::filesystem::path& path, std::string& error) {
+    header = nullptr;
+
+    if (!file.Open(path)) {
+        error = "cannot map " + path.string();
+        return false;
+    }
+
+    const uint8_t* data = file.Data();
+    size_t size = file.Size();
+
+    if (size < sizeof(IconBundleHeader)) {
+        error = "truncated header";
+        return false;
+    }
+
+    const auto* candidate = reinterpret_cast<const IconBundleHeader*>(data);
+    if (candidate->magic != ICON_BUNDLE_MAGIC) {
+        error = "bad magic";
+        return false;
+    }
+    if (candidate->version != ICON_BUNDLE_VERSION) {
+        error = "unsupported version " + std::to_string(candidate->version);
+        return false;
+    }
+    if (candidate->bucketCount == 0 || candidate->iconCount == 0) {
+        error = "empty bundle";
+        return false;
+    }
+
+    size_t bucketCount = candidate->bucketCount;
+    size_t iconCount = candidate->iconCount;
+    size_t bucketsOffset = sizeof(IconBundleHeader) + iconCount * sizeof(uint32_t);
+    size_t regionsOffset = bucketsOffset + bucketCount * sizeof(IconBundleBucket);
+    size_t directoryEnd = regionsOffset + bucketCount * iconCount * sizeof(IconBundleRegion);
+    if (directoryEnd > size) {
+        error = "truncated directory";
+        return false;
+    }
+
+    uint32_t checksum = Fnv1a(data + sizeof(IconBundleHeader), directoryEnd - sizeof(IconBundleHeader));
+    if (checksum != candidate->checksum) {
+        error = "checksum mismatch";
+        return false;
+    }
+
+    const auto* entries = reinterpret_cast<const IconBundleBucket*>(data + bucketsOffset);
+    const auto* boxes = reinterpret_cast<const IconBundleRegion*>(data + regionsOffset);
+    for (size_t b = 0; b < bucketCount; b++) {
+        const IconBundleBucket& bucket = entries[b];
+        size_t pixelBytes = static_cast<size_t>(bucket.width) * bucket.height * 4;
+        if (bucket.cellSize == 0 || (b > 0 && bucket.cellSize <= entries[b - 1].cellSize)
+            || bucket.offset < directoryEnd || bucket.offset + pixelBytes > size) {
+            error = "bad bucket " + std::to_string(b);
+            return false;
+        }
+
+        for (size_t i = 0; i < iconCount; i++) {
+            const IconBundleRegion& region = boxes[b * iconCount + i];
+            if (static_cast<size_t>(region.x) + region.width > bucket.width
+                || static_cast<size_t>(region.y) + region.height > bucket.height) {
+                error = "region " + std::to_string(i) + " outside bucket " + std::to_string(bucket.cellSize);
+                return false;
+            }
+        }
+    }
+
+    header = candidate;
+    sourceSizes = reinterpret_cast<const uint32_t*>(data + sizeof(IconBundleHeader));
+    buckets = entries;
+    regions = boxes;
+    return true;
+}
+
+int IconBundle::IconCount() const {
+    return header ? static_cast<int>(header->iconCount) : 0;
+}
+
+std::vector<int> IconBundle::CellSizes() const {
+    std::vector<int> sizes;
+    for (uint32_t b = 0; header && b < header->bucketCount; b++) {
+        sizes.push_back(static_cast<int>(buckets[b].cellSize));
+    }
+    return sizes;
+}
+
+bool IconBundle::MatchesSources(const std::vector<std::filesystem::path>& sources, std::string& error) const {
+    if (!header || sources.size() != header->iconCount) {
+        error = "bundle holds " + std::to_string(IconCount()) + " icons, expected " + std::to_string(sources.size());
+        return false;
+    }
+
+    for (size_t i = 0; i < sources.size(); i++) {
+        std::error_code sizeError;
+        auto size = std::filesystem::file_size(sources[i], sizeError);
+        if (sizeError || size != sourceSizes[i]) {
+            error = sources[i].filename().string() + " changed since the bundle was baked";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IconBundle::ReadBucket(int bucket, IconAtlas& atlas, std::string& error) const {
+    if (!header || bucket < 0 || bucket >= static_cast<int>(header->bucketCount)) {
+        error = "no bucket " + std::to_string(bucket);
+        return false;
+    }
+
+    const IconBundleBucket& entry = buckets[bucket];
+    const uint8_t* pixels = file.Data() + entry.offset;
+    size_t pixelBytes = static_cast<size_t>(entry.width) * entry.height * 4;
+    if (Fnv1a(pixels, pixelBytes) != entry.checksum) {
+        error = "checksum mismatch in bucket " + std::to_string(entry.cellSize);
+        return false;
+    }
+
+    atlas.image.width = static_cast<int>(entry.width);
+    atlas.image.height = static_cast<int>(entry.height);
+    atlas.image.rgba.assign(pixels, pixels + pixelBytes);
+
+    // Texture coordinates are derived, the file only keeps pixel rectangles
+    float width = static_cast<float>(entry.width);
+    float height = static_cast<float>(entry.height);
+    atlas.regions.assign(header->iconCount, AtlasRegion{});
+    for (uint32_t i = 0; i < header->iconCount; i++) {
+        const IconBundleRegion& box = regions[bucket * header->iconCount + i];
+        AtlasRegion& region = atlas.regions[i];
+        region.x = static_cast<int>(box.x);
+        region.y = static_cast<int>(box.y);
+        region.width = static_cast<int>(box.width);
+        region.height = static_cast<int>(box.height);
+        region.u0 = region.x / width;
+        region.v0 = region.y / height;
+        region.u1 = (region.x + region.width) / width;
+        region.v1 = (region.y + region.height) / height;
+    }
+    return true;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "IconAtlas.h"
+#include "MappedFile.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// ICON BUNDLE FORMAT
+// ============================================================================
+//
+// Every rank icon, decoded and pre-scaled into a few size buckets, each
+// bucket already packed into an atlas. Written by the IconBake tool.
+// Little endian, every field 4-byte aligned:
+//
+//   IconBundleHeader
+//   uint32 sourceSizes[iconCount]              size of each source PNG
+//   IconBundleBucket buckets[bucketCount]      ascending cell size
+//   IconBundleRegion regions[bucketCount][iconCount]
+//   per bucket: uint8 rgba[height][width][4]
+//
+// The header checksum covers the directory (source sizes, buckets and
+// regions). Each bucket carries the checksum of its own pixels, so reading
+// one bucket never touches the others.
+
+constexpr uint32_t ICON_BUNDLE_MAGIC = 0x4249524C;  // "LRIB"
+constexpr uint32_t ICON_BUNDLE_VERSION = 1;
+
+struct IconBundleHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t bucketCount;
+    uint32_t iconCount;
+    uint32_t checksum;       // FNV-1a of the directory after the header
+    uint32_t reserved;
+};
+
+struct IconBundleBucket {
+    uint32_t cellSize;       // Longest icon side in this bucket
+    uint32_t width;          // Atlas size in pixels
+    uint32_t height;
+    uint32_t offset;         // File offset of the RGBA pixels
+    uint32_t checksum;       // FNV-1a of the pixels
+};
+
+struct IconBundleRegion {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;          // 0 if the icon was missing
+    uint32_t height;
+};
+
+/**
+ * @brief One bucket to write: its cell size and the atlas packed at that size
+ */
+struct BakedBucket {
+    int cellSize = 0;
+    IconAtlas atlas;
+};
+
+/**
+ * @brief Picks the bucket to draw icons of a given size from
+ *
+ * The smallest cell that is at least `pixels`, so icons are only ever
+ * scaled down when drawn, or the largest cell if none is big enough.
+ * @param cellSizes Cell sizes, ascending
+ * @param pixels Largest size an icon is drawn at
+ * @return Index into cellSizes, 0 if it is empty
+ */
+size_t PickIconBucket(std::span<const int> cellSizes, float pixels);
+
+/**
+ * @brief Writes buckets in the icon bundle format
+ * @param buckets Buckets with distinct cell sizes, written in ascending order
+ * @param sourceSizes File size of each source PNG, one per atlas region
+ * @param file Output file
+ * @param error Receives a description of the failure
+ * @return True if the file was written
+ */
+bool WriteIconBundle(std::vector<BakedBucket> buckets, const std::vector<uint32_t>& sourceSizes,
+    const std::filesystem::path& file, std::string& error);
+
+// ============================================================================
+// READER
+// ============================================================================
+
+/**
+ * @brief Validated view of a mapped icon bundle
+ *
+ * Open() maps the file and checks the directory only. ReadBucket() then
+ * checks and copies out the one bucket that is needed.
+ * Has no BakkesMod dependency.
+ */
+class IconBundle {
+public:
+    /**
+     * @brief Maps a bundle and checks its header and directory
+     * @param path Bundle file
+     * @param error Receives the reason the file was rejected
+     * @return True if the file can be read
+     */
+    bool Open(const std::filesystem::path& path, std::string& error);
+
+    bool IsOpen() const { return header != nullptr; }
+    int IconCount() const;
+
+    /**
+     * @brief Returns the cell size of every bucket, ascending
+     */
+    std::vector<int> CellSizes() const;
+
+    /**
+     * @brief Checks that the bundle was baked from files of the same sizes
+     * @param sources Source PNGs, in icon order
+     * @param error Receives the first icon that differs
+     * @return True if every source matches
+     */
+    bool MatchesSources(const std::vector<std::filesystem::path>& sources, std::string& error) const;
+
+    /**
+     * @brief Copies one bucket out as an atlas
+     * @param bucket Bucket index
+     * @param atlas Receives the pixels and a region per icon
+     * @param error Receives the reason the bucket was rejected
+     * @return True if the bucket is intact
+     */
+    bool ReadBucket(int bucket, IconAtlas& atlas, std::string& error) const;
+
+private:
+    MappedFile file;
+    const IconBundleHeader* header = nullptr;
+    const uint32_t* sourceSizes = nullptr;
+    const IconBundleBucket* buckets = nullptr;
+    const IconBundleRegion* regions = nullptr;
+};
@@ -0,0 +1,836 @@
+#include "IconImage.h"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+// ============================================================================
+// CHECKSUMS
+// ============================================================================
+
+static const std::array<uint32_t, 256> CRC_TABLE = []() {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}();
+
+static uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = CRC_TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static uint32_t Adler32(const uint8_t* data, size_t size) {
+    uint32_t a = 1;
+    uint32_t b = 0;
+    while (size > 0) {
+        // 5552 bytes is the most that cannot overflow before the modulo
+        size_t block = std::min<size_t>(size, 5552);
+        for (size_t i = 0; i < block; i++) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+        data += block;
+        size -= block;
+    }
+    return (b << 16) | a;
+}
+
+static void WriteBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(uint8_t(value >> 24));
+    out.push_back(uint8_t(value >> 16));
+    out.push_back(uint8_t(value >> 8));
+    out.push_back(uint8_t(value));
+}
+
+static const uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+constexpr uint32_t PNG_MAX_SIDE = 8192;
+
+#if LADDERRANK_STB_IMAGE
+
+// ============================================================================
+// PNG DECODE
+// ============================================================================
+
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#define STBI_NO_STDIO
+#define STBI_NO_LINEAR
+#define STBI_NO_HDR
+#define STBI_MAX_DIMENSIONS PNG_MAX_SIDE
+#include "imguibindings/stb_image.h"
+
+bool DecodePNG(std::span<const uint8_t> bytes, IconImage& image, std::string& error) {
+    if (bytes.size() > static_cast<size_t>(INT_MAX)) {
+        error = "file too large";
+        return false;
+    }
+
+    // stb_image keeps its failure reason per thread, so loader threads do not mix them up
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    stbi_uc* pixels = stbi_load_from_memory(bytes.data(), static_cast<int>(bytes.size()), &width, &height, &channels, 4);
+    if (!pixels) {
+        const char* reason = stbi_failure_reason();
+        error = reason ? reason : "invalid PNG";
+        return false;
+    }
+
+    image.width = width;
+    image.height = height;
+    image.rgba.assign(pixels, pixels + size_t(width) * height * 4);
+    stbi_image_free(pixels);
+    return true;
+}
+
+#else
+
+static uint32_t ReadBigEndian(const uint8_t* data) {
+    return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | data[3];
+}
+
+// ============================================================================
+// INFLATE
+// ============================================================================
+//
+// RFC 1951 decoder. Codes are decoded through a lookup table indexed by the
+// next FAST_BITS input bits; the few longer codes fall back to walking the
+// canonical code one bit at a time.
+
+namespace {
+
+constexpr int MAX_CODE_BITS = 15;
+constexpr int FAST_BITS = 9;
+
+struct Huffman {
+    std::array<uint16_t, MAX_CODE_BITS + 1> count{};  // Codes per length
+    std::array<uint16_t, 288> symbol{};               // Symbols ordered by code
+    std::array<uint16_t, 1 << FAST_BITS> fast{};      // Bit-reversed prefix -> (length << 9) | symbol, 0 if longer
+
+    /**
+     * @brief Builds the canonical code of a set of code lengths
+     * @return False if the lengths are over-subscribed, or incomplete
+     *         without being a single code
+     */
+    bool Build(const uint8_t* lengths, int symbols) {
+        count.fill(0);
+        fast.fill(0);
+        for (int i = 0; i < symbols; i++) {
+            count[lengths[i]]++;
+        }
+        if (count[0] == symbols) {
+            return true;  // No codes, fine as long as none is used
+        }
+
+        int left = 1;
+        for (int length = 1; length <= MAX_CODE_BITS; length++) {
+            left = (left << 1) - count[length];
+            if (left < 0) {
+                return false;
+            }
+        }
+        if (left > 0 && symbols - count[0] != 1) {
+            return false;
+        }
+
+        std::array<uint16_t, MAX_CODE_BITS + 2> offset{};
+        for (int length = 1; length <= MAX_CODE_BITS; length++) {
+            offset[length + 1] = offset[length] + count[length];
+        }
+
+        // First code of each length
+        std::array<int, MAX_CODE_BITS + 1> next{};
+        int code = 0;
+        for (int length = 1; length <= MAX_CODE_BITS; length++) {
+            next[length] = code;
+            code = (code + count[length]) << 1;
+        }
+
+        for (int i = 0; i < symbols; i++) {
+            int length = lengths[i];
+            if (length == 0) {
+                continue;
+            }
+            symbol[offset[length]++] = static_cast<uint16_t>(i);
+
+            int assigned = next[length]++;
+            if (length <= FAST_BITS) {
+                // The stream sends codes MSB first into an LSB first buffer
+                int reversed = 0;
+                for (int bit = 0; bit < length; bit++) {
+                    reversed |= ((assigned >> bit) & 1) << (length - 1 - bit);
+                }
+                for (int fill = reversed; fill < (1 << FAST_BITS); fill += 1 << length) {
+                    fast[fill] = static_cast<uint16_t>((length << 9) | i);
+                }
+            }
+        }
+        return true;
+    }
+};
+
+class Inflater {
+public:
+    /**
+     * @param limit Most bytes the stream may inflate to, larger streams fail
+     *        before growing output past it
+     */
+    Inflater(std::span<const uint8_t> input, std::vector<uint8_t>& output, size_t limit)
+        : input(input), output(output), limit(limit) {
+    }
+
+    bool Run(std::string& error) {
+        bool last = false;
+        while (!last) {
+            last = Bits(1) != 0;
+            int type = Bits(2);
+            bool ok = false;
+            switch (type) {
+            case 0: ok = Stored(); break;
+            case 1: ok = Fixed(); break;
+            case 2: ok = Dynamic(); break;
+            default: break;
+            }
+            if (!ok || overrun || tooLarge) {
+                error = overrun ? "deflate stream truncated"
+                    : tooLarge ? "deflate stream larger than the image" : "invalid deflate block";
+                return false;
+            }
+        }
+        // The bit buffer may hold whole bytes read ahead of the last code
+        consumed = position - bitCount / 8;
+        return true;
+    }
+
+    size_t Consumed() const { return consumed; }
+
+private:
+    int Bits(int need) {
+        while (bitCount < need) {
+            if (position >= input.size()) {
+                overrun = true;
+                return 0;
+            }
+            bitBuffer |= uint32_t(input[position++]) << bitCount;
+            bitCount += 8;
+        }
+        int value = static_cast<int>(bitBuffer & ((1u << need) - 1));
+        bitBuffer >>= need;
+        bitCount -= need;
+        return value;
+    }
+
+    int Decode(const Huffman& huffman) {
+        // Top up the buffer without failing, a short stream may end on a short code
+        while (bitCount < FAST_BITS && position < input.size()) {
+            bitBuffer |= uint32_t(input[position++]) << bitCount;
+            bitCount += 8;
+        }
+
+        uint16_t entry = huffman.fast[bitBuffer & ((1u << FAST_BITS) - 1)];
+        int length = entry >> 9;
+        if (entry != 0 && length <= bitCount) {
+            bitBuffer >>= length;
+            bitCount -= length;
+            return entry & 0x1FF;
+        }
+
+        // Long code, walk the canonical code
+        int code = 0;
+        int first = 0;
+        int index = 0;
+        for (int bits = 1; bits <= MAX_CODE_BITS; bits++) {
+            code |= Bits(1);
+            int count = huffman.count[bits];
+            if (code - count < first) {
+                return huffman.symbol[index + (code - first)];
+            }
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+
+    bool Stored() {
+        // Stored blocks start on a byte boundary, give back the bytes read ahead
+        position -= bitCount / 8;
+        bitBuffer = 0;
+        bitCount = 0;
+        if (position + 4 > input.size()) {
+            return false;
+        }
+        size_t length = input[position] | (input[position + 1] << 8);
+        size_t complement = input[position + 2] | (input[position + 3] << 8);
+        position += 4;
+        if (length != (~complement & 0xFFFF) || position + length > input.size()) {
+            return false;
+        }
+        if (length > limit - output.size()) {
+            tooLarge = true;
+            return false;
+        }
+        output.insert(output.end(), input.begin() + position, input.begin() + position + length);
+        position += length;
+        return true;
+    }
+
+    bool Codes(const Huffman& lengthCode, const Huffman& distanceCode) {
+        static const uint16_t LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+            35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+        static const uint8_t LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+            3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+        static const uint16_t DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+            257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+        static const uint8_t DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+            7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+        while (true) {
+            int symbol = Decode(lengthCode);
+            if (symbol < 0 || overrun) {
+                return false;
+            }
+            if (symbol < 256) {
+                if (output.size() == limit) {
+                    tooLarge = true;
+                    return false;
+                }
+                output.push_back(static_cast<uint8_t>(symbol));
+                continue;
+            }
+            if (symbol == 256) {
+                return true;
+            }
+
+            symbol -= 257;
+            if (symbol >= 29) {
+                return false;
+            }
+            size_t length = LENGTH_BASE[symbol] + Bits(LENGTH_EXTRA[symbol]);
+
+            symbol = Decode(distanceCode);
+            if (symbol < 0 || symbol >= 30) {
+                return false;
+            }
+            size_t distance = DISTANCE_BASE[symbol] + Bits(DISTANCE_EXTRA[symbol]);
+            if (distance > output.size() || overrun) {
+                return false;
+            }
+            if (length > limit - output.size()) {
+                tooLarge = true;
+                return false;
+            }
+
+            // Overlapping copies repeat the last bytes, so copy byte by byte
+            size_t from = output.size() - distance;
+            for (size_t i = 0; i < length; i++) {
+                output.push_back(output[from + i]);
+            }
+        }
+    }
+
+    bool Fixed() {
+        if (!fixedBuilt) {
+            std::array<uint8_t, 288> lengths{};
+            std::fill(lengths.begin(), lengths.begin() + 144, uint8_t(8));
+            std::fill(lengths.begin() + 144, lengths.begin() + 256, uint8_t(9));
+            std::fill(lengths.begin() + 256, lengths.begin() + 280, uint8_t(7));
+            std::fill(lengths.begin() + 280, lengths.end(), uint8_t(8));
+            fixedLength.Build(lengths.data(), 288);
+
+            // Codes 30 and 31 never occur but complete the code
+            std::array<uint8_t, 32> distances;
+            distances.fill(5);
+            fixedDistance.Build(distances.data(), 32);
+            fixedBuilt = true;
+        }
+        return Codes(fixedLength, fixedDistance);
+    }
+
+    bool Dynamic() {
+        static const uint8_t ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+        int lengthCount = Bits(5) + 257;
+        int distanceCount = Bits(5) + 1;
+        int codeCount = Bits(4) + 4;
+        if (lengthCount > 286 || distanceCount > 30) {
+            return false;
+        }
+
+        std::array<uint8_t, 320> lengths{};
+        for (int i = 0; i < codeCount; i++) {
+            lengths[ORDER[i]] = static_cast<uint8_t>(Bits(3));
+        }
+        Huffman codeLengths;
+        if (!codeLengths.Build(lengths.data(), 19)) {
+            return false;
+        }
+
+        lengths.fill(0);
+        int index = 0;
+        while (index < lengthCount + distanceCount) {
+            int symbol = Decode(codeLengths);
+            if (symbol < 0 || overrun) {
+                return false;
+            }
+            if (symbol < 16) {
+                lengths[index++] = static_cast<uint8_t>(symbol);
+                continue;
+            }
+
+            uint8_t repeated = 0;
+            int repeat = 0;
+            if (symbol == 16) {
+                if (index == 0) {
+                    return false;
+                }
+                repeated = lengths[index - 1];
+                repeat = 3 + Bits(2);
+            }
+            else if (symbol == 17) {
+                repeat = 3 + Bits(3);
+            }
+            else {
+                repeat = 11 + Bits(7);
+            }
+            if (index + repeat > lengthCount + distanceCount) {
+                return false;
+            }
+            while (repeat-- > 0) {
+                lengths[index++] = repeated;
+            }
+        }
+
+        // A block without an end code could never finish
+        if (lengths[256] == 0) {
+            return false;
+        }
+
+        Huffman lengthCode;
+        Huffman distanceCode;
+        if (!lengthCode.Build(lengths.data(), lengthCount)
+            || !distanceCode.Build(lengths.data() + lengthCount, distanceCount)) {
+            return false;
+        }
+        return Codes(lengthCode, distanceCode);
+    }
+
+    std::span<const uint8_t> input;
+    std::vector<uint8_t>& output;
+    size_t position = 0;
+    size_t consumed = 0;
+    size_t limit;
+    bool tooLarge = false;
+    uint32_t bitBuffer = 0;
+    int bitCount = 0;
+    bool overrun = false;
+
+    bool fixedBuilt = false;
+    Huffman fixedLength;
+    Huffman fixedDistance;
+};
+
+}  // namespace
+
+/**
+ * @brief Inflates a zlib stream (RFC 1950) and checks its Adler-32
+ * @param limit Most bytes the stream may inflate to
+ */
+static bool Unzlib(std::span<const uint8_t> input, std::vector<uint8_t>& output, size_t limit,
+    std::string& error) {
+    if (input.size() < 6) {
+        error = "zlib stream too short";
+        return false;
+    }
+    uint8_t method = input[0];
+    uint8_t flags = input[1];
+    if ((method & 0x0F) != 8 || ((method << 8) | flags) % 31 != 0 || (flags & 0x20) != 0) {
+        error = "unsupported zlib header";
+        return false;
+    }
+
+    Inflater inflater(input.subspan(2), output, limit);
+    if (!inflater.Run(error)) {
+        return false;
+    }
+
+    size_t end = 2 + inflater.Consumed();
+    if (end + 4 > input.size() || ReadBigEndian(input.data() + end) != Adler32(output.data(), output.size())) {
+        error = "zlib checksum mismatch";
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// PNG DECODE
+// ============================================================================
+
+static uint8_t Paeth(int left, int up, int upLeft) {
+    int estimate = left + up - upLeft;
+    int toLeft = std::abs(estimate - left);
+    int toUp = std::abs(estimate - up);
+    int toUpLeft = std::abs(estimate - upLeft);
+    if (toLeft <= toUp && toLeft <= toUpLeft) {
+        return static_cast<uint8_t>(left);
+    }
+    return static_cast<uint8_t>(toUp <= toUpLeft ? up : upLeft);
+}
+
+/**
+ * @brief Undoes the per-row filters in place
+ * @param data Filter byte followed by the row, for every row
+ * @return False on an unknown filter type
+ */
+static bool Unfilter(std::vector<uint8_t>& data, size_t rowBytes, size_t rows, size_t pixelBytes) {
+    const uint8_t* previous = nullptr;
+    for (size_t y = 0; y < rows; y++) {
+        uint8_t* row = data.data() + y * (rowBytes + 1) + 1;
+        uint8_t filter = row[-1];
+        for (size_t x = 0; x < rowBytes; x++) {
+            int left = x >= pixelBytes ? row[x - pixelBytes] : 0;
+            int up = previous ? previous[x] : 0;
+            int upLeft = (previous && x >= pixelBytes) ? previous[x - pixelBytes] : 0;
+            switch (filter) {
+            case 0: break;
+            case 1: row[x] = static_cast<uint8_t>(row[x] + left); break;
+            case 2: row[x] = static_cast<uint8_t>(row[x] + up); break;
+            case 3: row[x] = static_cast<uint8_t>(row[x] + ((left + up) >> 1)); break;
+            case 4: row[x] = static_cast<uint8_t>(row[x] + Paeth(left, up, upLeft)); break;
+            default: return false;
+            }
+        }
+        previous = row;
+    }
+    return true;
+}
+
+bool DecodePNG(std::span<const uint8_t> bytes, IconImage& image, std::string& error) {
+    if (bytes.size() < 8 || std::memcmp(bytes.data(), PNG_SIGNATURE, 8) != 0) {
+        error = "not a PNG file";
+        return false;
+    }
+
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint8_t colorType = 0;
+    bool headerSeen = false;
+    std::vector<uint8_t> compressed;
+    std::array<uint8_t, 256 * 4> palette{};
+    for (size_t i = 0; i < 256; i++) {
+        palette[i * 4 + 3] = 255;
+    }
+
+    size_t position = 8;
+    bool ended = false;
+    while (!ended) {
+        if (position + 12 > bytes.size()) {
+            error = "truncated chunk";
+            return false;
+        }
+        uint32_t length = ReadBigEndian(bytes.data() + position);
+        const uint8_t* type = bytes.data() + position + 4;
+        const uint8_t* data = type + 4;
+        if (length > bytes.size() - position - 12) {
+            error = "truncated chunk";
+            return false;
+        }
+        if (Crc32(type, length + 4) != ReadBigEndian(data + length)) {
+            error = "chunk checksum mismatch";
+            return false;
+        }
+
+        if (std::memcmp(type, "IHDR", 4) == 0 && length == 13) {
+            width = ReadBigEndian(data);
+            height = ReadBigEndian(data + 4);
+            uint8_t depth = data[8];
+            colorType = data[9];
+            bool knownType = colorType == 0 || colorType == 2 || colorType == 3 || colorType == 4 || colorType == 6;
+            if (depth != 8 || !knownType || data[10] != 0 || data[11] != 0 || data[12] != 0) {
+                error = "only 8-bit, non-interlaced PNGs are supported";
+                return false;
+            }
+            if (width == 0 || height == 0 || width > PNG_MAX_SIDE || height > PNG_MAX_SIDE) {
+                error = "image size out of range";
+                return false;
+            }
+            headerSeen = true;
+        }
+        else if (std::memcmp(type, "PLTE", 4) == 0) {
+            for (uint32_t i = 0; i < length / 3 && i < 256; i++) {
+                std::memcpy(&palette[i * 4], data + i * 3, 3);
+            }
+        }
+        else if (std::memcmp(type, "tRNS", 4) == 0 && colorType == 3) {
+            for (uint32_t i = 0; i < length && i < 256; i++) {
+                palette[i * 4 + 3] = data[i];
+            }
+        }
+        else if (std::memcmp(type, "IDAT", 4) == 0) {
+            compressed.insert(compressed.end(), data, data + length);
+        }
+        else if (std::memcmp(type, "IEND", 4) == 0) {
+            ended = true;
+        }
+        else if ((type[0] & 0x20) == 0) {
+            error = "unknown critical chunk";
+            return false;
+        }
+
+        position += 12 + length;
+    }
+
+    if (!headerSeen) {
+        error = "missing IHDR";
+        return false;
+    }
+
+    size_t channels = colorType == 0 ? 1 : colorType == 2 ? 3 : colorType == 3 ? 1 : colorType == 4 ? 2 : 4;
+    size_t rowBytes = width * channels;
+    // The filtered rows are all the stream may hold, a larger one is corrupt or hostile
+    size_t expected = (rowBytes + 1) * height;
+    std::vector<uint8_t> raw;
+    raw.reserve(expected);
+    if (!Unzlib(compressed, raw, expected, error)) {
+        return false;
+    }
+    if (raw.size() != expected) {
+        error = "pixel data size mismatch";
+        return false;
+    }
+    if (!Unfilter(raw, rowBytes, height, channels)) {
+        error = "invalid filter type";
+        return false;
+    }
+
+    image.width = static_cast<int>(width);
+    image.height = static_cast<int>(height);
+    image.rgba.resize(size_t(width) * height * 4);
+    uint8_t* out = image.rgba.data();
+    for (size_t y = 0; y < height; y++) {
+        const uint8_t* row = raw.data() + y * (rowBytes + 1) + 1;
+        for (size_t x = 0; x < width; x++, out += 4) {
+            const uint8_t* in = row + x * channels;
+            switch (colorType) {
+            case 0: out[0] = out[1] = out[2] = in[0]; out[3] = 255; break;
+            case 2: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = 255; break;
+            case 3: std::memcpy(out, &palette[in[0] * 4], 4); break;
+            case 4: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+            default: std::memcpy(out, in, 4); break;
+            }
+        }
+    }
+    return true;
+}
+
+#endif  // LADDERRANK_STB_IMAGE
+
+bool LoadPNG(const std::filesystem::path& path, IconImage& image, std::string& error) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        error = "cannot open " + path.string();
+        return false;
+    }
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    if (!DecodePNG(bytes, image, error)) {
+        error = path.filename().string() + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// PNG ENCODE
+// ============================================================================
+
+static void WriteChunk(std::vector<uint8_t>& out, const char* type, const uint8_t* data, size_t length) {
+    WriteBigEndian(out, static_cast<uint32_t>(length));
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data, data + length);
+    WriteBigEndian(out, Crc32(out.data() + start, length + 4));
+}
+
+std::vector<uint8_t> EncodePNG(const IconImage& image) {
+    size_t rowBytes = size_t(image.width) * 4;
+
+    // Filter type 0 on every row
+    std::vector<uint8_t> raw;
+    raw.reserve((rowBytes + 1) * image.height);
+    for (int y = 0; y < image.height; y++) {
+        raw.push_back(0);
+        const uint8_t* row = image.rgba.data() + y * rowBytes;
+        raw.insert(raw.end(), row, row + rowBytes);
+    }
+
+    // zlib stream of stored blocks, 65535 bytes each
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    zlib.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    size_t offset = 0;
+    do {
+        size_t length = std::min<size_t>(raw.size() - offset, 65535);
+        bool last = offset + length == raw.size();
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(uint8_t(length));
+        zlib.push_back(uint8_t(length >> 8));
+        zlib.push_back(uint8_t(~length));
+        zlib.push_back(uint8_t(~length >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+        offset += length;
+    } while (offset < raw.size());
+    WriteBigEndian(zlib, Adler32(raw.data(), raw.size()));
+
+    std::vector<uint8_t> out(PNG_SIGNATURE, PNG_SIGNATURE + 8);
+    out.reserve(zlib.size() + 64);
+
+    std::vector<uint8_t> header;
+    WriteBigEndian(header, static_cast<uint32_t>(image.width));
+    WriteBigEndian(header, static_cast<uint32_t>(image.height));
+    header.insert(header.end(), { 8, 6, 0, 0, 0 });  // 8-bit RGBA, deflate, no interlace
+
+    WriteChunk(out, "IHDR", header.data(), header.size());
+    WriteChunk(out, "IDAT", zlib.data(), zlib.size());
+    WriteChunk(out, "IEND", nullptr, 0);
+    return out;
+}
+
+bool SavePNG(const std::filesystem::path& path, const IconImage& image, std::string& error) {
+    std::vector<uint8_t> bytes = EncodePNG(image);
+
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            error = "cannot create " + temporary.string();
+            return false;
+        }
+        stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!stream) {
+            error = "cannot write " + temporary.string();
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        error = "cannot replace " + path.string() + ": " + ec.message();
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// RESIZE
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Source pixels covered by one destination pixel along one axis
+ */
+struct AreaSpan {
+    int first = 0;
+    std::vector<float> weights;  // Coverage of first, first + 1, ..., summing to 1
+};
+
+std::vector<AreaSpan> AreaSpans(int sourceSize, int destinationSize) {
+    std::vector<AreaSpan> spans(destinationSize);
+    double scale = double(sourceSize) / destinationSize;
+    for (int d = 0; d < destinationSize; d++) {
+        double start = d * scale;
+        double end = (d + 1) * scale;
+        int first = static_cast<int>(std::floor(start));
+        int last = std::min(static_cast<int>(std::ceil(end)), sourceSize) - 1;
+
+        AreaSpan& span = spans[d];
+        span.first = first;
+        double total = 0.0;
+        for (int s = first; s <= last; s++) {
+            double coverage = std::min(end, double(s + 1)) - std::max(start, double(s));
+            span.weights.push_back(static_cast<float>(coverage));
+            total += coverage;
+        }
+        for (float& weight : span.weights) {
+            weight = static_cast<float>(weight / total);
+        }
+    }
+    return spans;
+}
+
+}  // namespace
+
+IconImage ResizeIcon(const IconImage& source, int width, int height) {
+    IconImage result;
+    if (source.Empty() || width <= 0 || height <= 0) {
+        return result;
+    }
+
+    std::vector<AreaSpan> columns = AreaSpans(source.width, width);
+    std::vector<AreaSpan> rows = AreaSpans(source.height, height);
+
+    // Horizontal pass into premultiplied floats
+    std::vector<float> horizontal(size_t(width) * source.height * 4);
+    for (int y = 0; y < source.height; y++) {
+        const uint8_t* in = source.rgba.data() + size_t(y) * source.width * 4;
+        float* out = horizontal.data() + size_t(y) * width * 4;
+        for (int x = 0; x < width; x++, out += 4) {
+            const AreaSpan& span = columns[x];
+            for (size_t k = 0; k < span.weights.size(); k++) {
+                const uint8_t* pixel = in + size_t(span.first + k) * 4;
+                float weight = span.weights[k] * pixel[3];
+                out[0] += pixel[0] * weight;
+                out[1] += pixel[1] * weight;
+                out[2] += pixel[2] * weight;
+                out[3] += weight;
+            }
+        }
+    }
+
+    // Vertical pass, then back to straight alpha
+    result.width = width;
+    result.height = height;
+    result.rgba.resize(size_t(width) * height * 4);
+    std::vector<float> sum(size_t(width) * 4);
+    for (int y = 0; y < height; y++) {
+        std::fill(sum.begin(), sum.end(), 0.0f);
+        const AreaSpan& span = rows[y];
+        for (size_t k = 0; k < span.weights.size(); k++) {
+            const float* in = horizontal.data() + size_t(span.first + k) * width * 4;
+            for (size_t i = 0; i < sum.size(); i++) {
+                sum[i] += in[i] * span.weights[k];
+            }
+        }
+
+        uint8_t* out = result.rgba.data() + size_t(y) * width * 4;
+        for (int x = 0; x < width; x++) {
+            const float* pixel = sum.data() + size_t(x) * 4;
+            float alpha = pixel[3];
+            for (int c = 0; c < 3; c++) {
+                float value = alpha > 0.0f ? pixel[c] / alpha : 0.0f;
+                out[x * 4 + c] = static_cast<uint8_t>(std::clamp(value + 0.5f, 0.0f, 255.0f));
+            }
+            out[x * 4 + 3] = static_cast<uint8_t>(std::clamp(alpha + 0.5f, 0.0f, 255.0f));
+        }
+    }
+    return result;
+}
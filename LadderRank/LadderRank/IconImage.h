@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// ICON IMAGE
+// ============================================================================
+
+/**
+ * @brief Decoded 8-bit RGBA image, rows top to bottom, straight alpha
+ */
+struct IconImage {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> rgba;   // width * height * 4 bytes
+
+    bool Empty() const { return width == 0 || height == 0; }
+    size_t Bytes() const { return rgba.size(); }
+};
+
+// ============================================================================
+// PNG CODEC
+// ============================================================================
+//
+// Just enough PNG for the rank icons, without zlib:
+//
+//   Decode  With stb_image (stbi_load_from_memory) once
+//           imguibindings/stb_image.h is vendored next to the plugin
+//           sources, as imguivariouscontrols.cpp already expects. Until
+//           then a built-in inflater takes 8-bit grey, grey+alpha, RGB, RGBA
+//           and palette images, not interlaced, every filter type, and
+//           rejects any other PNG.
+//   Encode  RGBA with stored (uncompressed) deflate blocks. The files are
+//           larger, but reading them back is little more than a copy, which
+//           is what matters for files the game decodes while it runs.
+
+#if __has_include("imguibindings/stb_image.h")
+#define LADDERRANK_STB_IMAGE 1
+#else
+#define LADDERRANK_STB_IMAGE 0
+#endif
+
+/**
+ * @brief Decodes a PNG held in memory
+ * @param bytes PNG file contents
+ * @param image Receives the image as RGBA
+ * @param error Receives the reason the PNG was rejected
+ * @return True on success
+ */
+bool DecodePNG(std::span<const uint8_t> bytes, IconImage& image, std::string& error);
+
+/**
+ * @brief Reads and decodes a PNG file
+ */
+bool LoadPNG(const std::filesystem::path& path, IconImage& image, std::string& error);
+
+/**
+ * @brief Encodes an image as an RGBA PNG with stored deflate blocks
+ * @param image Image to encode
+ * @return PNG file contents
+ */
+std::vector<uint8_t> EncodePNG(const IconImage& image);
+
+/**
+ * @brief Encodes an image and writes it, replacing the file in one rename
+ */
+bool SavePNG(const std::filesystem::path& path, const IconImage& image, std::string& error);
+
+/**
+ * @brief Scales an image with an area filter
+ *
+ * Every destination pixel averages the source pixels it covers, weighted by
+ * coverage, with alpha premultiplied so transparent edges do not darken.
+ * @param source Image to scale
+ * @param width Destination width
+ * @param height Destination height
+ * @return Scaled image
+ */
+IconImage ResizeIcon(const IconImage& source, int width, int height);
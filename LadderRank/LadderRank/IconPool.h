@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+// ============================================================================
+// ICON POOL
+// ============================================================================
+
+/**
+ * @brief Fixed set of texture slots, each loaded once on first use
+ *
+ * Slots are indexed (rank tier), so switching the displayed icon is an index
+ * change and never loads or frees anything. A slot is only loaded again
+ * after Invalidate(), for example when the icon files changed. Textures
+ * stay alive while a caller holds them, even past an Invalidate().
+ *
+ * Single-threaded. Has no BakkesMod dependency: the texture type, the
+ * loader and the size estimate are supplied by the owner, so the pool can
+ * be exercised with a stand-in texture.
+ */
+template <typename Texture, size_t SLOTS>
+class IconPool {
+public:
+    /**
+     * @brief Creates the texture of a slot
+     * @return Texture, or nullptr if the slot cannot be loaded
+     */
+    using Loader = std::function<std::shared_ptr<Texture>(int slot)>;
+
+    /**
+     * @brief Estimates the memory a loaded texture keeps resident
+     */
+    using Measure = std::function<size_t(Texture& texture)>;
+
+    IconPool(Loader loader, Measure measure)
+        : loader(std::move(loader)), measure(std::move(measure)) {
+    }
+
+    /**
+     * @brief Returns the texture of a slot, loading it on first use
+     * @param slot Slot index, out of range returns nullptr
+     */
+    std::shared_ptr<Texture> Get(int slot) {
+        if (slot < 0 || static_cast<size_t>(slot) >= SLOTS) {
+            return nullptr;
+        }
+
+        Slot& entry = slots[slot];
+        if (entry.loaded) {
+            reuses++;
+            return entry.texture;
+        }
+
+        // A failed load is remembered too, a missing file is not retried every frame
+        entry.loaded = true;
+        entry.texture = loader(slot);
+        entry.bytes = entry.texture ? measure(*entry.texture) : 0;
+        residentBytes += entry.bytes;
+        loads++;
+        return entry.texture;
+    }
+
+    /**
+     * @brief Checks whether a slot was loaded since the last Invalidate(), successfully or not
+     */
+    bool Loaded(int slot) const {
+        return slot >= 0 && static_cast<size_t>(slot) < SLOTS && slots[slot].loaded;
+    }
+
+    /**
+     * @brief Returns a slot's texture only if it is already loaded
+     */
+    std::shared_ptr<Texture> Peek(int slot) const {
+        if (slot < 0 || static_cast<size_t>(slot) >= SLOTS) {
+            return nullptr;
+        }
+        return slots[slot].texture;
+    }
+
+    /**
+     * @brief Drops every slot, the next Get() of each one loads it again
+     */
+    void Invalidate() {
+        slots = {};
+        residentBytes = 0;
+        invalidations++;
+    }
+
+    size_t ResidentSlots() const {
+        size_t count = 0;
+        for (const Slot& entry : slots) {
+            count += entry.texture ? 1 : 0;
+        }
+        return count;
+    }
+
+    uint64_t Loads() const { return loads; }
+    uint64_t Reuses() const { return reuses; }
+    uint64_t Invalidations() const { return invalidations; }
+    size_t ResidentBytes() const { return residentBytes; }
+
+private:
+    struct Slot {
+        std::shared_ptr<Texture> texture;
+        size_t bytes = 0;
+        bool loaded = false;     // Load attempted since the last Invalidate()
+    };
+
+    Loader loader;
+    Measure measure;
+    std::array<Slot, SLOTS> slots;
+
+    uint64_t loads = 0;          // Textures created
+    uint64_t reuses = 0;         // Get() calls answered by a loaded slot
+    uint64_t invalidations = 0;
+    size_t residentBytes = 0;
+};
@@ -3,6 +3,8 @@
 #include "bakkesmod/wrappers/MMRWrapper.h"
 #include "bakkesmod/wrappers/GuiManagerWrapper.h"
 #include "utils/parser.h"
+#include "SeasonArchive.h"
+#include "IMGUI/imguivariouscontrols.h"
 #include "json.hpp"
 
 using json = nlohmann::json;
@@ -14,29 +16,6 @@ BAKKESMOD_PLUGIN(LadderRank, "LadderRank", plugin_version, PLUGINTYPE_FREEPLAY)
 
 std::shared_ptr<CVarManagerWrapper> _globalCvarManager;
 
-// ============================================================================
-// HELPER FUNCTIONS
-// ============================================================================
-
-/**
- * @brief Converts rank tier and division to display name
- * @param rank Tier level (0-22)
- * @param div Division within tier (0-3)
- * @return Display name like "DIV I", "DIV II", etc.
- */
-std::string GetDivName(int rank, int div) {
-    if (rank < 0 || rank > 22) {
-        return "ERROR";
-    }
-
-    if (rank == 0 || rank == 22) {
-        return " ";
-    }
-
-    const std::string divNumbers[] = { "I", "II", "III", "IV" };
-    return "DIV " + divNumbers[div];
-}
-
 // ============================================================================
 // PLUGIN LIFECYCLE
 // ============================================================================
@@ -54,31 +33,78 @@ void LadderRank::onLoad() {
 
     // Register CVars
     RegisterCVars();
+    LoadSavedLayouts();
 
     // Initialize state
     shouldDraw = true;
     drawCanvas = true;
 
-    // Load rank data after delay
-    gameWrapper->SetTimeout([this](GameWrapper* gw) {
-        LoadDefaultRankData();
-        }, 2.0f);
+    // Thresholds are compiled in, data folder overrides are applied in the background
+    StartRankDataWatcher();
+    StartMMRHistory();
+    LoadMMRTrends();
 
     // Hook game events
     RegisterEventHooks();
+    RegisterCommands();
+
+    // Push path for MMR changes, the token unregisters when released
+    mmrNotifier = gameWrapper->GetMMRWrapper().RegisterMMRNotifier([this](UniqueIDWrapper id) {
+        OnMMRChanged(id);
+        });
+
+    // One texture for every rank icon, decoded in the background, then the
+    // icons of the default snapshot
+    auto dataFolder = gameWrapper->GetDataFolder() / "LadderRank";
+    iconLoader.Start(1, [this, dataFolder](AssetResult& result) {
+        OnIconsDecoded(dataFolder, result);
+        });
+    RequestRankAtlas();
+    LoadRankIcons();
 
-    // Initialize rank images with default
-    auto defaultPath = gameWrapper->GetDataFolder() / "LadderRank" / "RankIcons" / "0.png";
-    currentRank = std::make_shared<ImageWrapper>(defaultPath, true, false);
-    nextRank = std::make_shared<ImageWrapper>(defaultPath, true, false);
-    beforeRank = std::make_shared<ImageWrapper>(defaultPath, true, false);
+    // Coalesces every delayed MMR refresh; at most the selected playlist and
+    // the match playlist wait at the same time
+    refreshScheduler = std::make_unique<RefreshScheduler>(
+        [this](float delaySeconds, std::function<void()> callback) {
+            gameWrapper->SetTimeout([callback](GameWrapper* gw) {
+                callback();
+                }, delaySeconds);
+        },
+        [this](int key) {
+            return (key == LOBBY_REFRESH_KEY) ? ResolveLobby() : RefreshPlaylist(key);
+        },
+        2);
+
+    // Load rank data, retries by itself until MMR is synced
+    LoadDefaultRankData();
 
     LOG("Plugin initialization complete");
 }
 
 void LadderRank::onUnload() {
+    // Game thread work queued by the other threads is dropped from here on
+    alive->store(false);
+    mmrNotifier.reset();
+    refreshScheduler.reset();
+    rankWatcher.Stop();
+    snapshotWorker.Stop();
+    iconLoader.Stop();
+    mmrHistory.Close();
+    cvarManager->removeNotifier("ladderrank_reload_stats");
+    cvarManager->removeNotifier("ladderrank_reload_icons");
+    cvarManager->removeNotifier("ladderrank_perf");
+    cvarManager->removeNotifier("ladderrank_layout_bench");
+    cvarManager->removeNotifier("ladderrank_layout_save");
+    cvarManager->removeNotifier("ladderrank_layout_delete");
+    cvarManager->removeNotifier("ladderrank_layout_list");
+    cvarManager->removeNotifier("ladderrank_season_diff");
+    cvarManager->removeNotifier("ladderrank_history");
+    cvarManager->removeNotifier("ladderrank_history_compact");
+    cvarManager->removeNotifier("ladderrank_session_reset");
+
     gameWrapper->UnhookEvent("Function TAGame.GameEvent_Soccar_TA.OnMatchWinnerSet");
     gameWrapper->UnhookEvent("Function TAGame.GameEvent_Soccar_TA.Destroyed");
+    gameWrapper->UnhookEvent("Function TAGame.GameEvent_TA.Countdown.BeginState");
     gameWrapper->UnhookEvent("Function TAGame.GFxData_MenuStack_TA.ButtonTriggered");
     gameWrapper->UnregisterDrawables();
 }
@@ -87,6 +113,14 @@ void LadderRank::onUnload() {
 // CVAR AND EVENT REGISTRATION
 // ============================================================================
 
+void LadderRank::RunOnGameThread(std::function<void()> work) {
+    gameWrapper->Execute([alive = alive, work = std::move(work)](GameWrapper* gw) {
+        if (alive->load()) {
+            work();
+        }
+        });
+}
+
 void LadderRank::RegisterCVars() {
     // Plugin state
     cvarManager->registerCvar("LadderRank_enabled", "1",
@@ -129,6 +163,255 @@ void LadderRank::RegisterCVars() {
     // Visual settings
     cvarManager->registerCvar("LadderRank_opacity", "255",
         "Adjust the opacity of the background", true, true, 0.f, true, 255.f);
+
+    // Lobby lookup
+    cvarManager->registerCvar("LadderRank_lobby_ranks", "0",
+        "Show the rank of every player in the match", true, true, 0, true, 1);
+
+    // Rendering and the event handlers only read the mirrored values
+    BindLayoutCvar("LadderRank_enabled", &LayoutConfig::enabled);
+    BindLayoutCvar("LadderRank_lobby_ranks", &LayoutConfig::lobbyRanks);
+    for (const LayoutField& field : LayoutFields()) {
+        BindLayoutCvar("LadderRank_" + std::string(field.name), field.field);
+    }
+}
+
+template <typename T>
+void LadderRank::BindLayoutCvar(const std::string& name, T LayoutConfig::* field) {
+    auto read = [](const CVarWrapper& cvar) -> T {
+        if constexpr (std::is_same_v<T, bool>) {
+            return cvar.getBoolValue();
+        }
+        else {
+            return cvar.getFloatValue();
+        }
+    };
+
+    CVarWrapper cvar = cvarManager->getCvar(name);
+    if (!cvar) {
+        return;
+    }
+    layout.*field = read(cvar);
+
+    cvar.addOnValueChanged([this, field, read](std::string oldValue, CVarWrapper changed) {
+        // The settings window changes cvars on the render thread, layout
+        // belongs to the game thread
+        T value = read(changed);
+        RunOnGameThread([this, field, value]() {
+            layout.*field = value;
+            layoutChanges++;
+            displayDirty = true;
+            });
+        });
+}
+
+void LadderRank::RegisterCommands() {
+    cvarManager->registerNotifier("ladderrank_reload_stats", [this](std::vector<std::string> args) {
+        LOG("Rank threshold reloads: {}, generation: {}, last reload: {:.2f} ms, readers that crossed a generation: {}",
+            rankWatcher.ReloadCount(), rankStore.Generation(),
+            rankWatcher.LastReloadMilliseconds(), rankStore.CrossedReaders());
+        LOG("Post-match MMR updates: {} from the notifier, {} from polling, last one on screen {:.0f} ms after the match ended",
+            notifierUpdates, pollUpdates, lastUpdateMilliseconds);
+        LOG("MMR refreshes: {} requested, {} merged into a pending one, {} fetched, {} cancelled timers dropped",
+            refreshScheduler->Requests(), refreshScheduler->Coalesced(),
+            refreshScheduler->Fetches(), refreshScheduler->Dropped());
+        LOG("Lobby cache: {} players, {} hits, {} misses, {} expired, {} evicted",
+            lobbyCache.Size(), lobbyCache.Hits(), lobbyCache.Misses(), lobbyCache.Expired(), lobbyCache.Evictions());
+        LOG("MMR history: {} readings appended, {} disk syncs, {} readings lost to write errors",
+            mmrHistory.Appended(), mmrHistory.Syncs(), mmrHistory.FailedRecords());
+        }, "Show threshold reloads, post-match MMR updates, refresh scheduler, lobby cache and history statistics", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_perf", [this](std::vector<std::string> args) {
+        LOG("Layout: {} cvar changes applied", layoutChanges);
+        LOG("Display list: {} rebuilds, {} draw commands, {} strings",
+            displayBuilds, displayList.Commands().size(), displayList.StringCount());
+        LOG("Rank icons: {} tier changes, {} updates kept all three, {} loads, {} reuses, {} invalidations",
+            iconUpdates, iconUpdatesSkipped, iconPool.Loads(), iconPool.Reuses(), iconPool.Invalidations());
+        LOG("Icon textures: atlas {:.2f} MB, {} single icons {:.2f} MB resident",
+            rankAtlasBytes / 1048576.0, iconPool.ResidentSlots(), iconPool.ResidentBytes() / 1048576.0);
+        LOG("Icon texture loads: {} on the game thread, {:.1f} ms in total, worst {:.1f} ms (ImageWrapper file decode and upload)",
+            textureLoads, textureLoadMilliseconds, textureLoadMaxMilliseconds);
+        LOG("Icon loader: {} requests, {} delivered, {} cancelled, {} replaced, {} rejected, {:.1f} MB decoded",
+            iconLoader.Submitted(), iconLoader.Delivered(), iconLoader.Cancelled(), iconLoader.Replaced(),
+            iconLoader.Rejected(), iconLoader.DecodedBytes() / 1048576.0);
+
+#if LADDERRANK_PERF
+        // Per frame and per update timings, compiled out with LADDERRANK_PERF=0
+        bool reset = (args.size() > 1 && args[1] == "reset");
+
+        std::vector<float> samples;
+        for (size_t probe = 0; probe < PERF_PROBE_COUNT; probe++) {
+            PerfRing& ring = perfRings[probe];
+            ring.Snapshot(samples);
+            PerfStats stats = SummarizePerf(samples);
+            LOG("{}: {} samples ({} since load), avg {:.1f} us, p50 {:.1f} us, p99 {:.1f} us, max {:.1f} us",
+                PerfProbeName(static_cast<PerfProbe>(probe)), stats.samples, ring.Recorded(),
+                stats.average, stats.p50, stats.p99, stats.max);
+            if (reset) {
+                ring.Reset();
+            }
+        }
+#endif
+        }, "Show what the overlay costs: display list, icon and loader counters, frame and MMR update timings ('reset' starts a new timing window)", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_reload_icons", [this](std::vector<std::string> args) {
+        ReloadRankIcons();
+        }, "Load the rank icons again from the data folder", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_layout_bench", [this](std::vector<std::string> args) {
+        int frames = (args.size() > 1) ? get_safe_int(args[1]) : 1000;
+        if (frames <= 0) {
+            LOG("Usage: ladderrank_layout_bench [frames]");
+            return;
+        }
+
+        std::vector<std::string> names;
+        for (const LayoutField& field : LayoutFields()) {
+            names.push_back("LadderRank_" + std::string(field.name));
+        }
+
+        // What RenderCanvas() paid per frame before layout, against what it pays now
+        float sink = 0.0f;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            for (const std::string& name : names) {
+                sink += cvarManager->getCvar(name).getFloatValue();
+            }
+        }
+        auto middle = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            for (const LayoutField& field : LayoutFields()) {
+                sink += layout.*field.field;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double lookupMicroseconds = std::chrono::duration<double, std::micro>(middle - start).count() / frames;
+        double layoutMicroseconds = std::chrono::duration<double, std::micro>(end - middle).count() / frames;
+        LOG("Layout per frame: {:.3f} us with getCvar, {:.3f} us from layout (checksum {})",
+            lookupMicroseconds, layoutMicroseconds, sink);
+        }, "Time the per-frame layout cvar lookups against the cached layout: ladderrank_layout_bench [frames]", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_layout_save", [this](std::vector<std::string> args) {
+        savedLayouts.Store(screenSize.X, screenSize.Y, layout);
+
+        std::string error;
+        if (!savedLayouts.Save(layoutsPath, error)) {
+            LOG("Cannot save layouts: {}", error);
+            return;
+        }
+        LOG("Layout saved for {}x{}", screenSize.X, screenSize.Y);
+        }, "Save the current layout for the current resolution", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_layout_delete", [this](std::vector<std::string> args) {
+        if (!savedLayouts.Remove(screenSize.X, screenSize.Y)) {
+            LOG("No layout saved for {}x{}", screenSize.X, screenSize.Y);
+            return;
+        }
+
+        std::string error;
+        if (!savedLayouts.Save(layoutsPath, error)) {
+            LOG("Cannot save layouts: {}", error);
+            return;
+        }
+        LOG("Layout for {}x{} deleted", screenSize.X, screenSize.Y);
+        }, "Delete the layout saved for the current resolution", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_layout_list", [this](std::vector<std::string> args) {
+        for (const auto& [resolution, saved] : savedLayouts.All()) {
+            LOG("{}x{}: offset {:.0f},{:.0f}, size {:.0f}x{:.0f}{}", resolution.first, resolution.second,
+                saved.offsetX, saved.offsetY, saved.rectWidth, saved.rectHeight,
+                (resolution.first == screenSize.X && resolution.second == screenSize.Y) ? " (current)" : "");
+        }
+        LOG("{} saved layouts, screen is {}x{}, {} resolution changes seen",
+            savedLayouts.All().size(), screenSize.X, screenSize.Y, resolutionChanges);
+        }, "List the layouts saved per resolution", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_season_diff", [this](std::vector<std::string> args) {
+        if (args.size() < 3) {
+            LOG("Usage: ladderrank_season_diff <from season> <to season> [playlist]");
+            return;
+        }
+
+        SeasonArchive archive;
+        std::string error;
+        auto archivePath = gameWrapper->GetDataFolder() / "LadderRank" / "RankSeasons.bin";
+        if (!archive.Open(archivePath, error)) {
+            LOG("Cannot read {}: {}", archivePath.string(), error);
+            return;
+        }
+
+        int from = archive.FindSeason(get_safe_int(args[1]));
+        int to = archive.FindSeason(get_safe_int(args[2]));
+        int playlist = (args.size() > 3) ? get_safe_int(args[3]) : 0;
+        if (from < 0 || to < 0) {
+            LOG("Season {} or {} is not in the archive", args[1], args[2]);
+            return;
+        }
+
+        auto changes = archive.Diff(from, to, playlist);
+        for (const SeasonThresholdChange& change : changes) {
+            LOG("Playlist {} tier {} div {}: {}-{} -> {}-{}", change.playlist, change.tier, change.division + 1,
+                change.from.minMMR, change.from.maxMMR, change.to.minMMR, change.to.maxMMR);
+        }
+        LOG("Season {} -> {}: {} divisions moved", args[1], args[2], changes.size());
+        }, "Show threshold changes between two archived seasons: ladderrank_season_diff <from> <to> [playlist]", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_history", [this](std::vector<std::string> args) {
+        int playlist = (args.size() > 1) ? get_safe_int(args[1]) : userPlaylist;
+        int days = (args.size() > 2) ? get_safe_int(args[2]) : 7;
+
+        // Readings still queued in the writer would be missing from the map
+        mmrHistory.Flush();
+
+        MMRHistory history;
+        std::string error;
+        if (!history.Open(mmrHistoryPath, error)) {
+            LOG("Cannot read {}: {}", mmrHistoryPath.string(), error);
+            return;
+        }
+
+        int64_t now = HistoryTimestampNow();
+        auto records = history.Query(playlist, now - int64_t(days) * 24 * 60 * 60 * 1000, now + 1);
+        if (records.empty()) {
+            LOG("No MMR readings for playlist {} in the last {} days ({} readings in total)",
+                playlist, days, history.Count());
+            return;
+        }
+
+        int wins = 0;
+        int losses = 0;
+        for (const MMRHistoryRecord& record : records) {
+            wins += record.outcome == static_cast<int8_t>(MatchOutcome::Win);
+            losses += record.outcome == static_cast<int8_t>(MatchOutcome::Loss);
+        }
+        LOG("Playlist {} over {} days: {} readings, MMR {:.0f} -> {:.0f}, {} wins, {} losses",
+            playlist, days, records.size(), records.front().mmr, records.back().mmr, wins, losses);
+        }, "Summarize the MMR history of a playlist: ladderrank_history [playlist] [days]", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_history_compact", [this](std::vector<std::string> args) {
+        int days = (args.size() > 1) ? get_safe_int(args[1]) : 0;
+        int64_t keepFrom = (days > 0) ? HistoryTimestampNow() - int64_t(days) * 24 * 60 * 60 * 1000 : 0;
+
+        // The file is replaced, so the writer lets go of it meanwhile
+        mmrHistory.Close();
+        std::string error;
+        int64_t removed = CompactMMRHistory(mmrHistoryPath, keepFrom, error);
+        if (removed < 0) {
+            LOG("Cannot compact {}: {}", mmrHistoryPath.string(), error);
+        }
+        else {
+            LOG("MMR history compacted, {} readings removed", removed);
+        }
+        StartMMRHistory();
+        }, "Drop repeated and corrupt MMR readings: ladderrank_history_compact [days to keep]", PERMISSION_ALL);
+
+    cvarManager->registerNotifier("ladderrank_session_reset", [this](std::vector<std::string> args) {
+        sessionStats.Reset();
+        PublishSessionText();
+        displayDirty = true;
+        LOG("Session statistics reset");
+        }, "Start a new session: MMR delta, streak and win rate count from now", PERMISSION_ALL);
 }
 
 void LadderRank::RegisterEventHooks() {
@@ -137,194 +420,479 @@ void LadderRank::RegisterEventHooks() {
 
     gameWrapper->HookEvent("Function TAGame.GameEvent_Soccar_TA.Destroyed",
         std::bind(&LadderRank::loadMenu, this, std::placeholders::_1));
+
+    gameWrapper->HookEvent("Function TAGame.GameEvent_TA.Countdown.BeginState",
+        std::bind(&LadderRank::OnCountdown, this, std::placeholders::_1));
 }
 
 // ============================================================================
 // RANK DATA LOADING
 // ============================================================================
 
+void LadderRank::StartRankDataWatcher() {
+    auto defaults = std::make_unique<RankTable>();
+    defaults->LoadEmbeddedDefaults();
+    rankStore.Publish(std::move(defaults));
+
+    // Snapshots are built off the game thread; only the pointer swap and
+    // the icons are left for the game thread
+    snapshotWorker.Start(rankStore, [this](std::shared_ptr<const RankSnapshotSet> published, int rebuilt) {
+        RunOnGameThread([this, published, rebuilt]() {
+            LOG("Rebuilt {} of {} playlist snapshots (set version {})",
+                rebuilt, RANK_PLAYLIST_COUNT, published->version);
+            SelectSnapshot(userPlaylist);
+            });
+        });
+
+    auto dataFolder = gameWrapper->GetDataFolder() / "LadderRank";
+    rankWatcher.Start(rankStore, dataFolder, std::chrono::seconds(2),
+        [this](const std::string& report, double milliseconds) {
+            // Every snapshot built from the previous table is rebuilt
+            snapshotWorker.Rebuild();
+
+            RunOnGameThread([this, report, milliseconds]() {
+                LOG("Rank thresholds reloaded in {:.2f} ms (generation {}):\n{}",
+                    milliseconds, rankStore.Generation(), report);
+                });
+        });
+}
+
+void LadderRank::LoadSavedLayouts() {
+    layoutsPath = gameWrapper->GetDataFolder() / "LadderRank" / "layouts.json";
+
+    std::string error;
+    if (!savedLayouts.Load(layoutsPath, error)) {
+        LOG("Saved layouts ignored, {}: {}", layoutsPath.string(), error);
+        return;
+    }
+    if (!savedLayouts.All().empty()) {
+        LOG("{} saved layouts loaded", savedLayouts.All().size());
+    }
+}
+
+void LadderRank::StartMMRHistory() {
+    mmrHistoryPath = gameWrapper->GetDataFolder() / "LadderRank" / "MMRHistory.bin";
+
+    std::string error;
+    if (!mmrHistory.Open(mmrHistoryPath, std::chrono::seconds(5), error)) {
+        LOG("MMR history disabled: {}", error);
+    }
+}
+
+void LadderRank::LoadMMRTrends() {
+    MMRHistory history;
+    std::string error;
+    if (!history.Open(mmrHistoryPath, error)) {
+        return;
+    }
+
+    // A month of readings is plenty to settle the averages
+    int64_t now = HistoryTimestampNow();
+    int64_t from = now - int64_t(30) * 24 * 60 * 60 * 1000;
+    for (const MMRHistoryRecord& record : history.Query(0, from, now + 1)) {
+        int slot = RankTable::PlaylistSlot(record.playlist);
+        if (slot >= 0) {
+            mmrTrends[slot].Update(record.mmr);
+        }
+    }
+
+    for (int slot = 0; slot < RANK_PLAYLIST_COUNT; slot++) {
+        const MMRTrend& trend = mmrTrends[slot];
+        if (trend.gains > 0 || trend.losses > 0) {
+            LOG("Playlist {}: +{:.1f} per win ({} wins), -{:.1f} per loss ({} losses) from history",
+                RankTable::rankedPlaylists[slot], trend.gain, trend.gains, trend.loss, trend.losses);
+        }
+    }
+}
+
 void LadderRank::LoadDefaultRankData() {
     LOG("LoadDefaultRankData called");
 
-    MMRWrapper mmrWrapper = gameWrapper->GetMMRWrapper();
     uniqueID = gameWrapper->GetUniqueID();
     LOG("UniqueID retrieved");
 
     // Get selected playlist
     userPlaylist = cvarManager->getCvar("LadderRank_playlist").getIntValue();
+    PublishSessionText();
 
-    // Check sync status
-    bool isSynced = mmrWrapper.IsSynced(uniqueID, userPlaylist);
-    bool isSyncing = mmrWrapper.IsSyncing(uniqueID);
-    LOG("IsSynced: {}, IsSyncing: {}", isSynced, isSyncing);
+    // Show what the last sync computed right away, or a placeholder
+    if (!SelectSnapshot(userPlaylist)) {
+        auto loading = std::make_shared<RankSnapshot>();
+        loading->nameCurrent = "Loading...";
+        activeSnapshot = loading;
+        LoadRankIcons();
+        displayDirty = true;
+    }
 
-    // Wait for sync if needed
-    if (!isSynced || isSyncing) {
-        LOG("MMR data not synced yet, will retry in 1 second");
-        nameCurrent = "Loading...";
-        userMMR = 0.0f;
+    // Retries every second until synced. The MMR notifier usually fills the
+    // snapshot first, and a refresh already pending for the playlist absorbs this one.
+    refreshScheduler->Request(userPlaylist, 0.0f, 30, 1.0f);
+}
 
-        gameWrapper->SetTimeout([this](GameWrapper* gw) {
-            LoadDefaultRankData();
-            }, 1.0f);
-        return;
+void LadderRank::RequestRankAtlas() {
+    AssetRequest request{ ICON_ATLAS_KEY, {}, ICON_ATLAS_CELL };
+    for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+        request.sources.push_back(RankIconPath(tier));
     }
 
-    // Load player data
-    userMMR = mmrWrapper.GetPlayerMMR(uniqueID, userPlaylist);
-    LOG("UserMMR: {}", userMMR);
+    // Baked by IconBake, the loader falls back to the PNGs if it is stale
+    auto bundlePath = gameWrapper->GetDataFolder() / "LadderRank" / "IconBundle.bin";
+    if (std::filesystem::exists(bundlePath)) {
+        request.bundle = bundlePath;
+        request.bundlePixels = IconPixels();
+    }
 
-    SkillRank userRank = mmrWrapper.GetPlayerRank(uniqueID, userPlaylist);
-    userDiv = userRank.Division;
-    userTier = userRank.Tier;
-    LOG("UserTier: {}, UserDiv: {}", userTier, userDiv);
+    iconTickets[ICON_ATLAS_KEY] = iconLoader.Submit(std::move(request));
+    if (iconTickets[ICON_ATLAS_KEY] == 0) {
+        LOG("Rank icon atlas disabled, icons load one by one: loader queue full");
+    }
+}
 
-    nameCurrent = GetDivName(userTier, userDiv);
-    LOG("Rank name: {}", nameCurrent);
+float LadderRank::IconPixels() const {
+    // Right side icons, the left side icon, and Render() at 0.19 of a full cell
+    float largest = std::max({ layout.iconSize, 40.0f, 0.19f * ICON_ATLAS_CELL });
+    return largest * static_cast<float>(screenSize.Y) / 1080.0f;
+}
 
-    CalculateAdjacentRanks();
-    LoadRankIcons();
+void LadderRank::UpdateIconBucket() {
+    if (bundleCells.empty() || iconTickets[ICON_ATLAS_KEY] != 0) {
+        return;
+    }
 
-    LOG("Loaded playlist {} rank data successfully: Tier={}, Div={}, MMR={}",
-        userPlaylist, userTier, userDiv, userMMR);
+    int wanted = bundleCells[PickIconBucket(bundleCells, IconPixels())];
+    if (wanted != atlasCell) {
+        LOG("Icon size now fits the {} pixel bucket, loading it", wanted);
+        RequestRankAtlas();
+    }
 }
 
-void LadderRank::LoadRankIcons() {
-    auto dataFolder = gameWrapper->GetDataFolder() / "LadderRank" / "RankIcons";
+void LadderRank::OnIconsDecoded(const std::filesystem::path& dataFolder, AssetResult& result) {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t ticket = result.ticket;
+
+    std::string failures;
+    for (size_t i = 0; i < result.errors.size(); i++) {
+        if (!result.errors[i].empty()) {
+            failures += "\n  " + result.sources[i].filename().string() + ": " + result.errors[i];
+        }
+    }
 
-    // Current rank icon (middle)
-    auto currentPath = dataFolder / (std::to_string(userTier) + ".png");
-    currentRank = std::make_shared<ImageWrapper>(currentPath, true, false);
-    LOG("Loading CURRENT rank icon: {} (tier={})", currentPath.string(), userTier);
+    if (result.key == ICON_ATLAS_KEY) {
+        // Packed and written here as well. ImageWrapper only loads textures from
+        // files, so even a bundle bucket, packed already, is written out and then
+        // decoded again by ImageWrapper on the game thread. Stored deflate keeps
+        // that decode to about a copy, its cost shows in ladderrank_perf.
+        IconAtlas atlas;
+        std::string error;
+        auto atlasPath = dataFolder / "IconAtlas.png";
+        int cell = result.cellSize;
+        bool built = true;
+        if (!result.regions.empty()) {
+            atlas.image = std::move(result.images.front());
+            atlas.regions = std::move(result.regions);
+        }
+        else {
+            cell = ICON_ATLAS_CELL;
+            built = BuildIconAtlas(result.images, ICON_ATLAS_CELL, ICON_ATLAS_PADDING, atlas, error);
+        }
+        built = built && SavePNG(atlasPath, atlas.image, error);
+        double milliseconds = result.milliseconds
+            + std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        RunOnGameThread([this, ticket, built, error, failures, atlasPath, milliseconds, cell,
+            cells = std::move(result.bundleCells), bundleError = result.bundleError,
+            regions = std::move(atlas.regions), width = atlas.image.width, height = atlas.image.height]() {
+            // Superseded by ladderrank_reload_icons
+            if (iconTickets[ICON_ATLAS_KEY] != ticket) {
+                return;
+            }
+            iconTickets[ICON_ATLAS_KEY] = 0;
+
+            if (!bundleError.empty()) {
+                LOG("IconBundle.bin not used, rebuild it with IconBake: {}", bundleError);
+            }
+            if (!failures.empty()) {
+                LOG("Rank icons left out of the atlas:{}", failures);
+            }
+            bundleCells = cells;
+            if (!built) {
+                LOG("Rank icon atlas disabled, icons load one by one: {}", error);
+                displayedTiers = {};
+                LoadRankIcons();
+                return;
+            }
+
+            // The only texture upload, every icon draw is a sub-rectangle of it
+            auto upload = std::chrono::steady_clock::now();
+            rankAtlas = LoadTexture(atlasPath);
+            rankAtlasBytes = TextureBytes(*rankAtlas);
+            atlasCell = cell;
+            std::copy(regions.begin(), regions.end(), atlasRegions.begin());
+            PublishIconTextures();
+            displayDirty = true;
+
+            LOG("Rank icon atlas: {}x{} ({} pixel icons{}), built in {:.1f} ms on the loader thread, "
+                "decoded and uploaded in {:.1f} ms on the game thread",
+                width, height, cell, cells.empty() ? "" : " from IconBundle.bin", milliseconds,
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - upload).count());
+            });
+        return;
+    }
 
-    // Next rank icon (top) - always show tier +1
-    int visualUpperTier = (userTier >= 22) ? 22 : userTier + 1;
-    auto nextPath = dataFolder / (std::to_string(visualUpperTier) + ".png");
-    nextRank = std::make_shared<ImageWrapper>(nextPath, true, false);
-    LOG("Loading NEXT rank icon: {} (tier={})", nextPath.string(), visualUpperTier);
+    // A single icon, scaled to ICON_ATLAS_CELL by the loader
+    int tier = result.key;
+    std::string error = failures;
+    auto decodedPath = dataFolder / "DecodedIcons" / (std::to_string(tier) + ".png");
+    std::error_code folderError;
+    std::filesystem::create_directories(decodedPath.parent_path(), folderError);
+    bool saved = !result.images.front().Empty() && SavePNG(decodedPath, result.images.front(), error);
+
+    RunOnGameThread([this, tier, ticket, saved, error, decodedPath]() {
+        // Cancelled because the tier stopped being displayed, or superseded
+        if (iconTickets[tier] != ticket) {
+            return;
+        }
+        iconTickets[tier] = 0;
 
-    // Previous rank icon (bottom) - always show tier -1
-    int visualLowerTier = (userTier <= 1) ? 1 : userTier - 1;
-    auto beforePath = dataFolder / (std::to_string(visualLowerTier) + ".png");
-    beforeRank = std::make_shared<ImageWrapper>(beforePath, true, false);
-    LOG("Loading BEFORE rank icon: {} (tier={})", beforePath.string(), visualLowerTier);
+        if (saved) {
+            decodedIcons[tier] = decodedPath;
+        }
+        else {
+            LOG("Rank icon {} loads from its original file: {}", tier, error);
+        }
 
-    LOG("Loaded 3 rank icons: before={}, current={}, next={}",
-        visualLowerTier, userTier, visualUpperTier);
+        iconPool.Get(tier);
+        PublishIconTextures();
+        displayDirty = true;
+        });
 }
 
-// ============================================================================
-// MMR CALCULATION
-// ============================================================================
+void LadderRank::RequestRankIcon(int tier) {
+    if (tier < 0 || tier >= RANK_TIER_COUNT || iconTickets[tier] != 0) {
+        return;
+    }
+
+    if (iconPool.Loaded(tier)) {
+        iconPool.Get(tier);
+        return;
+    }
 
-int LadderRank::unranker(int mode, int rank, int div, bool upperLimit) {
-    std::string fileName = std::to_string(mode) + ".json";
-    const auto rankJSON = gameWrapper->GetDataFolder() / "LadderRank" / "RankNumbers" / fileName;
+    iconTickets[tier] = iconLoader.Submit(AssetRequest{ tier, { RankIconPath(tier) }, ICON_ATLAS_CELL });
+    if (iconTickets[tier] == 0) {
+        // Better a decode on this thread than an icon that never shows
+        LOG("Icon loader queue full, loading rank icon {} directly", tier);
+        iconPool.Get(tier);
+    }
+}
 
-    std::string limit = upperLimit ? "maxMMR" : "minMMR";
+void LadderRank::CancelRankIcon(int tier) {
+    if (tier < 0 || tier >= RANK_TIER_COUNT || iconTickets[tier] == 0) {
+        return;
+    }
 
-    std::ifstream file(rankJSON);
-    json j = json::parse(file);
+    iconLoader.Cancel(tier);
+    iconTickets[tier] = 0;
+}
 
-    return j["data"]["data"][((rank - 1) * 4) + (div + 1)][limit];
+std::filesystem::path LadderRank::RankIconPath(int tier) {
+    return gameWrapper->GetDataFolder() / "LadderRank" / "RankIcons" / (std::to_string(tier) + ".png");
 }
 
-void LadderRank::CalculateAdjacentRanks() {
-    // Calculate adjacent ranks based on division (for division thresholds)
-    if (userTier <= 0) {
-        HandlePlacementMatches();
-    }
-    else if (userTier == 1 && userDiv == 0) {
-        HandleLowestRank();
+LadderRank::ImGuiIcon LadderRank::MakeImGuiIcon(const IconTextures& textures, int tier) {
+    ImGuiIcon icon;
+    if (tier < 0 || tier >= RANK_TIER_COUNT) {
+        return icon;
     }
-    else if (userTier == 22) {
-        HandleHighestRank();
+
+    const AtlasRegion& region = textures.regions[tier];
+    if (textures.atlas && region.Valid()) {
+        icon.texture = textures.atlas;
+        icon.uv0 = ImVec2(region.u0, region.v0);
+        icon.uv1 = ImVec2(region.u1, region.v1);
+        icon.size = ImVec2(region.width * textures.atlasScale, region.height * textures.atlasScale);
+        return icon;
     }
-    else {
-        HandleNormalRank();
+
+    icon.texture = textures.icons[tier];
+    if (icon.texture) {
+        Vector2F size = icon.texture->GetSizeF();
+        icon.size = ImVec2(size.X, size.Y);
     }
+    return icon;
+}
 
-    // Calculate MMR for complete tiers (1 tier) for display
-    int nextTierForDisplay = (userTier >= 22) ? 22 : userTier + 1;
-    int prevTierForDisplay = (userTier <= 1) ? 1 : userTier - 1;
+void LadderRank::LoadRankIcons() {
+    // Current rank icon (middle), next rank icon (top) and previous rank icon (bottom)
+    DisplayedTiers tiers{ activeSnapshot->currentIcon, activeSnapshot->nextIcon, activeSnapshot->beforeIcon };
+    if (tiers == displayedTiers) {
+        iconUpdatesSkipped++;
+        return;
+    }
+    DisplayedTiers previous = displayedTiers;
+    displayedTiers = tiers;
+    iconUpdates++;
+
+    // Without an atlas, each icon is decoded by iconLoader and shows once it
+    // is resident. A decode still running for a tier that left is cancelled.
+    if (!rankAtlas && iconTickets[ICON_ATLAS_KEY] == 0) {
+        for (int tier : { previous.current, previous.next, previous.before }) {
+            if (tier != tiers.current && tier != tiers.next && tier != tiers.before) {
+                CancelRankIcon(tier);
+            }
+        }
+        for (int tier : { tiers.current, tiers.next, tiers.before }) {
+            RequestRankIcon(tier);
+        }
+        if (iconPool.Loads() != publishedIconLoads) {
+            PublishIconTextures();
+        }
+    }
 
-    // Minimum MMR of next tier (always Div I)
-    nextTierMinMMR = unranker(userPlaylist, nextTierForDisplay, 0, false);
+    imguiTiers.Store(tiers);
+    displayDirty = true;
 
-    // Minimum MMR of current tier (falling below this drops you to lower tier)
-    prevTierMaxMMR = unranker(userPlaylist, userTier, 0, false);
+    LOG("Using 3 rank icons: before={}, current={}, next={}", tiers.before, tiers.current, tiers.next);
+}
 
-    LOG("Adjacent ranks: lower={}(div {}), current={}(div {}), upper={}(div {})",
-        lowerTier, lowerDiv, userTier, userDiv, upperTier, upperDiv);
-    LOG("Division MMR thresholds: beforeUpper={}, nextLower={}", beforeUpper, nextLower);
-    LOG("Tier MMR display: currentTierMin={}, nextTierMin={}", prevTierMaxMMR, nextTierMinMMR);
+std::shared_ptr<ImageWrapper> LadderRank::LoadRankIcon(int tier) {
+    auto path = decodedIcons[tier].empty() ? RankIconPath(tier) : decodedIcons[tier];
+    LOG("Loading rank icon: {} (tier={})", path.string(), tier);
+    return LoadTexture(path);
 }
 
-void LadderRank::HandlePlacementMatches() {
-    lowerTier = 1;
-    upperTier = 22;
+std::shared_ptr<ImageWrapper> LadderRank::LoadTexture(const std::filesystem::path& path) {
+    auto start = std::chrono::steady_clock::now();
+    auto texture = std::make_shared<ImageWrapper>(path, true, true);
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 
-    nextLower = unranker(userPlaylist, upperTier, 0, true);
-    nameNext = GetDivName(22, 0);
+    textureLoads++;
+    textureLoadMilliseconds += milliseconds;
+    textureLoadMaxMilliseconds = std::max(textureLoadMaxMilliseconds, milliseconds);
+    return texture;
+}
 
-    beforeUpper = unranker(userPlaylist, lowerTier, 0, false);
-    nameBefore = GetDivName(0, 0);
+size_t LadderRank::TextureBytes(ImageWrapper& texture) {
+    Vector2 size = texture.GetSize();
+    size_t copies = (texture.IsLoadedForCanvas() ? 1 : 0) + (texture.IsLoadedForImGui() ? 1 : 0);
+    return static_cast<size_t>(size.X) * static_cast<size_t>(size.Y) * 4 * copies;
 }
 
-void LadderRank::HandleLowestRank() {
-    upperTier = userTier;
-    lowerTier = userTier;
-    upperDiv = userDiv + 1;
-    lowerDiv = 0;
+void LadderRank::PublishIconTextures() {
+    auto textures = std::make_shared<IconTextures>();
+    textures->atlas = rankAtlas;
+    textures->regions = atlasRegions;
+    textures->atlasScale = static_cast<float>(ICON_ATLAS_CELL) / atlasCell;
+    for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+        textures->icons[tier] = iconPool.Peek(tier);
+    }
+    imguiTextures.store(std::move(textures));
+    publishedIconLoads = iconPool.Loads();
+}
 
-    nextLower = unranker(userPlaylist, upperTier, upperDiv, false);
-    nameNext = GetDivName(upperTier, upperDiv);
+void LadderRank::ReloadRankIcons() {
+    // Textures still held by Render() or the display list are freed once released
+    iconLoader.CancelAll();
+    iconTickets = {};
+    iconPool.Invalidate();
+    decodedIcons = {};
+    rankAtlas.reset();
+    rankAtlasBytes = 0;
+    atlasRegions = {};
+    PublishIconTextures();
+    displayDirty = true;
+
+    // Same tiers, new textures: the icons show again once decoded
+    RequestRankAtlas();
+    displayedTiers = {};
+    LoadRankIcons();
 
-    beforeUpper = unranker(userPlaylist, lowerTier, lowerDiv, false);
-    nameBefore = GetDivName(lowerTier, lowerDiv);
+    LOG("Rank icons reloading in the background");
 }
 
-void LadderRank::HandleHighestRank() {
-    upperTier = userTier;
-    lowerTier = userTier - 1;
-    upperDiv = 0;
-    lowerDiv = 3;
+// ============================================================================
+// RANK SNAPSHOTS
+// ============================================================================
+
+int LadderRank::CaptureMMR(MMRWrapper& mmrWrapper) {
+    std::vector<MMRSample> samples;
+    for (int slot = 0; slot < RANK_PLAYLIST_COUNT; slot++) {
+        int playlist = RankTable::rankedPlaylists[slot];
+        if (!mmrWrapper.IsSynced(uniqueID, playlist)) {
+            continue;
+        }
+
+        SkillRank rank = mmrWrapper.GetPlayerRank(uniqueID, playlist);
+        MMRSample sample{ playlist, mmrWrapper.GetPlayerMMR(uniqueID, playlist), rank.Tier, rank.Division };
+
+        // Unchanged playlists are not submitted again
+        if (capturedMMR[slot] && capturedMMR[slot]->SameReading(sample)) {
+            continue;
+        }
+
+        MMRTrend& trend = mmrTrends[slot];
+        trend.Update(sample.mmr);
+        sample.mmrGain = trend.gain;
+        sample.mmrLoss = trend.loss;
+
+        capturedMMR[slot] = sample;
+        samples.push_back(sample);
+        sessionStats.RecordMMR(playlist, sample.mmr);
+        displayDirty = true;
+
+        // The first change after a match is the reading that match produced
+        MatchOutcome outcome = MatchOutcome::None;
+        if (playlist == matchPlaylist) {
+            outcome = std::exchange(matchOutcome, MatchOutcome::None);
+        }
+        if (mmrHistory.IsOpen()) {
+            mmrHistory.Append(MakeHistoryRecord(HistoryTimestampNow(), playlist, sample.mmr,
+                sample.tier, sample.division, outcome));
+        }
+    }
 
-    nextLower = unranker(userPlaylist, userTier, 0, true);
-    nameNext = GetDivName(userTier, 0);
+    if (!samples.empty()) {
+        snapshotWorker.Submit(samples);
+        PublishSessionText();
+    }
+    return static_cast<int>(samples.size());
+}
 
-    beforeUpper = unranker(userPlaylist, lowerTier, lowerDiv, true);
-    nameBefore = GetDivName(lowerTier, lowerDiv);
+void LadderRank::PublishSessionText() {
+    SessionText session;
+    snprintf(session.text, sizeof(session.text), "%s", FormatSession(sessionStats.Read(userPlaylist)).c_str());
+    imguiSession.Store(session);
 }
 
-void LadderRank::HandleNormalRank() {
-    if (userDiv == 0) {
-        // First division of a rank
-        upperTier = userTier;
-        lowerTier = userTier - 1;
-        upperDiv = userDiv + 1;
-        lowerDiv = 3;
+std::optional<MMRSample> LadderRank::CapturedSample(int playlist) const {
+    int slot = RankTable::PlaylistSlot(playlist);
+    if (slot < 0) {
+        return std::nullopt;
     }
-    else if (userDiv == 3) {
-        // Last division of a rank
-        upperTier = userTier + 1;
-        lowerTier = userTier;
-        upperDiv = 0;
-        lowerDiv = userDiv - 1;
+    return capturedMMR[slot];
+}
+
+bool LadderRank::SelectSnapshot(int playlist) {
+    std::shared_ptr<const RankSnapshot> snapshot = snapshotWorker.Current()->Find(playlist);
+    if (!snapshot) {
+        return false;
     }
-    else {
-        // Middle divisions
-        upperTier = userTier;
-        lowerTier = userTier;
-        upperDiv = userDiv + 1;
-        lowerDiv = userDiv - 1;
+
+    if (snapshot == activeSnapshot) {
+        return true;
     }
 
-    nextLower = unranker(userPlaylist, upperTier, upperDiv, false);
-    nameNext = GetDivName(upperTier, upperDiv);
+    if (snapshot->rankFromMMR) {
+        LOG("Invalid rank {}/{} reported for playlist {}, using local lookup {}/{}",
+            snapshot->reportedTier, snapshot->reportedDivision, playlist, snapshot->tier, snapshot->division);
+    }
+    LOG("Playlist {} snapshot: lower={}(div {}), current={}(div {}), upper={}(div {}), tier MMR {}-{}",
+        playlist, snapshot->lowerTier, snapshot->lowerDiv, snapshot->tier, snapshot->division,
+        snapshot->upperTier, snapshot->upperDiv, snapshot->prevTierMaxMMR, snapshot->nextTierMinMMR);
 
-    beforeUpper = unranker(userPlaylist, lowerTier, lowerDiv, true);
-    nameBefore = GetDivName(lowerTier, lowerDiv);
+    activeSnapshot = std::move(snapshot);
+    LoadRankIcons();
+    displayDirty = true;
+    return true;
 }
 
 // ============================================================================
@@ -336,22 +904,102 @@ void LadderRank::RenderCanvas(CanvasWrapper canvas) {
         return;
     }
 
+    LADDERRANK_PERF_SCOPE(Perf(PerfProbe::RenderCanvas));
+
+    // One call per frame catches resolution and window mode changes
+    Vector2 canvasSize = canvas.GetSize();
+    if (canvasSize.X != screenSize.X || canvasSize.Y != screenSize.Y) {
+        OnScreenSizeChanged(canvasSize);
+    }
+
+    // Record the canvas calls again only when something they depend on changed
+    if (displayDirty.exchange(false)) {
+        UpdateIconBucket();
+        BuildDisplayList();
+    }
+    ReplayDisplayList(canvas);
+
+    // First frame with the post-match MMR, measure how long the update took
+    if (timingFirstFrame && activeSnapshot->mmr == matchMMR) {
+        timingFirstFrame = false;
+        lastUpdateMilliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - matchEndTime).count();
+        LOG("New MMR on screen {:.0f} ms after the match ended (via {})", lastUpdateMilliseconds, matchMMRSource);
+    }
+}
+
+void LadderRank::OnScreenSizeChanged(Vector2 size) {
+    LOG("Screen size changed: {}x{} -> {}x{}", screenSize.X, screenSize.Y, size.X, size.Y);
+    screenSize = size;
+    resolutionChanges++;
+    displayDirty = true;
+
+    // Switch to the layout saved for this resolution, if any
+    if (const LayoutConfig* saved = savedLayouts.Find(size.X, size.Y)) {
+        ApplyLayout(*saved);
+        LOG("Using the layout saved for {}x{}", size.X, size.Y);
+    }
+}
+
+void LadderRank::ApplyLayout(const LayoutConfig& saved) {
+    for (const LayoutField& field : LayoutFields()) {
+        // Take effect this frame, the cvars follow so the settings window
+        // and config.cfg agree
+        layout.*field.field = saved.*field.field;
+        cvarManager->getCvar("LadderRank_" + std::string(field.name)).setValue(saved.*field.field);
+    }
+    displayDirty = true;
+}
+
+void LadderRank::ReplayDisplayList(CanvasWrapper& canvas) {
+    for (const DrawCommand& command : displayList.Commands()) {
+        switch (command.op) {
+        case DrawOp::SetColor:
+            canvas.SetColor(static_cast<char>(command.r), static_cast<char>(command.g),
+                static_cast<char>(command.b), static_cast<char>(command.a));
+            break;
+        case DrawOp::FillBox:
+            canvas.SetPosition(Vector2{ command.x, command.y });
+            canvas.FillBox(Vector2{ command.width, command.height });
+            break;
+        case DrawOp::DrawString:
+            canvas.SetPosition(Vector2{ command.x, command.y });
+            canvas.DrawString(displayList.String(command.resource), command.scale, command.scale);
+            break;
+        case DrawOp::DrawTexture:
+            canvas.SetPosition(Vector2{ command.x, command.y });
+            canvas.DrawTexture(displayTextures[command.resource].get(), command.scale);
+            break;
+        case DrawOp::DrawTile:
+            canvas.SetPosition(Vector2{ command.x, command.y });
+            canvas.DrawTile(displayTextures[command.resource].get(), static_cast<float>(command.width),
+                static_cast<float>(command.height), command.u, command.v, command.ul, command.vl,
+                LinearColor{ 1.0f, 1.0f, 1.0f, 1.0f }, 1, 2);  // Clipped, translucent blend
+            break;
+        }
+    }
+}
+
+void LadderRank::BuildDisplayList() {
+    displayList.Clear();
+    displayTextures.clear();
+    displayBuilds++;
+
+    // The atlas is always texture 0
+    if (rankAtlas) {
+        displayTextures.push_back(rankAtlas);
+    }
+
     // Calculate scaling factors
     float xPercent = static_cast<float>(screenSize.X) / 1920.0f;
     float yPercent = static_cast<float>(screenSize.Y) / 1080.0f;
 
     // Get layout parameters
-    float offsetX = cvarManager->getCvar("LadderRank_offset_x").getFloatValue() * xPercent;
-    float offsetY = cvarManager->getCvar("LadderRank_offset_y").getFloatValue() * yPercent;
-    float rectWidth = cvarManager->getCvar("LadderRank_rect_width").getFloatValue();
-    float rectHeight = cvarManager->getCvar("LadderRank_rect_height").getFloatValue();
-    float leftMargin = cvarManager->getCvar("LadderRank_left_margin").getFloatValue();
-    float imgSize = cvarManager->getCvar("LadderRank_icon_size").getFloatValue() * yPercent;
-    float rightIconOffset = cvarManager->getCvar("LadderRank_right_icon_offset").getFloatValue();
-    float textOffset = cvarManager->getCvar("LadderRank_text_offset").getFloatValue();
-    float topSpacing = cvarManager->getCvar("LadderRank_top_spacing").getFloatValue();
-    float middleSpacing = cvarManager->getCvar("LadderRank_middle_spacing").getFloatValue();
-    float bottomSpacing = cvarManager->getCvar("LadderRank_bottom_spacing").getFloatValue();
+    float offsetX = layout.offsetX * xPercent;
+    float offsetY = layout.offsetY * yPercent;
+    float rectWidth = layout.rectWidth;
+    float rectHeight = layout.rectHeight;
+    float imgSize = layout.iconSize * yPercent;
 
     // Calculate rectangle position
     float rectLeft = ((screenSize.X - (rectWidth * xPercent)) / 2) + offsetX;
@@ -360,19 +1008,46 @@ void LadderRank::RenderCanvas(CanvasWrapper canvas) {
     float rectBottom = rectTop + (rectHeight * yPercent);
 
     // Draw background rectangle
-    canvas.SetColor(0, 0, 0, opacity);
-    canvas.SetPosition(Vector2{ static_cast<int>(rectLeft), static_cast<int>(rectTop) });
-    canvas.FillBox(Vector2{ static_cast<int>(rectRight - rectLeft), static_cast<int>(rectBottom - rectTop) });
+    displayList.SetColor(0, 0, 0, static_cast<uint8_t>(layout.opacity));
+    displayList.FillBox(static_cast<int>(rectLeft), static_cast<int>(rectTop),
+        static_cast<int>(rectRight - rectLeft), static_cast<int>(rectBottom - rectTop));
 
     // Draw left side (current rank info)
-    RenderLeftSide(canvas, rectLeft, rectTop, rectBottom, leftMargin, xPercent, yPercent);
+    BuildLeftSide(rectLeft, rectTop, rectBottom, layout.leftMargin, xPercent, yPercent);
 
     // Draw right side (rank progression)
-    RenderRightSide(canvas, rectRight, rectTop, rectBottom, rightIconOffset, textOffset,
-        imgSize, topSpacing, middleSpacing, bottomSpacing, xPercent, yPercent);
+    BuildRightSide(rectRight, rectTop, rectBottom, layout.rightIconOffset, layout.textOffset,
+        imgSize, layout.topSpacing, layout.middleSpacing, layout.bottomSpacing, xPercent, yPercent);
+
+    // Draw the other players of the match
+    if (!lobbyRanks.empty() && layout.lobbyRanks) {
+        BuildLobbyRanks(rectLeft, rectBottom, xPercent, yPercent);
+    }
 }
 
-void LadderRank::RenderLeftSide(CanvasWrapper& canvas, float rectLeft, float rectTop,
+void LadderRank::BuildIcon(int tier, float x, float y, float size) {
+    // Sub-rectangle of the atlas, scaled to the requested height
+    const AtlasRegion& region = atlasRegions[tier];
+    if (rankAtlas && region.Valid()) {
+        float width = size * region.width / region.height;
+        displayList.DrawTile(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width), static_cast<int>(size), 0,
+            static_cast<float>(region.x), static_cast<float>(region.y),
+            static_cast<float>(region.width), static_cast<float>(region.height));
+        return;
+    }
+
+    // Only resident icons, the others are still decoding or missing from the data folder
+    auto icon = iconPool.Peek(tier);
+    if (!icon || !icon->IsLoadedForCanvas()) {
+        return;
+    }
+
+    displayTextures.push_back(icon);
+    displayList.DrawTexture(static_cast<int>(x), static_cast<int>(y),
+        static_cast<uint32_t>(displayTextures.size() - 1), size / icon->GetSize().Y);
+}
+
+void LadderRank::BuildLeftSide(float rectLeft, float rectTop,
     float rectBottom, float leftMargin, float xPercent, float yPercent) {
     if (!rankAverage2) {
         return;
@@ -381,27 +1056,41 @@ void LadderRank::RenderLeftSide(CanvasWrapper& canvas, float rectLeft, float rec
     float textLeftX = rectLeft + (leftMargin * xPercent);
     float centerY = (rectTop + rectBottom) / 2;
 
-    canvas.SetColor(255, 255, 255, 255);
+    displayList.SetColor(255, 255, 255, 255);
 
     // Draw "Rank :" label and current rank icon
-    canvas.SetPosition(Vector2{ static_cast<int>(textLeftX), static_cast<int>(centerY - (30 * yPercent)) });
-    canvas.DrawString("Rank :", 2.0f, 2.0f);
+    displayList.DrawString(static_cast<int>(textLeftX), static_cast<int>(centerY - (30 * yPercent)), "Rank :", 2.0f);
+    BuildIcon(activeSnapshot->currentIcon, textLeftX + 100 * xPercent, centerY - (30 * yPercent) - 5, 40.0f * yPercent);
 
-    if (currentRank->IsLoadedForCanvas()) {
-        float iconSize = 40.0f * yPercent;
-        float iconX = textLeftX + 100 * xPercent;
-        float iconY = centerY - (30 * yPercent) - 5;
-        canvas.SetPosition(Vector2{ static_cast<int>(iconX), static_cast<int>(iconY) });
-        canvas.DrawTexture(currentRank.get(), iconSize / currentRank->GetSize().Y);
+    // Draw "MMR :" label and current MMR value
+    std::string mmrText = "MMR : " + std::to_string(static_cast<int>(activeSnapshot->mmr));
+    displayList.DrawString(static_cast<int>(textLeftX), static_cast<int>(centerY + (10 * yPercent)), mmrText, 2.0f);
+
+    // Optional lines below the MMR, each one only when it has something to show
+    float lineY = centerY + (50 * yPercent);
+
+    // Population share, only when the RankNumbers files carry player counts
+    if (activeSnapshot->topPercent >= 0.0f) {
+        char topText[32];
+        snprintf(topText, sizeof(topText), "Top %.1f%%", activeSnapshot->topPercent);
+        displayList.DrawString(static_cast<int>(textLeftX), static_cast<int>(lineY), topText, 1.5f);
+        lineY += 30 * yPercent;
     }
 
-    // Draw "MMR :" label and current MMR value
-    canvas.SetPosition(Vector2{ static_cast<int>(textLeftX), static_cast<int>(centerY + (10 * yPercent)) });
-    std::string mmrText = "MMR : " + std::to_string(static_cast<int>(userMMR));
-    canvas.DrawString(mmrText, 2.0f, 2.0f);
+    // Session results
+    std::string sessionText = FormatSession(sessionStats.Read(activeSnapshot->playlist));
+    if (!sessionText.empty()) {
+        displayList.DrawString(static_cast<int>(textLeftX), static_cast<int>(lineY), sessionText, 1.5f);
+        lineY += 30 * yPercent;
+    }
+
+    // Matches to the next and previous division, computed with the snapshot
+    if (!activeSnapshot->projectionText.empty()) {
+        displayList.DrawString(static_cast<int>(textLeftX), static_cast<int>(lineY), activeSnapshot->projectionText, 1.5f);
+    }
 }
 
-void LadderRank::RenderRightSide(CanvasWrapper& canvas, float rectRight, float rectTop,
+void LadderRank::BuildRightSide(float rectRight, float rectTop,
     float rectBottom, float rightIconOffset, float textOffset,
     float imgSize, float topSpacing, float middleSpacing,
     float bottomSpacing, float xPercent, float yPercent) {
@@ -409,51 +1098,72 @@ void LadderRank::RenderRightSide(CanvasWrapper& canvas, float rectRight, float r
     float iconsCenterY = (rectTop + rectBottom) / 2;
     float textRightX = iconsRightX - (textOffset * xPercent);
 
-    canvas.SetColor(255, 255, 255, 255);
+    displayList.SetColor(255, 255, 255, 255);
 
     // Render next rank (top)
     if (rankNext) {
-        RenderRankEntry(canvas, textRightX, iconsRightX, iconsCenterY - (topSpacing * yPercent),
-            iconsCenterY - ((topSpacing - 20) * yPercent), nextTierMinMMR,
-            nextRank, imgSize, xPercent, yPercent);
+        BuildRankEntry(textRightX, iconsRightX, iconsCenterY - (topSpacing * yPercent),
+            iconsCenterY - ((topSpacing - 20) * yPercent), activeSnapshot->nextTierMinMMR,
+            activeSnapshot->nextIcon, imgSize, xPercent, yPercent);
     }
 
     // Render current rank (middle)
     if (rankAverage) {
-        RenderRankEntry(canvas, textRightX, iconsRightX, iconsCenterY - (middleSpacing * yPercent),
-            iconsCenterY - (10 * yPercent), static_cast<int>(userMMR),
-            currentRank, imgSize, xPercent, yPercent);
+        BuildRankEntry(textRightX, iconsRightX, iconsCenterY - (middleSpacing * yPercent),
+            iconsCenterY - (10 * yPercent), static_cast<int>(activeSnapshot->mmr),
+            activeSnapshot->currentIcon, imgSize, xPercent, yPercent);
     }
 
     // Render previous rank (bottom)
     if (rankUnder) {
-        RenderRankEntry(canvas, textRightX, iconsRightX, iconsCenterY + (40 * yPercent),
-            iconsCenterY + (bottomSpacing * yPercent), prevTierMaxMMR,
-            beforeRank, imgSize, xPercent, yPercent);
+        BuildRankEntry(textRightX, iconsRightX, iconsCenterY + (40 * yPercent),
+            iconsCenterY + (bottomSpacing * yPercent), activeSnapshot->prevTierMaxMMR,
+            activeSnapshot->beforeIcon, imgSize, xPercent, yPercent);
+    }
+}
+
+void LadderRank::BuildLobbyRanks(float rectLeft, float rectBottom, float xPercent, float yPercent) {
+    float iconSize = 24.0f * yPercent;
+    float lineY = rectBottom + (10 * yPercent);
+
+    for (const LobbyRank& rank : lobbyRanks) {
+        // Blue and orange team colors
+        if (rank.player.team == 0) {
+            displayList.SetColor(90, 160, 255, 255);
+        }
+        else {
+            displayList.SetColor(255, 160, 60, 255);
+        }
+
+        std::string line = rank.player.name;
+        if (rank.known) {
+            BuildIcon(rank.position.tier, rectLeft, lineY, iconSize);
+            line += "  " + std::to_string(static_cast<int>(rank.mmr)) + "  "
+                + GetDivName(rank.position.tier, rank.position.division);
+        }
+        else {
+            line += "  ...";
+        }
+
+        displayList.DrawString(static_cast<int>(rectLeft + iconSize + (8 * xPercent)), static_cast<int>(lineY), line, 1.5f);
+        lineY += 28 * yPercent;
     }
 }
 
-void LadderRank::RenderRankEntry(CanvasWrapper& canvas, float textX, float iconX,
+void LadderRank::BuildRankEntry(float textX, float iconX,
     float textY, float iconY, int mmrValue,
-    std::shared_ptr<ImageWrapper> rankIcon,
-    float imgSize, float xPercent, float yPercent) {
+    int rankTier, float imgSize, float xPercent, float yPercent) {
     // Draw MMR label
-    canvas.SetPosition(Vector2{ static_cast<int>(textX), static_cast<int>(textY) });
-    canvas.DrawString("MMR :", 1.5f, 1.5f);
+    displayList.DrawString(static_cast<int>(textX), static_cast<int>(textY), "MMR :", 1.5f);
 
     // Draw MMR value
-    canvas.SetPosition(Vector2{ static_cast<int>(textX + 80 * xPercent), static_cast<int>(textY) });
-    canvas.DrawString(std::to_string(mmrValue), 1.5f, 1.5f);
+    displayList.DrawString(static_cast<int>(textX + 80 * xPercent), static_cast<int>(textY), std::to_string(mmrValue), 1.5f);
 
     // Draw Rank label
-    canvas.SetPosition(Vector2{ static_cast<int>(textX), static_cast<int>(textY + 30 * yPercent) });
-    canvas.DrawString("Rank :", 1.5f, 1.5f);
+    displayList.DrawString(static_cast<int>(textX), static_cast<int>(textY + 30 * yPercent), "Rank :", 1.5f);
 
     // Draw rank icon
-    if (rankIcon->IsLoadedForCanvas()) {
-        canvas.SetPosition(Vector2{ static_cast<int>(iconX), static_cast<int>(iconY) });
-        canvas.DrawTexture(rankIcon.get(), imgSize / rankIcon->GetSize().Y);
-    }
+    BuildIcon(rankTier, iconX, iconY, imgSize);
 }
 
 // ============================================================================
@@ -465,18 +1175,16 @@ void LadderRank::CheckMMR(int retryCount) {
         return;
     }
 
-    if (userPlaylist == 0) {
+    if (matchPlaylist == 0) {
         return;
     }
 
-    gameWrapper->SetTimeout([retryCount, this](GameWrapper* gw) {
-        TryGetMMRData(retryCount);
-        }, 3.0f);
+    // First check after 3 seconds, then every 0.5 seconds
+    refreshScheduler->Request(matchPlaylist, 3.0f, retryCount + 1, 0.5f);
 }
 
 bool LadderRank::IsValidGameState(int retryCount) {
-    isEnabled = cvarManager->getCvar("LadderRank_enabled").getBoolValue();
-    if (!isEnabled) {
+    if (!layout.enabled) {
         return false;
     }
 
@@ -492,43 +1200,172 @@ bool LadderRank::IsValidGameState(int retryCount) {
     return true;
 }
 
-void LadderRank::TryGetMMRData(int retryCount) {
+bool LadderRank::RefreshPlaylist(int playlist) {
+    LADDERRANK_PERF_SCOPE(Perf(PerfProbe::MMRUpdate));
+
     MMRWrapper mmrWrapper = gameWrapper->GetMMRWrapper();
 
-    if (mmrWrapper.IsSynced(uniqueID, userPlaylist) && !mmrWrapper.IsSyncing(uniqueID)) {
-        if (!IsRankedPlaylist(userPlaylist)) {
-            LOG("Not a ranked playlist: {}", userPlaylist);
-            return;
+    // Check sync status
+    bool isSynced = mmrWrapper.IsSynced(uniqueID, playlist);
+    bool isSyncing = mmrWrapper.IsSyncing(uniqueID);
+    if (!isSynced || isSyncing) {
+        LOG("Playlist {} not synced yet (IsSynced: {}, IsSyncing: {})", playlist, isSynced, isSyncing);
+        return false;
+    }
+
+    if (!IsRankedPlaylist(playlist)) {
+        LOG("Not a ranked playlist: {}", playlist);
+        return true;
+    }
+
+    std::optional<MMRSample> previous = CapturedSample(playlist);
+    FetchPlayerRankData(mmrWrapper);
+    std::optional<MMRSample> captured = CapturedSample(playlist);
+    if (captured) {
+        LOG("Captured playlist {} rank data: Tier={}, Div={}, MMR={}",
+            playlist, captured->tier, captured->division, captured->mmr);
+    }
+
+    // After a match, keep retrying until the new MMR is in
+    if (awaitingMatchMMR && playlist == matchPlaylist) {
+        if (captured == previous) {
+            return false;
         }
+        ShowMatchMMR(false);
+    }
+    return true;
+}
 
-        FetchPlayerRankData(mmrWrapper);
-        LoadRankIcons();
+bool LadderRank::ResolveLobby() {
+    ServerWrapper server = gameWrapper->GetOnlineGame();
+    if (server.IsNull() || !layout.lobbyRanks) {
+        return true;
+    }
+
+    GameSettingPlaylistWrapper playlistWrapper = server.GetPlaylist();
+    int playlist = playlistWrapper.IsNull() ? 0 : playlistWrapper.GetPlaylistId();
+    if (!IsRankedPlaylist(playlist)) {
+        return true;
+    }
+
+    // Collect the whole lobby first, then look it up in one batch
+    std::vector<LobbyPlayer> players;
+    std::unordered_map<std::string, UniqueIDWrapper> ids;
+    ArrayWrapper<PriWrapper> pris = server.GetPRIs();
+    for (int i = 0; i < pris.Count(); i++) {
+        PriWrapper pri = pris.Get(i);
+        if (pri.IsNull()) {
+            continue;
+        }
 
-        drawCanvas = true;
-        gotNewMMR = true;
+        UniqueIDWrapper id = pri.GetUniqueIdWrapper();
+        LobbyPlayer player{ id.GetIdString(), pri.GetPlayerName().ToString(), pri.GetTeamNum() };
+        ids.emplace(player.id, id);
+        players.push_back(std::move(player));
     }
-    else if (retryCount > 0) {
-        gameWrapper->SetTimeout([retryCount, this](GameWrapper* gw) {
-            this->CheckMMR(retryCount - 1);
-            }, 0.5f);
+
+    MMRWrapper mmrWrapper = gameWrapper->GetMMRWrapper();
+    auto start = std::chrono::steady_clock::now();
+    uint64_t hitsBefore = lobbyCache.Hits();
+    {
+        RankTableStore::ReadGuard thresholds = rankStore.Read();
+        lobbyRanks = lobbyCache.Resolve(players, playlist, *thresholds,
+            [&mmrWrapper, &ids](const LobbyPlayer& player, int playlist, float& mmr) {
+                const UniqueIDWrapper& id = ids.at(player.id);
+                if (!mmrWrapper.IsSynced(id, playlist)) {
+                    return false;
+                }
+                mmr = mmrWrapper.GetPlayerMMR(id, playlist);
+                return true;
+            });
     }
+    displayDirty = true;
+    double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    size_t known = std::count_if(lobbyRanks.begin(), lobbyRanks.end(), [](const LobbyRank& rank) { return rank.known; });
+    LOG("Lobby ranks: {} of {} players resolved in {:.1f} us, {} from the cache",
+        known, lobbyRanks.size(), microseconds, lobbyCache.Hits() - hitsBefore);
+
+    // Players MMRWrapper has not synced yet are tried again
+    lobbyResolved = known == lobbyRanks.size();
+    return lobbyResolved;
 }
 
 bool LadderRank::IsRankedPlaylist(int playlist) {
-    return std::find(std::begin(rankedPlaylists), std::end(rankedPlaylists), playlist)
-        != std::end(rankedPlaylists);
+    return RankTable::PlaylistSlot(playlist) >= 0;
 }
 
 void LadderRank::FetchPlayerRankData(MMRWrapper& mmrWrapper) {
-    userMMR = mmrWrapper.GetPlayerMMR(uniqueID, userPlaylist);
+    int changed = CaptureMMR(mmrWrapper);
+    LOG("MMR changed in {} of {} playlists", changed, RANK_PLAYLIST_COUNT);
 
-    SkillRank userRank = mmrWrapper.GetPlayerRank(uniqueID, userPlaylist);
-    userDiv = userRank.Division;
-    userTier = userRank.Tier;
+    // The worker selects the rebuilt snapshots once they are published
+    if (!SelectSnapshot(userPlaylist)) {
+        LOG("No rank data for playlist {} yet", userPlaylist);
+    }
+}
 
-    nameCurrent = GetDivName(userTier, userDiv);
+MatchOutcome LadderRank::GetMatchOutcome() {
+    ServerWrapper server = gameWrapper->GetOnlineGame();
+    if (server.IsNull()) {
+        return MatchOutcome::None;
+    }
 
-    CalculateAdjacentRanks();
+    TeamWrapper winner = server.GetMatchWinner();
+    PlayerControllerWrapper controller = gameWrapper->GetPlayerController();
+    if (winner.IsNull() || controller.IsNull()) {
+        return MatchOutcome::None;
+    }
+
+    PriWrapper pri = controller.GetPRI();
+    if (pri.IsNull()) {
+        return MatchOutcome::None;
+    }
+
+    return (winner.GetTeamNum() == pri.GetTeamNum()) ? MatchOutcome::Win : MatchOutcome::Loss;
+}
+
+void LadderRank::OnMMRChanged(UniqueIDWrapper id) {
+    LADDERRANK_PERF_SCOPE(Perf(PerfProbe::MMRUpdate));
+
+    if (id.GetIdString() != uniqueID.GetIdString()) {
+        return;
+    }
+
+    // Another notification follows once the sync completes
+    MMRWrapper mmrWrapper = gameWrapper->GetMMRWrapper();
+    if (mmrWrapper.IsSyncing(uniqueID)) {
+        return;
+    }
+
+    std::optional<MMRSample> previous = CapturedSample(matchPlaylist);
+    if (CaptureMMR(mmrWrapper) == 0) {
+        return;
+    }
+
+    std::optional<MMRSample> captured = CapturedSample(matchPlaylist);
+    if (captured) {
+        LOG("MMR notifier: playlist {} now at {}", matchPlaylist, captured->mmr);
+    }
+
+    if (awaitingMatchMMR && captured != previous) {
+        ShowMatchMMR(true);
+    }
+}
+
+void LadderRank::ShowMatchMMR(bool fromNotifier) {
+    if (!awaitingMatchMMR) {
+        return;
+    }
+
+    awaitingMatchMMR = false;
+    timingFirstFrame = true;
+    matchMMR = CapturedSample(matchPlaylist).value_or(MMRSample{}).mmr;
+    matchMMRSource = fromNotifier ? "notifier" : "polling";
+    (fromNotifier ? notifierUpdates : pollUpdates)++;
+
+    drawCanvas = true;
+    gotNewMMR = true;
 }
 
 // ============================================================================
@@ -536,25 +1373,46 @@ void LadderRank::FetchPlayerRankData(MMRWrapper& mmrWrapper) {
 // ============================================================================
 
 void LadderRank::StatsScreen(std::string eventName) {
-    isEnabled = cvarManager->getCvar("LadderRank_enabled").getBoolValue();
-    if (!isEnabled) {
+    if (!layout.enabled) {
         return;
     }
 
     MMRWrapper mw = gameWrapper->GetMMRWrapper();
     uniqueID = gameWrapper->GetUniqueID();
     userPlaylist = mw.GetCurrentPlaylist();
-    screenSize = gameWrapper->GetScreenSize();
     isFriendOpen = false;
+    displayDirty = true;
 
     if (mw.IsRanked(userPlaylist)) {
+        // The MMR notifier normally delivers first, CheckMMR() is the fallback
+        matchEndTime = std::chrono::steady_clock::now();
+        awaitingMatchMMR = true;
+        matchPlaylist = userPlaylist;
+        matchOutcome = GetMatchOutcome();
+        sessionStats.RecordMatch(userPlaylist, matchOutcome);
         CheckMMR(5);
     }
+    PublishSessionText();
+}
+
+void LadderRank::OnCountdown(std::string eventName) {
+    // Runs before every kickoff, the lobby is only looked up until it is complete
+    if (lobbyResolved || !layout.lobbyRanks) {
+        return;
+    }
+
+    refreshScheduler->Request(LOBBY_REFRESH_KEY, 0.5f, 10, 3.0f);
 }
 
 void LadderRank::loadMenu(std::string eventName) {
     drawCanvas = false;
     isFriendOpen = false;
+
+    // The next match starts with an empty lobby, the cache is kept
+    refreshScheduler->Cancel(LOBBY_REFRESH_KEY);
+    lobbyRanks.clear();
+    lobbyResolved = false;
+    displayDirty = true;
 }
 
 // ============================================================================
@@ -564,11 +1422,26 @@ void LadderRank::loadMenu(std::string eventName) {
 void LadderRank::RenderSettings() {
     ImGui::TextUnformatted("Rocket League Rank Viewer");
 
-    ImGui::Checkbox("Enable Display", &shouldDraw);
-    ImGui::Checkbox("Show Next Rank", &rankNext);
-    ImGui::Checkbox("Show Previous Rank", &rankUnder);
-    ImGui::Checkbox("Show Current Rank (Right)", &rankAverage);
-    ImGui::Checkbox("Show Current Rank (Left)", &rankAverage2);
+    // The game thread reads the flags, ImGui edits a local copy of each
+    auto checkbox = [](const char* label, std::atomic<bool>& flag) {
+        bool value = flag.load();
+        if (!ImGui::Checkbox(label, &value)) {
+            return false;
+        }
+        flag.store(value);
+        return true;
+    };
+
+    checkbox("Enable Display", shouldDraw);
+
+    // Any change re-records the canvas calls
+    bool toggled = checkbox("Show Next Rank", rankNext);
+    toggled |= checkbox("Show Previous Rank", rankUnder);
+    toggled |= checkbox("Show Current Rank (Right)", rankAverage);
+    toggled |= checkbox("Show Current Rank (Left)", rankAverage2);
+    if (toggled) {
+        displayDirty = true;
+    }
 
     ImGui::Separator();
     RenderPlaylistSelector();
@@ -591,10 +1464,25 @@ void LadderRank::RenderSettings() {
     ImGui::Separator();
     RenderCustomizationSettings();
 
+#if LADDERRANK_PERF
+    ImGui::Separator();
+    RenderPerformanceSettings();
+#endif
+
     ImGui::Separator();
     if (ImGui::Button("Reset to Default")) {
         ResetToDefaults();
     }
+    ImGui::SameLine();
+    if (ImGui::Button("Save Layout For This Resolution")) {
+        // Saved layouts belong to the game thread
+        RunOnGameThread([this]() {
+            cvarManager->executeCommand("ladderrank_layout_save");
+            });
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Switch back to this layout whenever the game runs at this resolution");
+    }
 }
 
 void LadderRank::RenderPlaylistSelector() {
@@ -620,10 +1508,17 @@ void LadderRank::RenderPlaylistSelector() {
     }
 
     if (ImGui::Combo("Playlist", &currentIndex, playlistNames, 8)) {
-        playlistCvar.setValue(playlistValues[currentIndex]);
-        gameWrapper->SetTimeout([this](GameWrapper* gw) {
-            LoadDefaultRankData();
-            }, 0.1f);
+        int playlist = playlistValues[currentIndex];
+        playlistCvar.setValue(playlist);
+
+        // Snapshots were computed at the last sync, switching is a pointer swap
+        RunOnGameThread([this, playlist]() {
+            userPlaylist = playlist;
+            PublishSessionText();
+            if (!SelectSnapshot(playlist)) {
+                LoadDefaultRankData();
+            }
+            });
     }
 
     if (ImGui::IsItemHovered()) {
@@ -777,7 +1672,7 @@ void LadderRank::RenderCustomizationSettings() {
 
     CVarWrapper opacityCvar = cvarManager->getCvar("LadderRank_opacity");
     if (opacityCvar) {
-        opacity = opacityCvar.getFloatValue();
+        float opacity = opacityCvar.getFloatValue();
         if (ImGui::SliderFloat("Opacity", &opacity, 0.0f, 255.0f)) {
             opacityCvar.setValue(opacity);
         }
@@ -785,7 +1680,48 @@ void LadderRank::RenderCustomizationSettings() {
             ImGui::SetTooltip("Background opacity (0 = transparent, 255 = opaque)");
         }
     }
+
+    CVarWrapper lobbyRanksCvar = cvarManager->getCvar("LadderRank_lobby_ranks");
+    if (lobbyRanksCvar) {
+        bool lobbyRanksEnabled = lobbyRanksCvar.getBoolValue();
+        if (ImGui::Checkbox("Show Lobby Ranks", &lobbyRanksEnabled)) {
+            lobbyRanksCvar.setValue(lobbyRanksEnabled);
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Show the MMR and rank of every player in the match below the display");
+        }
+    }
+}
+
+#if LADDERRANK_PERF
+void LadderRank::RenderPerformanceSettings() {
+    ImGui::TextUnformatted("Performance");
+
+    // The rings are lock-free, reading them here never waits on the game thread
+    for (size_t probe = 0; probe < PERF_PROBE_COUNT; probe++) {
+        perfRings[probe].Snapshot(perfSamples);
+        perfSorted.assign(perfSamples.begin(), perfSamples.end());
+        PerfStats stats = SummarizePerf(perfSorted);
+
+        char overlay[96];
+        snprintf(overlay, sizeof(overlay), "p50 %.1f us  p99 %.1f us  max %.1f us", stats.p50, stats.p99, stats.max);
+        ImGui::Text("%s (%zu samples)", PerfProbeName(static_cast<PerfProbe>(probe)), stats.samples);
+
+        // Newest samples, one bar each
+        int count = static_cast<int>(std::min<size_t>(perfSamples.size(), 200));
+        const float* series[] = { perfSamples.data() + perfSamples.size() - count };
+        ImGui::PushID(static_cast<int>(probe));
+        ImGui::PlotHistogram("##perf", series, 1, count, 0, overlay, 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+        ImGui::PopID();
+    }
+
+    if (ImGui::Button("Reset Performance Counters")) {
+        for (PerfRing& ring : perfRings) {
+            ring.Reset();
+        }
+    }
 }
+#endif
 
 void LadderRank::ResetToDefaults() {
     cvarManager->getCvar("LadderRank_offset_x").setValue(700.0f);
@@ -807,12 +1743,16 @@ void LadderRank::ResetToDefaults() {
 // ============================================================================
 
 void LadderRank::Render() {
-    float xPercent = static_cast<float>(screenSize.X) / 1920.0f;
-    float yPercent = static_cast<float>(screenSize.Y) / 1080.0f;
+    LADDERRANK_PERF_SCOPE(Perf(PerfProbe::Render));
+
+    // screenSize belongs to the game thread, ImGui has the current size here
+    ImVec2 displaySize = ImGui::GetIO().DisplaySize;
+    float xPercent = displaySize.x / 1920.0f;
+    float yPercent = displaySize.y / 1080.0f;
 
     ImVec2 windowPos = ImVec2(0, 0);
     ImGui::SetNextWindowPos(windowPos, ImGuiCond_Always);
-    ImGui::SetNextWindowSize(ImVec2(static_cast<float>(screenSize.X), static_cast<float>(screenSize.Y)));
+    ImGui::SetNextWindowSize(displaySize);
 
     if (!ImGui::Begin(GetMenuTitle().c_str(), &isWindowOpen_,
         ImGuiWindowFlags_NoBackground | ImGuiWindowFlags_NoResize |
@@ -828,8 +1768,8 @@ void LadderRank::Render() {
     const float rectWidth = 470.0f;
     const float rectHeight = 250.0f;
 
-    float rectLeft = (screenSize.X - (rectWidth * xPercent)) / 2.0f;
-    float rectTop = (screenSize.Y - (rectHeight * yPercent)) / 2.0f;
+    float rectLeft = (displaySize.x - (rectWidth * xPercent)) / 2.0f;
+    float rectTop = (displaySize.y - (rectHeight * yPercent)) / 2.0f;
     float rectRight = rectLeft + (rectWidth * xPercent);
     float rectBottom = rectTop + (rectHeight * yPercent);
 
@@ -858,52 +1798,40 @@ void LadderRank::Render() {
         "MMR :"
     );
 
-    // Draw rank icons
-    ImVec2 centerPoint = ImVec2(screenSize.X / 2.0f, screenSize.Y / 2.0f);
-
-    // Before rank icon (bottom)
-    if (beforeRank->IsLoadedForImGui()) {
-        if (auto beforeRankTex = beforeRank->GetImGuiTex()) {
-            auto beforeRankRect = beforeRank->GetSizeF();
-            ImGui::SetCursorPos(ImVec2(
-                centerPoint.x - (beforeRankRect.X * 0.19f * xPercent) / 2.0f,
-                centerPoint.y - (50.0f * yPercent) - (beforeRankRect.Y * 0.19f * yPercent) / 2.0f
-            ));
-            ImGui::Image(beforeRankTex, ImVec2(
-                beforeRankRect.X * 0.19f * xPercent,
-                beforeRankRect.Y * 0.19f * yPercent
-            ));
-        }
+    // Session results of the selected playlist, formatted by the game thread
+    SessionText session = imguiSession.Load();
+    if (session.text[0] != '\0') {
+        drawList->AddText(
+            ImVec2(textX, centerY + (50.0f * yPercent)),
+            IM_COL32(255, 255, 255, 255),
+            session.text
+        );
     }
 
-    // Next rank icon (top)
-    if (nextRank->IsLoadedForImGui()) {
-        if (auto nextRankTex = nextRank->GetImGuiTex()) {
-            auto nextRankRect = nextRank->GetSizeF();
-            ImGui::SetCursorPos(ImVec2(
-                centerPoint.x - (nextRankRect.X * 0.19f * xPercent) / 2.0f,
-                centerPoint.y - (25.0f * yPercent) - (nextRankRect.Y * 0.19f * yPercent) / 2.0f
-            ));
-            ImGui::Image(nextRankTex, ImVec2(
-                nextRankRect.X * 0.19f * xPercent,
-                nextRankRect.Y * 0.19f * yPercent
-            ));
-        }
-    }
+    // Draw rank icons
+    ImVec2 centerPoint = ImVec2(displaySize.x / 2.0f, displaySize.y / 2.0f);
 
-    // Current rank icon (middle)
-    if (currentRank->IsLoadedForImGui()) {
-        if (auto currentRankTex = currentRank->GetImGuiTex()) {
-            auto currentRankRect = currentRank->GetSizeF();
+    // Tiers chosen on the game thread, textures resident before the tiers are published
+    auto drawIcon = [&](const ImGuiIcon& icon, float offsetY) {
+        if (!icon.texture || !icon.texture->IsLoadedForImGui()) {
+            return;
+        }
+        if (auto texture = icon.texture->GetImGuiTex()) {
+            ImVec2 size(icon.size.x * 0.19f * xPercent, icon.size.y * 0.19f * yPercent);
             ImGui::SetCursorPos(ImVec2(
-                centerPoint.x - (currentRankRect.X * 0.19f * xPercent) / 2.0f,
-                centerPoint.y - (40.0f * yPercent) - (currentRankRect.Y * 0.19f * yPercent) / 2.0f
-            ));
-            ImGui::Image(currentRankTex, ImVec2(
-                currentRankRect.X * 0.19f * xPercent,
-                currentRankRect.Y * 0.19f * yPercent
+                centerPoint.x - size.x / 2.0f,
+                centerPoint.y - (offsetY * yPercent) - size.y / 2.0f
             ));
+            ImGui::Image(texture, size, icon.uv0, icon.uv1);
         }
+    };
+
+    // Tiers first: the textures they need were published before them
+    DisplayedTiers tiers = imguiTiers.Load();
+    if (auto textures = imguiTextures.load()) {
+        drawIcon(MakeImGuiIcon(*textures, tiers.before), 50.0f);   // Before rank icon (bottom)
+        drawIcon(MakeImGuiIcon(*textures, tiers.next), 25.0f);     // Next rank icon (top)
+        drawIcon(MakeImGuiIcon(*textures, tiers.current), 40.0f);  // Current rank icon (middle)
     }
 
     ImGui::End();
@@ -5,10 +5,36 @@
 #include "bakkesmod/plugin/pluginwindow.h"
 #include "bakkesmod/plugin/PluginSettingsWindow.h"
 #include "imgui/imgui.h"
+#include "AssetLoader.h"
+#include "DisplayList.h"
+#include "IconAtlas.h"
+#include "IconBundle.h"
+#include "IconPool.h"
+#include "LayoutConfig.h"
+#include "LobbyRanks.h"
+#include "MMRHistory.h"
+#include "MMRTrend.h"
+#include "PerfCounters.h"
+#include "RankSnapshotWorker.h"
+#include "RankTableStore.h"
+#include "RefreshScheduler.h"
+#include "SeqLock.h"
+#include "SessionStats.h"
 #include "version.h"
 
 #pragma comment(lib, "pluginsdk.lib")
 
+// refreshScheduler key of the lobby lookup, playlist IDs are positive
+constexpr int LOBBY_REFRESH_KEY = -1;
+
+// Rank icon atlas: longest icon side in the atlas, and transparent border per icon
+constexpr int ICON_ATLAS_CELL = 256;
+constexpr int ICON_ATLAS_PADDING = 2;
+
+// iconLoader key of the atlas build, single icons use their tier
+constexpr int ICON_ATLAS_KEY = RANK_TIER_COUNT;
+constexpr size_t ICON_QUEUE_CAPACITY = 8;
+
 constexpr auto plugin_version = stringify(VERSION_MAJOR) "." stringify(VERSION_MINOR) "." stringify(VERSION_PATCH) "." stringify(VERSION_BUILD);
 
 using namespace std;
@@ -75,16 +101,6 @@ public:
      */
     void CheckMMR(int retryCount);
 
-    /**
-     * @brief Retrieves MMR threshold for a specific rank/division
-     * @param mode Playlist ID
-     * @param rank Tier level
-     * @param div Division within tier
-     * @param upperLimit True for max MMR, false for min MMR
-     * @return MMR threshold value
-     */
-    int unranker(int mode, int rank, int div, bool upperLimit);
-
     /**
      * @brief Event handler for menu loading
      * @param eventName Name of the triggered event
@@ -97,6 +113,12 @@ public:
      */
     void StatsScreen(std::string eventName);
 
+    /**
+     * @brief Event handler for kickoff countdowns, starts the lobby lookup once per match
+     * @param eventName Name of the triggered event
+     */
+    void OnCountdown(std::string eventName);
+
 private:
     // ========================================================================
     // INITIALIZATION
@@ -107,11 +129,53 @@ private:
      */
     void RegisterCVars();
 
+    /**
+     * @brief Queues work for the game thread, dropped if the plugin unloads first
+     *
+     * Worker, watcher, loader and render thread callbacks all hop to the game
+     * thread through here, so none of them can touch the plugin after onUnload.
+     * @param work Runs on the game thread
+     */
+    void RunOnGameThread(std::function<void()> work);
+
+    /**
+     * @brief Copies a cvar into layout now and after every change
+     * @param name CVar name
+     * @param field Layout field mirroring the cvar (bool or float)
+     */
+    template <typename T>
+    void BindLayoutCvar(const std::string& name, T LayoutConfig::* field);
+
     /**
      * @brief Registers game event hooks
      */
     void RegisterEventHooks();
 
+    /**
+     * @brief Registers console commands
+     */
+    void RegisterCommands();
+
+    /**
+     * @brief Publishes the embedded thresholds, starts the snapshot worker and watches the data folder
+     */
+    void StartRankDataWatcher();
+
+    /**
+     * @brief Reads the layouts saved per resolution from the data folder
+     */
+    void LoadSavedLayouts();
+
+    /**
+     * @brief Opens the MMR history log in the data folder
+     */
+    void StartMMRHistory();
+
+    /**
+     * @brief Replays the recent MMR history into the gain/loss averages
+     */
+    void LoadMMRTrends();
+
     // ========================================================================
     // DATA LOADING
     // ========================================================================
@@ -122,10 +186,89 @@ private:
     void LoadDefaultRankData();
 
     /**
-     * @brief Loads rank icon images based on current tier
+     * @brief Queues the decode and packing of every rank icon into IconAtlas.png
+     *
+     * The texture is loaded on the game thread once iconLoader is done.
+     */
+    void RequestRankAtlas();
+
+    /**
+     * @brief Returns the largest size an icon is drawn at, in screen pixels
+     */
+    float IconPixels() const;
+
+    /**
+     * @brief Switches to another IconBundle bucket when the icon size moved past the current one
+     */
+    void UpdateIconBucket();
+
+    /**
+     * @brief Turns decoded icons into the files the textures load from, on an iconLoader thread
+     * @param dataFolder LadderRank data folder
+     * @param result Decoded icons of the atlas or of one tier
+     */
+    void OnIconsDecoded(const std::filesystem::path& dataFolder, AssetResult& result);
+
+    /**
+     * @brief Queues the decode of one tier's icon, used when there is no atlas
+     * @param tier Tier level (0-22), a resident icon is reused as it is
+     */
+    void RequestRankIcon(int tier);
+
+    /**
+     * @brief Cancels the pending decode of a tier that is no longer displayed
+     */
+    void CancelRankIcon(int tier);
+
+    /**
+     * @brief Returns the PNG a tier's icon is read from in the data folder
+     */
+    std::filesystem::path RankIconPath(int tier);
+
+    /**
+     * @brief Points the rank icons at the icons of the active snapshot
+     *
+     * Only the three displayed tiers change, textures come from the atlas or
+     * iconPool. The plugin decodes the icon PNGs on the loader thread, but
+     * ImageWrapper only loads from files, so it still decodes the
+     * uncompressed copies it is given on the game thread (see LoadTexture()).
      */
     void LoadRankIcons();
 
+    /**
+     * @brief Creates the texture of one tier, the iconPool loader
+     * @param tier Tier level (0-22)
+     * @return Icon, loaded for the canvas and ImGui from its decoded copy when there is one
+     */
+    std::shared_ptr<ImageWrapper> LoadRankIcon(int tier);
+
+    /**
+     * @brief Creates a texture from a file, loaded for the canvas and ImGui
+     *
+     * ImageWrapper takes no pixel buffer, it reads and decodes the file
+     * itself before uploading it, on the game thread. The time is added to
+     * the counters ladderrank_perf prints.
+     * @param path PNG file
+     * @return Texture
+     */
+    std::shared_ptr<ImageWrapper> LoadTexture(const std::filesystem::path& path);
+
+    /**
+     * @brief Estimates the memory a loaded icon keeps on the GPU
+     * @return RGBA bytes, once per canvas and ImGui copy
+     */
+    static size_t TextureBytes(ImageWrapper& texture);
+
+    /**
+     * @brief Drops every icon texture and loads them again from disk
+     */
+    void ReloadRankIcons();
+
+    /**
+     * @brief Hands the current textures to Render(), after a load or invalidation
+     */
+    void PublishIconTextures();
+
     // ========================================================================
     // MMR UPDATE SYSTEM
     // ========================================================================
@@ -138,10 +281,17 @@ private:
     bool IsValidGameState(int retryCount);
 
     /**
-     * @brief Attempts to retrieve MMR data from wrapper
-     * @param retryCount Number of retries remaining
+     * @brief Fetches MMR data once the playlist is synced, run by refreshScheduler
+     * @param playlist Playlist ID to refresh
+     * @return False to retry later
+     */
+    bool RefreshPlaylist(int playlist);
+
+    /**
+     * @brief Resolves the rank of every player of the current match, run by refreshScheduler
+     * @return False to retry while some players have no MMR yet
      */
-    void TryGetMMRData(int retryCount);
+    bool ResolveLobby();
 
     /**
      * @brief Checks if playlist is a ranked playlist
@@ -151,39 +301,63 @@ private:
     bool IsRankedPlaylist(int playlist);
 
     /**
-     * @brief Fetches and updates player rank data
+     * @brief Captures player rank data and shows the last snapshot of the selected playlist
      * @param mmrWrapper Reference to MMR wrapper
      */
     void FetchPlayerRankData(MMRWrapper& mmrWrapper);
 
-    // ========================================================================
-    // RANK CALCULATION
-    // ========================================================================
+    /**
+     * @brief Reads whether the local player's team won the match that just ended
+     * @return Win or Loss, None if the match or the player is not available
+     */
+    MatchOutcome GetMatchOutcome();
 
     /**
-     * @brief Calculates adjacent ranks and MMR thresholds
+     * @brief MMR notifier callback, applies a new MMR as soon as it arrives
+     * @param id Player whose MMR changed
      */
-    void CalculateAdjacentRanks();
+    void OnMMRChanged(UniqueIDWrapper id);
+
+    /**
+     * @brief Shows the post-match MMR and starts timing its first frame
+     * @param fromNotifier True if the MMR notifier delivered it, false for polling
+     */
+    void ShowMatchMMR(bool fromNotifier);
+
+    // ========================================================================
+    // RANK SNAPSHOTS
+    // ========================================================================
 
     /**
-     * @brief Handles rank calculation for placement matches
+     * @brief Reads the MMR of every synced playlist and submits the changed ones
+     *
+     * Only MMRWrapper is touched here, snapshotWorker builds the snapshots.
+     * @param mmrWrapper Reference to MMR wrapper
+     * @return Number of playlists whose MMR or rank changed
      */
-    void HandlePlacementMatches();
+    int CaptureMMR(MMRWrapper& mmrWrapper);
 
     /**
-     * @brief Handles rank calculation for lowest rank (Bronze I Div I)
+     * @brief Returns the last captured sample of a playlist
+     * @param playlist Playlist ID
+     * @return Sample, or nothing if the playlist was never captured
      */
-    void HandleLowestRank();
+    std::optional<MMRSample> CapturedSample(int playlist) const;
 
     /**
-     * @brief Handles rank calculation for highest rank (SSL)
+     * @brief Makes the published snapshot of a playlist the displayed one
+     * @param playlist Playlist ID
+     * @return False if the playlist has no snapshot yet
      */
-    void HandleHighestRank();
+    bool SelectSnapshot(int playlist);
 
     /**
-     * @brief Handles rank calculation for normal ranks
+     * @brief Formats the session line of userPlaylist for Render()
+     *
+     * Called after every session update and playlist change, so the render
+     * thread only copies the text.
      */
-    void HandleNormalRank();
+    void PublishSessionText();
 
     // ========================================================================
     // CANVAS RENDERING
@@ -196,8 +370,39 @@ private:
     void RenderCanvas(CanvasWrapper canvas);
 
     /**
-     * @brief Renders left side of canvas (current rank display)
+     * @brief Rescales the overlay for a new screen size, switching to its saved layout
+     * @param size New canvas size
+     */
+    void OnScreenSizeChanged(Vector2 size);
+
+    /**
+     * @brief Makes a saved layout current, in layout and in the cvars
+     * @param saved Layout to apply
+     */
+    void ApplyLayout(const LayoutConfig& saved);
+
+    /**
+     * @brief Replays the recorded canvas calls
      * @param canvas Canvas wrapper reference
+     */
+    void ReplayDisplayList(CanvasWrapper& canvas);
+
+    /**
+     * @brief Records the canvas calls of the whole overlay into displayList
+     */
+    void BuildDisplayList();
+
+    /**
+     * @brief Records a rank icon scaled to a height, from the atlas when there is one
+     * @param tier Tier level (0-22)
+     * @param x Left edge
+     * @param y Top edge
+     * @param size Height on screen
+     */
+    void BuildIcon(int tier, float x, float y, float size);
+
+    /**
+     * @brief Records the left side of canvas (current rank display)
      * @param rectLeft Left edge of rectangle
      * @param rectTop Top edge of rectangle
      * @param rectBottom Bottom edge of rectangle
@@ -205,12 +410,11 @@ private:
      * @param xPercent Horizontal scaling factor
      * @param yPercent Vertical scaling factor
      */
-    void RenderLeftSide(CanvasWrapper& canvas, float rectLeft, float rectTop,
+    void BuildLeftSide(float rectLeft, float rectTop,
         float rectBottom, float leftMargin, float xPercent, float yPercent);
 
     /**
-     * @brief Renders right side of canvas (rank progression)
-     * @param canvas Canvas wrapper reference
+     * @brief Records the right side of canvas (rank progression)
      * @param rectRight Right edge of rectangle
      * @param rectTop Top edge of rectangle
      * @param rectBottom Bottom edge of rectangle
@@ -223,28 +427,35 @@ private:
      * @param xPercent Horizontal scaling factor
      * @param yPercent Vertical scaling factor
      */
-    void RenderRightSide(CanvasWrapper& canvas, float rectRight, float rectTop,
+    void BuildRightSide(float rectRight, float rectTop,
         float rectBottom, float rightIconOffset, float textOffset,
         float imgSize, float topSpacing, float middleSpacing,
         float bottomSpacing, float xPercent, float yPercent);
 
     /**
-     * @brief Renders a single rank entry (MMR + icon)
-     * @param canvas Canvas wrapper reference
+     * @brief Records the lobby ranks below the rectangle, one line per player
+     * @param rectLeft Left edge of rectangle
+     * @param rectBottom Bottom edge of rectangle
+     * @param xPercent Horizontal scaling factor
+     * @param yPercent Vertical scaling factor
+     */
+    void BuildLobbyRanks(float rectLeft, float rectBottom, float xPercent, float yPercent);
+
+    /**
+     * @brief Records a single rank entry (MMR + icon)
      * @param textX X position for text
      * @param iconX X position for icon
      * @param textY Y position for text
      * @param iconY Y position for icon
      * @param mmrValue MMR value to display
-     * @param rankIcon Rank icon to render
+     * @param rankTier Tier of the rank icon to render
      * @param imgSize Icon size
      * @param xPercent Horizontal scaling factor
      * @param yPercent Vertical scaling factor
      */
-    void RenderRankEntry(CanvasWrapper& canvas, float textX, float iconX,
+    void BuildRankEntry(float textX, float iconX,
         float textY, float iconY, int mmrValue,
-        std::shared_ptr<ImageWrapper> rankIcon,
-        float imgSize, float xPercent, float yPercent);
+        int rankTier, float imgSize, float xPercent, float yPercent);
 
     // ========================================================================
     // SETTINGS UI RENDERING
@@ -285,6 +496,13 @@ private:
      */
     void RenderCustomizationSettings();
 
+#if LADDERRANK_PERF
+    /**
+     * @brief Renders the last frame costs of every probe as histograms
+     */
+    void RenderPerformanceSettings();
+#endif
+
     /**
      * @brief Resets all settings to default values
      */
@@ -294,82 +512,194 @@ private:
     // STATE VARIABLES
     // ========================================================================
 
+    // Cleared first thing in onUnload. Never reassigned, so any thread may
+    // copy it into a callback queued with RunOnGameThread().
+    const std::shared_ptr<std::atomic<bool>> alive = std::make_shared<std::atomic<bool>>(true);
+
     // Window state
     bool isWindowOpen_ = false;
     bool isOpen = false;
-    Vector2 screenSize;
+    Vector2 screenSize;        // Canvas size, checked every frame by RenderCanvas()
 
     // Display flags
-    bool shouldDraw = true;
-    bool isEnabled = false;
+    std::atomic<bool> shouldDraw{ true };  // Settings checkbox (render thread), read by RenderCanvas()
     bool gotNewMMR = false;
     bool drawCanvas = false;
     bool isFriendOpen = false;
 
-    // Visibility toggles
-    bool rankNext = true;      // Show next rank
-    bool rankUnder = true;     // Show previous rank
-    bool rankAverage = true;   // Show current rank (right side)
-    bool rankAverage2 = true;  // Show current rank (left side)
+    // Visibility toggles, set by the settings window on the render thread and
+    // read by BuildDisplayList() on the game thread
+    std::atomic<bool> rankNext{ true };      // Show next rank
+    std::atomic<bool> rankUnder{ true };     // Show previous rank
+    std::atomic<bool> rankAverage{ true };   // Show current rank (right side)
+    std::atomic<bool> rankAverage2{ true };  // Show current rank (left side)
 
     // ========================================================================
     // RANK DATA
     // ========================================================================
 
-    // Current rank information
-    int userTier = 0;      // Current tier (0-22)
-    int userDiv = 0;       // Current division (0-3)
     int userPlaylist = 0;  // Selected playlist ID
-    float userMMR = 0.0f;  // Current MMR value
-
-    // Adjacent rank information (for division thresholds)
-    int upperTier = 0;     // Tier above current
-    int lowerTier = 0;     // Tier below current
-    int upperDiv = 0;      // Division above current
-    int lowerDiv = 0;      // Division below current
 
-    // MMR thresholds for divisions
-    int nextLower = 0;     // MMR for next division up
-    int beforeUpper = 0;   // MMR for previous division down
-
-    // MMR thresholds for complete tiers (for display)
-    int nextTierMinMMR = 0;  // Minimum MMR for tier +1
-    int prevTierMaxMMR = 0;  // Minimum MMR for current tier
-
-    // Rank display names
-    std::string nameCurrent = "";  // Current rank name
-    std::string nameNext = "";     // Next rank name
-    std::string nameBefore = "";   // Previous rank name
+    // Raw MMR of every synced playlist as last read on the game thread
+    // (indexed by RankTable::PlaylistSlot)
+    std::array<std::optional<MMRSample>, RANK_PLAYLIST_COUNT> capturedMMR;
+
+    // Average MMR won and lost per match, updated with every captured change
+    std::array<MMRTrend, RANK_PLAYLIST_COUNT> mmrTrends;
+
+    // Displayed snapshot, only touched on the game thread. SelectSnapshot()
+    // points it into the set last published by snapshotWorker.
+    std::shared_ptr<const RankSnapshot> activeSnapshot = std::make_shared<RankSnapshot>();
+
+    // MMR thresholds of every ranked playlist. The watcher rebuilds them on
+    // a background thread whenever the data folder changes.
+    RankTableStore rankStore;
+    RankDataWatcher rankWatcher;
+
+    // Builds the snapshots from capturedMMR on its own thread, declared
+    // after rankStore so it stops before the thresholds go away
+    RankSnapshotWorker snapshotWorker;
+
+    // Every captured MMR change, appended by CaptureMMR() and written to
+    // disk in batches by the writer thread
+    MMRHistoryWriter mmrHistory;
+    std::filesystem::path mmrHistoryPath;
+    MatchOutcome matchOutcome = MatchOutcome::None;  // Outcome of the next reading of matchPlaylist
+    int matchPlaylist = 0;
+
+    // Session delta, streak and win rate per playlist, updated on the game
+    // thread and read lock-free by both render paths
+    SessionTracker sessionStats;
+
+    // Ranks of the players of the current match (LadderRank_lobby_ranks).
+    // MMR of repeat opponents comes from the cache, game thread only.
+    LobbyRankCache lobbyCache{ 256, std::chrono::minutes(10) };
+    std::vector<LobbyRank> lobbyRanks;
+    bool lobbyResolved = false;        // Every player of this match has a rank
+
+    // Every delayed MMR refresh goes through here so overlapping retries merge
+    std::unique_ptr<RefreshScheduler> refreshScheduler;
+
+    // Post-match MMR updates. The notifier is the normal path, CheckMMR()
+    // polling only runs when it has not delivered a few seconds after a match.
+    std::unique_ptr<MMRNotifierToken> mmrNotifier;
+    std::chrono::steady_clock::time_point matchEndTime;
+    bool awaitingMatchMMR = false;     // Match ended, its new MMR is not shown yet
+    bool timingFirstFrame = false;     // New MMR shown, first frame not drawn yet
+    float matchMMR = 0.0f;             // MMR the first timed frame must show
+    const char* matchMMRSource = "";
+    int notifierUpdates = 0;           // Post-match updates delivered by the notifier
+    int pollUpdates = 0;               // Post-match updates delivered by polling
+    double lastUpdateMilliseconds = 0.0;  // OnMatchWinnerSet to first frame with the new MMR
 
     // ========================================================================
     // VISUAL ASSETS
     // ========================================================================
 
-    std::shared_ptr<ImageWrapper> currentRank;  // Current rank icon
-    std::shared_ptr<ImageWrapper> nextRank;     // Next rank icon
-    std::shared_ptr<ImageWrapper> beforeRank;   // Previous rank icon
+    // Reads and decodes the icon PNGs off the game thread
+    AssetLoader iconLoader{ ICON_QUEUE_CAPACITY };
+    std::array<uint64_t, RANK_TIER_COUNT + 1> iconTickets{};  // Pending iconLoader ticket by key, 0 when none
+
+    // Icons loaded one by one, used when there is no atlas. A tier is
+    // loaded on first use and kept until ReloadRankIcons().
+    IconPool<ImageWrapper, RANK_TIER_COUNT> iconPool{
+        [this](int tier) { return LoadRankIcon(tier); }, &LadderRank::TextureBytes };
+
+    // Every rank icon in one texture (IconAtlas.png), null if it could not
+    // be built. atlasRegions is where each tier sits in it.
+    std::shared_ptr<ImageWrapper> rankAtlas;
+    std::array<AtlasRegion, RANK_TIER_COUNT> atlasRegions;
+    size_t rankAtlasBytes = 0;
+    uint64_t textureLoads = 0;             // LoadTexture() calls
+    double textureLoadMilliseconds = 0.0;  // Game thread time in ImageWrapper, file decode and upload
+    double textureLoadMaxMilliseconds = 0.0;
+    int atlasCell = ICON_ATLAS_CELL;   // Longest icon side in rankAtlas
+    std::vector<int> bundleCells;      // Buckets of IconBundle.bin, empty without one
+
+    // Decoded and scaled copies of single icons, stored uncompressed so the
+    // texture upload reads them without decoding. Empty until written.
+    std::array<std::filesystem::path, RANK_TIER_COUNT> decodedIcons;
+
+    // The tiers on screen, updates that keep all three are skipped
+    struct DisplayedTiers {
+        int current = -1;
+        int next = -1;
+        int before = -1;
+
+        bool operator==(const DisplayedTiers&) const = default;
+    };
+    DisplayedTiers displayedTiers;
+    uint64_t iconUpdates = 0;          // Updates that changed a displayed tier
+    uint64_t iconUpdatesSkipped = 0;   // Updates that kept all three
 
-    // Visual settings
-    float opacity = 255.0f;  // Background opacity (0-255)
+    /**
+     * @brief Every texture Render() may draw an icon from
+     *
+     * Republished only when a texture is loaded or invalidated, rank changes
+     * go through imguiTiers alone.
+     */
+    struct IconTextures {
+        std::shared_ptr<ImageWrapper> atlas;
+        std::array<AtlasRegion, RANK_TIER_COUNT> regions;
+        std::array<std::shared_ptr<ImageWrapper>, RANK_TIER_COUNT> icons;  // iconPool slots
+        float atlasScale = 1.0f;       // ICON_ATLAS_CELL over atlasCell, keeps icon sizes per bucket
+    };
 
-    // ========================================================================
-    // CONSTANTS
-    // ========================================================================
+    /**
+     * @brief One displayed icon for Render(): a texture and the part of it to draw
+     */
+    struct ImGuiIcon {
+        std::shared_ptr<ImageWrapper> texture;
+        ImVec2 uv0{ 0.0f, 0.0f };
+        ImVec2 uv1{ 1.0f, 1.0f };
+        ImVec2 size{ 0.0f, 0.0f };     // Pixels of the icon in the texture
+    };
 
     /**
-     * @brief Array of ranked playlist IDs
+     * @brief Returns where Render() finds the icon of a tier
      */
-    static constexpr int rankedPlaylists[8] = {
-        10,  // 1v1 (Duel)
-        11,  // 2v2 (Doubles)
-        13,  // 3v3 (Standard)
-        27,  // Hoops
-        28,  // Rumble
-        29,  // Dropshot
-        30,  // Snowday
-        34   // Tournaments
+    static ImGuiIcon MakeImGuiIcon(const IconTextures& textures, int tier);
+
+    /**
+     * @brief Session line of the selected playlist, empty when there is none
+     */
+    struct SessionText {
+        char text[96] = {};
     };
 
+    // Icons and session line for Render(), which runs on the render thread
+    SeqLock<SessionText> imguiSession;
+    std::atomic<std::shared_ptr<const IconTextures>> imguiTextures;
+    SeqLock<DisplayedTiers> imguiTiers;
+    uint64_t publishedIconLoads = 0;   // iconPool.Loads() at the last PublishIconTextures()
+
+    // Display cvars as last seen, only touched on the game thread
+    LayoutConfig layout;
+    uint64_t layoutChanges = 0;        // Cvar changes applied to layout
+
+    // Layouts saved per resolution (layouts.json), game thread only
+    LayoutSet savedLayouts;
+    std::filesystem::path layoutsPath;
+    uint64_t resolutionChanges = 0;    // Canvas size changes seen by RenderCanvas()
+
+    // Canvas calls of the overlay, recorded by BuildDisplayList() on the
+    // game thread. displayDirty is set from both threads by whatever the
+    // overlay depends on: snapshot, icons, screen size, layout, session,
+    // lobby and the visibility toggles.
+    DisplayList displayList;
+    std::vector<std::shared_ptr<ImageWrapper>> displayTextures;  // Indexed by DrawCommand::resource
+    std::atomic<bool> displayDirty{ true };
+    uint64_t displayBuilds = 0;
+
+#if LADDERRANK_PERF
+    // Cost of RenderCanvas(), Render() and MMR updates, see ladderrank_perf
+    std::array<PerfRing, PERF_PROBE_COUNT> perfRings;
+    std::vector<float> perfSamples;    // RenderPerformanceSettings() scratch, render thread only
+    std::vector<float> perfSorted;
+
+    PerfRing& Perf(PerfProbe probe) { return perfRings[static_cast<size_t>(probe)]; }
+#endif
+
     // ========================================================================
     // EVENT HANDLING
     // ========================================================================
@@ -0,0 +1,138 @@
+#include "LayoutConfig.h"
+#include "json.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using json = nlohmann::json;
+
+// ============================================================================
+// FIELDS
+// ============================================================================
+
+static const LayoutField LAYOUT_FIELDS[] = {
+    { "offset_x", &LayoutConfig::offsetX },
+    { "offset_y", &LayoutConfig::offsetY },
+    { "rect_width", &LayoutConfig::rectWidth },
+    { "rect_height", &LayoutConfig::rectHeight },
+    { "left_margin", &LayoutConfig::leftMargin },
+    { "icon_size", &LayoutConfig::iconSize },
+    { "right_icon_offset", &LayoutConfig::rightIconOffset },
+    { "text_offset", &LayoutConfig::textOffset },
+    { "top_spacing", &LayoutConfig::topSpacing },
+    { "middle_spacing", &LayoutConfig::middleSpacing },
+    { "bottom_spacing", &LayoutConfig::bottomSpacing },
+    { "opacity", &LayoutConfig::opacity }
+};
+
+std::span<const LayoutField> LayoutFields() {
+    return LAYOUT_FIELDS;
+}
+
+// ============================================================================
+// SAVED LAYOUTS
+// ============================================================================
+
+/**
+ * @brief Parses a "1920x1080" resolution key
+ * @return False if the key is not a resolution
+ */
+static bool ParseResolution(const std::string& key, int& width, int& height) {
+    char end = 0;
+    return std::sscanf(key.c_str(), "%dx%d%c", &width, &height, &end) == 2 && width > 0 && height > 0;
+}
+
+bool LayoutSet::Load(const std::filesystem::path& path, std::string& error) {
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        layouts.clear();
+        return true;
+    }
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        error = "cannot open " + path.string();
+        return false;
+    }
+
+    json document = json::parse(stream, nullptr, false);
+    if (document.is_discarded() || !document.is_object()) {
+        error = "not a JSON object";
+        return false;
+    }
+
+    auto saved = document.find("layouts");
+    if (saved == document.end() || !saved->is_object()) {
+        error = "missing \"layouts\" object";
+        return false;
+    }
+
+    std::map<std::pair<int, int>, LayoutConfig> loaded;
+    for (auto& [key, values] : saved->items()) {
+        int width = 0;
+        int height = 0;
+        if (!ParseResolution(key, width, height) || !values.is_object()) {
+            error = "invalid layout \"" + key + "\"";
+            return false;
+        }
+
+        LayoutConfig& layout = loaded[{ width, height }];
+        for (const LayoutField& field : LAYOUT_FIELDS) {
+            auto value = values.find(field.name);
+            if (value != values.end() && value->is_number()) {
+                layout.*field.field = value->get<float>();
+            }
+        }
+    }
+
+    layouts = std::move(loaded);
+    return true;
+}
+
+bool LayoutSet::Save(const std::filesystem::path& path, std::string& error) const {
+    json saved = json::object();
+    for (const auto& [resolution, layout] : layouts) {
+        json& values = saved[std::to_string(resolution.first) + "x" + std::to_string(resolution.second)];
+        for (const LayoutField& field : LAYOUT_FIELDS) {
+            values[field.name] = layout.*field.field;
+        }
+    }
+    json document = { { "version", 1 }, { "layouts", std::move(saved) } };
+
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            error = "cannot create " + temporary.string();
+            return false;
+        }
+        stream << document.dump(4);
+        if (!stream) {
+            error = "cannot write " + temporary.string();
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        error = "cannot replace " + path.string() + ": " + ec.message();
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+const LayoutConfig* LayoutSet::Find(int width, int height) const {
+    auto found = layouts.find({ width, height });
+    return found == layouts.end() ? nullptr : &found->second;
+}
+
+void LayoutSet::Store(int width, int height, const LayoutConfig& layout) {
+    layouts[{ width, height }] = layout;
+}
+
+bool LayoutSet::Remove(int width, int height) {
+    return layouts.erase({ width, height }) > 0;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <span>
+#include <string>
+#include <utility>
+
+// ============================================================================
+// LAYOUT CONFIG
+// ============================================================================
+
+/**
+ * @brief Plain copy of every display cvar
+ *
+ * Kept up to date by the cvar change callbacks, so drawing a frame reads
+ * these fields instead of looking each cvar up by name. The defaults match
+ * the registered cvar defaults. Has no BakkesMod dependency.
+ */
+struct LayoutConfig {
+    bool enabled = true;           // LadderRank_enabled
+    bool lobbyRanks = false;       // LadderRank_lobby_ranks
+
+    // Global position (1080p pixels)
+    float offsetX = 700.0f;
+    float offsetY = -400.0f;
+
+    // Rectangle dimensions
+    float rectWidth = 470.0f;
+    float rectHeight = 250.0f;
+
+    // Left and right side
+    float leftMargin = 30.0f;
+    float iconSize = 60.0f;
+    float rightIconOffset = 80.0f;
+    float textOffset = 150.0f;
+
+    // Vertical spacing
+    float topSpacing = 120.0f;
+    float middleSpacing = 30.0f;
+    float bottomSpacing = 60.0f;
+
+    float opacity = 255.0f;        // Background opacity (0-255)
+};
+
+/**
+ * @brief A float field of LayoutConfig and the name it is saved under
+ *
+ * The matching cvar is "LadderRank_" + name.
+ */
+struct LayoutField {
+    const char* name;
+    float LayoutConfig::* field;
+};
+
+/**
+ * @brief Every float field of LayoutConfig, in cvar registration order
+ */
+std::span<const LayoutField> LayoutFields();
+
+// ============================================================================
+// SAVED LAYOUTS
+// ============================================================================
+
+/**
+ * @brief Layouts saved per screen resolution (layouts.json)
+ *
+ * Loaded once, so switching to the layout of a new resolution is a map
+ * lookup. Only the LayoutFields() are saved, the enable flags stay global.
+ * Fields missing from a saved layout take their default.
+ *
+ * Single-threaded. Has no BakkesMod dependency.
+ */
+class LayoutSet {
+public:
+    /**
+     * @brief Replaces the layouts with the ones of a file
+     * @param path layouts.json
+     * @param error Receives the reason the file was rejected
+     * @return True if the file was read or does not exist yet
+     */
+    bool Load(const std::filesystem::path& path, std::string& error);
+
+    /**
+     * @brief Writes every layout, replacing the file in one rename
+     * @param path layouts.json
+     * @param error Receives the reason the file was not written
+     * @return True on success
+     */
+    bool Save(const std::filesystem::path& path, std::string& error) const;
+
+    /**
+     * @brief Returns the layout saved for a resolution
+     * @return Layout, or nullptr if none was saved
+     */
+    const LayoutConfig* Find(int width, int height) const;
+
+    void Store(int width, int height, const LayoutConfig& layout);
+    bool Remove(int width, int height);
+
+    /**
+     * @brief Every saved layout, keyed by width and height
+     */
+    const std::map<std::pair<int, int>, LayoutConfig>& All() const { return layouts; }
+
+private:
+    std::map<std::pair<int, int>, LayoutConfig> layouts;
+};
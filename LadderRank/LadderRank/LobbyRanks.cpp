@@ -0,0 +1,75 @@
+#include "LobbyRanks.h"
+
+#include <algorithm>
+
+LobbyRankCache::LobbyRankCache(size_t capacity, std::chrono::seconds ttl)
+    : capacity(std::max<size_t>(1, capacity)), ttl(ttl) {
+}
+
+std::vector<LobbyRank> LobbyRankCache::Resolve(const std::vector<LobbyPlayer>& players, int playlist,
+    const RankTable& table, const Fetch& fetch, Clock::time_point now) {
+    std::vector<LobbyRank> ranks(players.size());
+    std::vector<float> mmr;
+    std::vector<size_t> knownIndex;
+    mmr.reserve(players.size());
+    knownIndex.reserve(players.size());
+
+    for (size_t i = 0; i < players.size(); i++) {
+        ranks[i].player = players[i];
+        if (Lookup(players[i], playlist, fetch, now, ranks[i].mmr)) {
+            ranks[i].known = true;
+            mmr.push_back(ranks[i].mmr);
+            knownIndex.push_back(i);
+        }
+    }
+
+    // One pass over the thresholds for the whole lobby
+    std::vector<RankPosition> positions(mmr.size());
+    table.LocateMany(playlist, mmr.data(), positions.data(), mmr.size());
+    for (size_t k = 0; k < knownIndex.size(); k++) {
+        ranks[knownIndex[k]].position = positions[k];
+    }
+
+    return ranks;
+}
+
+void LobbyRankCache::Clear() {
+    recent.clear();
+    entries.clear();
+}
+
+bool LobbyRankCache::Lookup(const LobbyPlayer& player, int playlist, const Fetch& fetch,
+    Clock::time_point now, float& mmr) {
+    std::string key = player.id + "#" + std::to_string(playlist);
+
+    auto found = entries.find(key);
+    if (found != entries.end()) {
+        auto entry = found->second;
+        if (now - entry->fetched < ttl) {
+            hits++;
+            recent.splice(recent.begin(), recent, entry);
+            mmr = entry->mmr;
+            return true;
+        }
+
+        // Too old, fetch it again
+        expired++;
+        recent.erase(entry);
+        entries.erase(found);
+    }
+
+    misses++;
+    if (!fetch(player, playlist, mmr)) {
+        return false;
+    }
+
+    if (entries.size() >= capacity) {
+        entries.erase(recent.back().key);
+        recent.pop_back();
+        evictions++;
+    }
+
+    recent.push_front(Entry{ key, mmr, now });
+    entries.emplace(std::move(key), recent.begin());
+    return true;
+}
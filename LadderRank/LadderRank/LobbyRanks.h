@@ -0,0 +1,113 @@
+#pragma once
+
+#include "RankTable.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// LOBBY RANK CACHE
+// ============================================================================
+
+/**
+ * @brief One player of a match as seen by the lobby lookup
+ */
+struct LobbyPlayer {
+    std::string id;          // UniqueIDWrapper::GetIdString()
+    std::string name;
+    int team = 0;
+};
+
+/**
+ * @brief Rank of one lobby player in the match playlist
+ */
+struct LobbyRank {
+    LobbyPlayer player;
+    bool known = false;      // False while MMRWrapper has no MMR for the player
+    float mmr = 0.0f;
+    RankPosition position;   // Tier and division derived from the MMR
+};
+
+/**
+ * @brief Caches the MMR of lobby players, keyed by UniqueID and playlist
+ *
+ * Bounded LRU: the least recently seen player goes when the cache is full,
+ * and entries older than the TTL are fetched again. Only MMR values are
+ * cached; ranks are derived for the whole lobby with one
+ * RankTable::LocateMany() call, so a threshold reload applies at once.
+ *
+ * Single-threaded. Has no BakkesMod dependency, MMR comes from an injected
+ * fetch so tests can stand in for MMRWrapper.
+ */
+class LobbyRankCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Reads the MMR of one player
+     * @param player Player to look up
+     * @param playlist Playlist ID
+     * @param mmr Receives the MMR
+     * @return False if the MMR is not available (not synced yet)
+     */
+    using Fetch = std::function<bool(const LobbyPlayer& player, int playlist, float& mmr)>;
+
+    /**
+     * @param capacity Maximum number of cached players
+     * @param ttl Age after which a cached MMR is fetched again
+     */
+    LobbyRankCache(size_t capacity, std::chrono::seconds ttl);
+
+    /**
+     * @brief Resolves the rank of every player of a lobby
+     * @param players Players of the match
+     * @param playlist Match playlist ID
+     * @param table Thresholds the ranks are derived from
+     * @param fetch Called for players missing from the cache or expired
+     * @param now Current time
+     * @return One rank per player, in the order of players
+     */
+    std::vector<LobbyRank> Resolve(const std::vector<LobbyPlayer>& players, int playlist,
+        const RankTable& table, const Fetch& fetch, Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Drops every cached player
+     */
+    void Clear();
+
+    size_t Size() const { return entries.size(); }
+    uint64_t Hits() const { return hits; }
+    uint64_t Misses() const { return misses; }
+    uint64_t Expired() const { return expired; }
+    uint64_t Evictions() const { return evictions; }
+
+private:
+    struct Entry {
+        std::string key;
+        float mmr = 0.0f;
+        Clock::time_point fetched;
+    };
+
+    /**
+     * @brief Returns the cached MMR of a key, fetching it if missing or expired
+     * @return False if the MMR is not available
+     */
+    bool Lookup(const LobbyPlayer& player, int playlist, const Fetch& fetch, Clock::time_point now, float& mmr);
+
+    size_t capacity;
+    std::chrono::seconds ttl;
+
+    std::list<Entry> recent;  // Most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> entries;
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t expired = 0;
+    uint64_t evictions = 0;
+};
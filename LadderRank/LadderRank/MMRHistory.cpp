@@ -0,0 +1,376 @@
+#include "MMRHistory.h"
+#include "RankBinary.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <tuple>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// RECORDS
+// ============================================================================
+
+static uint32_t RecordCheck(const MMRHistoryRecord& record) {
+    return Fnv1a(reinterpret_cast<const uint8_t*>(&record), offsetof(MMRHistoryRecord, check));
+}
+
+MMRHistoryRecord MakeHistoryRecord(int64_t timestamp, int playlist, float mmr, int tier, int division,
+    MatchOutcome outcome) {
+    MMRHistoryRecord record{};
+    record.timestamp = timestamp;
+    record.playlist = playlist;
+    record.mmr = mmr;
+    record.tier = static_cast<int16_t>(tier);
+    record.division = static_cast<int8_t>(division);
+    record.outcome = static_cast<int8_t>(outcome);
+    record.check = RecordCheck(record);
+    return record;
+}
+
+bool IsValidRecord(const MMRHistoryRecord& record) {
+    return record.check == RecordCheck(record);
+}
+
+int64_t HistoryTimestampNow() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static std::FILE* OpenFile(const std::filesystem::path& path, bool create) {
+#ifdef _WIN32
+    return _wfopen(path.c_str(), create ? L"w+b" : L"r+b");
+#else
+    return std::fopen(path.c_str(), create ? "w+b" : "r+b");
+#endif
+}
+
+static bool SyncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+static MMRHistoryHeader MakeHeader() {
+    MMRHistoryHeader header{};
+    header.magic = MMR_HISTORY_MAGIC;
+    header.version = MMR_HISTORY_VERSION;
+    header.recordSize = sizeof(MMRHistoryRecord);
+    return header;
+}
+
+static bool IsValidHeader(const MMRHistoryHeader& header, std::string& error) {
+    if (header.magic != MMR_HISTORY_MAGIC) {
+        error = "not an MMR history file";
+        return false;
+    }
+    if (header.version != MMR_HISTORY_VERSION || header.recordSize != sizeof(MMRHistoryRecord)) {
+        error = "unsupported version " + std::to_string(header.version);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// WRITER
+// ============================================================================
+
+MMRHistoryWriter::~MMRHistoryWriter() {
+    Close();
+}
+
+bool MMRHistoryWriter::Open(const std::filesystem::path& path, std::chrono::milliseconds flushInterval,
+    std::string& error) {
+    Close();
+
+    std::error_code ec;
+    uintmax_t size = std::filesystem::file_size(path, ec);
+    bool create = ec || size == 0;
+
+    if (!create) {
+        // Cut a record torn by a crash, appending after it would shift every later record
+        uintmax_t whole = size < sizeof(MMRHistoryHeader) ? size
+            : sizeof(MMRHistoryHeader) + (size - sizeof(MMRHistoryHeader)) / sizeof(MMRHistoryRecord) * sizeof(MMRHistoryRecord);
+        if (whole != size) {
+            std::filesystem::resize_file(path, whole, ec);
+            if (ec) {
+                error = "cannot repair " + path.string() + ": " + ec.message();
+                return false;
+            }
+        }
+    }
+
+    std::FILE* handle = OpenFile(path, create);
+    if (handle == nullptr) {
+        error = "cannot open " + path.string();
+        return false;
+    }
+
+    int64_t newest = 0;
+    if (create) {
+        MMRHistoryHeader header = MakeHeader();
+        if (std::fwrite(&header, sizeof(header), 1, handle) != 1 || !SyncFile(handle)) {
+            std::fclose(handle);
+            error = "cannot write " + path.string();
+            return false;
+        }
+    }
+    else {
+        MMRHistoryHeader header{};
+        if (std::fread(&header, sizeof(header), 1, handle) != 1 || !IsValidHeader(header, error)) {
+            std::fclose(handle);
+            if (error.empty()) {
+                error = "truncated header";
+            }
+            return false;
+        }
+
+        // Later records must not go before the newest one on disk
+        MMRHistoryRecord last{};
+        if (std::fseek(handle, -static_cast<long>(sizeof(last)), SEEK_END) == 0
+            && std::ftell(handle) >= static_cast<long>(sizeof(header))
+            && std::fread(&last, sizeof(last), 1, handle) == 1 && IsValidRecord(last)) {
+            newest = last.timestamp;
+        }
+    }
+    std::fseek(handle, 0, SEEK_END);
+
+    file = handle;
+    this->flushInterval = flushInterval;
+    lastTimestamp = newest;
+    stopRequested = false;
+    flushRequested = false;
+
+    thread = std::thread(&MMRHistoryWriter::Run, this);
+    return true;
+}
+
+void MMRHistoryWriter::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    wake.notify_all();
+
+    // The thread writes what is still queued before leaving
+    if (thread.joinable()) {
+        thread.join();
+    }
+
+    if (file != nullptr) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+void MMRHistoryWriter::Append(MMRHistoryRecord record) {
+    bool batchFull = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (record.timestamp < lastTimestamp) {
+            record.timestamp = lastTimestamp;
+            record.check = RecordCheck(record);
+        }
+        lastTimestamp = record.timestamp;
+
+        pending.push_back(record);
+        appended++;
+        batchFull = pending.size() >= MMR_HISTORY_BATCH;
+    }
+    if (batchFull) {
+        wake.notify_one();
+    }
+}
+
+void MMRHistoryWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!thread.joinable()) {
+        return;
+    }
+
+    uint64_t target = appended;
+    flushRequested = true;
+    wake.notify_one();
+    written.wait(lock, [this, target]() { return done >= target; });
+}
+
+uint64_t MMRHistoryWriter::Appended() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return appended;
+}
+
+uint64_t MMRHistoryWriter::Syncs() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return syncs;
+}
+
+uint64_t MMRHistoryWriter::FailedRecords() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return failedRecords;
+}
+
+void MMRHistoryWriter::Run() {
+    std::vector<MMRHistoryRecord> batch;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait_for(lock, flushInterval, [this]() {
+            return stopRequested || flushRequested || pending.size() >= MMR_HISTORY_BATCH;
+            });
+
+        bool stopping = stopRequested;
+        flushRequested = false;
+        batch.swap(pending);
+        lock.unlock();
+
+        bool ok = batch.empty() || WriteBatch(batch);
+
+        lock.lock();
+        done += batch.size();
+        if (!batch.empty()) {
+            syncs++;
+        }
+        if (!ok) {
+            failedRecords += batch.size();
+        }
+        batch.clear();
+        written.notify_all();
+
+        if (stopping) {
+            break;
+        }
+    }
+}
+
+bool MMRHistoryWriter::WriteBatch(const std::vector<MMRHistoryRecord>& batch) {
+    if (std::fwrite(batch.data(), sizeof(MMRHistoryRecord), batch.size(), file) != batch.size()) {
+        return false;
+    }
+    return SyncFile(file);
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+bool MMRHistory::Open(const std::filesystem::path& path, std::string& error) {
+    Close();
+
+    if (!file.Open(path)) {
+        error = "cannot map " + path.string();
+        return false;
+    }
+
+    if (file.Size() < sizeof(MMRHistoryHeader)) {
+        error = "truncated header";
+        Close();
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const MMRHistoryHeader*>(file.Data());
+    if (!IsValidHeader(*header, error)) {
+        Close();
+        return false;
+    }
+
+    // A torn record at the end is left out
+    records = reinterpret_cast<const MMRHistoryRecord*>(file.Data() + sizeof(MMRHistoryHeader));
+    count = (file.Size() - sizeof(MMRHistoryHeader)) / sizeof(MMRHistoryRecord);
+    return true;
+}
+
+void MMRHistory::Close() {
+    file.Close();
+    records = nullptr;
+    count = 0;
+}
+
+std::span<const MMRHistoryRecord> MMRHistory::Range(int64_t from, int64_t to) const {
+    auto all = All();
+    auto first = std::lower_bound(all.begin(), all.end(), from,
+        [](const MMRHistoryRecord& record, int64_t time) { return record.timestamp < time; });
+    auto last = std::lower_bound(first, all.end(), to,
+        [](const MMRHistoryRecord& record, int64_t time) { return record.timestamp < time; });
+    return { first, last };
+}
+
+std::vector<MMRHistoryRecord> MMRHistory::Query(int playlist, int64_t from, int64_t to) const {
+    std::vector<MMRHistoryRecord> result;
+    for (const MMRHistoryRecord& record : Range(from, to)) {
+        if ((playlist == 0 || record.playlist == playlist) && IsValidRecord(record)) {
+            result.push_back(record);
+        }
+    }
+    return result;
+}
+
+// ============================================================================
+// COMPACTION
+// ============================================================================
+
+int64_t CompactMMRHistory(const std::filesystem::path& path, int64_t keepFrom, std::string& error) {
+    std::vector<MMRHistoryRecord> kept;
+    size_t total = 0;
+    {
+        MMRHistory history;
+        if (!history.Open(path, error)) {
+            return -1;
+        }
+        total = history.Count();
+
+        std::map<int32_t, std::tuple<float, int16_t, int8_t>> previous;
+        for (const MMRHistoryRecord& record : history.Range(keepFrom, INT64_MAX)) {
+            if (!IsValidRecord(record)) {
+                continue;
+            }
+
+            // A repeated reading tells nothing new unless a match produced it
+            auto reading = std::make_tuple(record.mmr, record.tier, record.division);
+            auto found = previous.find(record.playlist);
+            bool repeat = found != previous.end() && found->second == reading;
+            previous[record.playlist] = reading;
+            if (repeat && record.outcome == static_cast<int8_t>(MatchOutcome::None)) {
+                continue;
+            }
+
+            kept.push_back(record);
+        }
+    }
+
+    auto temporary = path;
+    temporary += ".tmp";
+
+    std::FILE* handle = OpenFile(temporary, true);
+    if (handle == nullptr) {
+        error = "cannot create " + temporary.string();
+        return -1;
+    }
+
+    MMRHistoryHeader header = MakeHeader();
+    bool ok = std::fwrite(&header, sizeof(header), 1, handle) == 1
+        && std::fwrite(kept.data(), sizeof(MMRHistoryRecord), kept.size(), handle) == kept.size()
+        && SyncFile(handle);
+    std::fclose(handle);
+
+    std::error_code ec;
+    if (ok) {
+        std::filesystem::rename(temporary, path, ec);
+    }
+    if (!ok || ec) {
+        error = "cannot replace " + path.string() + (ec ? ": " + ec.message() : "");
+        std::filesystem::remove(temporary, ec);
+        return -1;
+    }
+
+    return static_cast<int64_t>(total - kept.size());
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "MappedFile.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// MMR HISTORY FORMAT
+// ============================================================================
+//
+// Little endian, append-only:
+//
+//   MMRHistoryHeader
+//   MMRHistoryRecord records[]   in timestamp order
+//
+// Records have a fixed size, so the record count is derived from the file
+// size and a torn record at the end is simply ignored. Each record carries
+// its own checksum instead of a whole-file one, so appending never rewrites
+// anything.
+
+constexpr uint32_t MMR_HISTORY_MAGIC = 0x484D524C;  // "LRMH"
+constexpr uint32_t MMR_HISTORY_VERSION = 1;
+constexpr size_t MMR_HISTORY_BATCH = 256;           // Appends that trigger a write before the interval
+
+struct MMRHistoryHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;     // sizeof(MMRHistoryRecord)
+    uint32_t reserved;
+};
+
+/**
+ * @brief Result of the match an MMR reading followed
+ */
+enum class MatchOutcome : int8_t {
+    None = 0,                // Not a post-match reading
+    Win = 1,
+    Loss = 2
+};
+
+struct MMRHistoryRecord {
+    int64_t timestamp;       // Milliseconds since the Unix epoch
+    int32_t playlist;
+    float mmr;
+    int16_t tier;
+    int8_t division;
+    int8_t outcome;          // MatchOutcome
+    uint32_t check;          // FNV-1a of the fields above
+};
+
+static_assert(sizeof(MMRHistoryHeader) == 16, "MMRHistoryHeader layout");
+static_assert(sizeof(MMRHistoryRecord) == 24, "MMRHistoryRecord layout");
+
+/**
+ * @brief Builds a record with its checksum
+ * @param timestamp Milliseconds since the Unix epoch
+ * @param playlist Playlist ID
+ * @param mmr MMR reading
+ * @param tier Tier level (0-22)
+ * @param division Division within tier (0-3)
+ * @param outcome Result of the match the reading followed
+ * @return Record ready to append
+ */
+MMRHistoryRecord MakeHistoryRecord(int64_t timestamp, int playlist, float mmr, int tier, int division,
+    MatchOutcome outcome);
+
+/**
+ * @brief Checks a record against its checksum
+ */
+bool IsValidRecord(const MMRHistoryRecord& record);
+
+/**
+ * @brief Current time in the unit of MMRHistoryRecord::timestamp
+ */
+int64_t HistoryTimestampNow();
+
+// ============================================================================
+// WRITER
+// ============================================================================
+
+/**
+ * @brief Appends records to an MMR history file from a background thread
+ *
+ * Append() only queues the record. The writer thread writes everything
+ * queued with one write and one fsync, either every flush interval or once
+ * MMR_HISTORY_BATCH records are waiting, so a burst of appends costs a
+ * single sync. Timestamps are clamped so the file stays in order even if
+ * the clock goes back.
+ */
+class MMRHistoryWriter {
+public:
+    MMRHistoryWriter() = default;
+    ~MMRHistoryWriter();
+
+    MMRHistoryWriter(const MMRHistoryWriter&) = delete;
+    MMRHistoryWriter& operator=(const MMRHistoryWriter&) = delete;
+
+    /**
+     * @brief Opens or creates a history file and starts the writer thread
+     *
+     * A torn record left by a crash is cut off before appending.
+     * @param path History file
+     * @param flushInterval Longest time a record waits before being written
+     * @param error Receives the reason the file cannot be used
+     * @return True if records can be appended
+     */
+    bool Open(const std::filesystem::path& path, std::chrono::milliseconds flushInterval, std::string& error);
+
+    /**
+     * @brief Writes everything queued and closes the file
+     */
+    void Close();
+
+    bool IsOpen() const { return file != nullptr; }
+
+    /**
+     * @brief Queues a record, never touches the disk
+     * @param record Record to append, its timestamp may be raised
+     */
+    void Append(MMRHistoryRecord record);
+
+    /**
+     * @brief Waits until every record queued so far is written and synced
+     */
+    void Flush();
+
+    uint64_t Appended() const;
+    uint64_t Syncs() const;
+    uint64_t FailedRecords() const;
+
+private:
+    void Run();
+
+    /**
+     * @brief Writes and syncs one batch
+     * @return False if the write or the sync failed
+     */
+    bool WriteBatch(const std::vector<MMRHistoryRecord>& batch);
+
+    std::FILE* file = nullptr;
+    std::chrono::milliseconds flushInterval{ 0 };
+
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable wake;      // Work for the writer thread
+    std::condition_variable written;   // A batch was written
+    std::vector<MMRHistoryRecord> pending;
+    bool flushRequested = false;
+    bool stopRequested = false;
+    int64_t lastTimestamp = 0;
+
+    uint64_t appended = 0;
+    uint64_t done = 0;                 // Appended records written or dropped
+    uint64_t syncs = 0;
+    uint64_t failedRecords = 0;
+};
+
+// ============================================================================
+// READER
+// ============================================================================
+
+/**
+ * @brief Zero-copy view of a mapped MMR history file
+ *
+ * Opening only checks the header, so it costs the same whatever the size of
+ * the history. Records are checked against their checksum as they are read.
+ * The view holds the records present when it was opened.
+ */
+class MMRHistory {
+public:
+    /**
+     * @brief Maps a history file and checks its header
+     * @param path History file
+     * @param error Receives the reason the file was rejected
+     * @return True if the file can be read
+     */
+    bool Open(const std::filesystem::path& path, std::string& error);
+
+    void Close();
+
+    bool IsOpen() const { return file.IsOpen(); }
+    size_t Count() const { return count; }
+
+    /**
+     * @brief Returns every record, including ones failing their checksum
+     */
+    std::span<const MMRHistoryRecord> All() const { return { records, count }; }
+
+    /**
+     * @brief Returns the records of a time range, found by binary search
+     * @param from First timestamp included
+     * @param to First timestamp excluded
+     * @return Records in timestamp order, not checked
+     */
+    std::span<const MMRHistoryRecord> Range(int64_t from, int64_t to) const;
+
+    /**
+     * @brief Returns the valid records of a playlist in a time range
+     * @param playlist Playlist ID, or 0 for every playlist
+     * @param from First timestamp included
+     * @param to First timestamp excluded
+     * @return Matching records in timestamp order
+     */
+    std::vector<MMRHistoryRecord> Query(int playlist, int64_t from, int64_t to) const;
+
+private:
+    MappedFile file;
+    const MMRHistoryRecord* records = nullptr;
+    size_t count = 0;
+};
+
+// ============================================================================
+// COMPACTION
+// ============================================================================
+
+/**
+ * @brief Rewrites a history file without its redundant records
+ *
+ * Drops records failing their checksum, records older than keepFrom, and
+ * readings that repeat the previous reading of their playlist without a
+ * match outcome. The file is rewritten next to the original and renamed
+ * over it, so it must not be open in a writer or a reader.
+ * @param path History file
+ * @param keepFrom Oldest timestamp kept, 0 to keep every age
+ * @param error Receives the reason the file was not compacted
+ * @return Number of records removed, or -1 on failure
+ */
+int64_t CompactMMRHistory(const std::filesystem::path& path, int64_t keepFrom, std::string& error);
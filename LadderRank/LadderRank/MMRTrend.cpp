@@ -0,0 +1,34 @@
+#include "MMRTrend.h"
+
+#include <cmath>
+
+void MMRTrend::Update(float mmr) {
+    if (!hasReading) {
+        hasReading = true;
+        lastMMR = mmr;
+        return;
+    }
+
+    float step = mmr - lastMMR;
+    lastMMR = mmr;
+    if (step == 0.0f || std::fabs(step) > MMR_TREND_MAX_STEP) {
+        return;
+    }
+
+    // The first step seeds the average instead of being pulled toward 0
+    if (step > 0.0f) {
+        gain = (gains == 0) ? step : gain + MMR_TREND_ALPHA * (step - gain);
+        gains++;
+    }
+    else {
+        loss = (losses == 0) ? -step : loss + MMR_TREND_ALPHA * (-step - loss);
+        losses++;
+    }
+}
+
+int ProjectMatches(float distance, float step) {
+    if (step <= 0.0f || distance <= 0.0f) {
+        return -1;
+    }
+    return static_cast<int>(std::ceil(distance / step));
+}
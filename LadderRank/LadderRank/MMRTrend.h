@@ -0,0 +1,38 @@
+#pragma once
+
+// ============================================================================
+// MMR TREND
+// ============================================================================
+
+constexpr float MMR_TREND_ALPHA = 0.25f;     // Weight of the newest match in the averages
+constexpr float MMR_TREND_MAX_STEP = 60.0f;  // Larger jumps are not one match (placements, resets)
+
+/**
+ * @brief Online estimate of the MMR won and lost per match in one playlist
+ *
+ * Each reading is compared with the previous one: a rise feeds the gain
+ * average, a drop the loss average, both exponentially weighted so recent
+ * matches count most. O(1) per reading. Has no BakkesMod dependency.
+ */
+struct MMRTrend {
+    bool hasReading = false;
+    float lastMMR = 0.0f;
+    float gain = 0.0f;       // Average MMR won per win, 0 until the first win
+    float loss = 0.0f;       // Average MMR lost per loss, 0 until the first loss
+    int gains = 0;           // Steps averaged into gain
+    int losses = 0;          // Steps averaged into loss
+
+    /**
+     * @brief Feeds a new MMR reading
+     * @param mmr MMR reading
+     */
+    void Update(float mmr);
+};
+
+/**
+ * @brief Number of matches needed to cover an MMR distance
+ * @param distance MMR left to gain or lose
+ * @param step Average MMR per match
+ * @return Matches, at least 1, or -1 if there is no estimate or nothing to cover
+ */
+int ProjectMatches(float distance, float step);
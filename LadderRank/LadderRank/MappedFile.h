@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+// ============================================================================
+// READ-ONLY MEMORY MAPPED FILE
+// ============================================================================
+
+/**
+ * @brief Maps a whole file read-only into memory
+ *
+ * Uses CreateFileMapping on Windows and mmap elsewhere so the data tools can
+ * share the loaders with the plugin.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file, unmapping any previous one
+     * @param path File to map
+     * @return True if the file exists, is not empty and was mapped
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /**
+     * @brief Unmaps the file
+     */
+    void Close();
+
+    const uint8_t* Data() const { return data; }
+    size_t Size() const { return size; }
+    bool IsOpen() const { return data != nullptr; }
+
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
@@ -0,0 +1,73 @@
+#include "PerfCounters.h"
+
+#if LADDERRANK_PERF
+
+#include <algorithm>
+#include <numeric>
+
+// ============================================================================
+// PROBES
+// ============================================================================
+
+const char* PerfProbeName(PerfProbe probe) {
+    switch (probe) {
+    case PerfProbe::RenderCanvas:
+        return "Canvas";
+    case PerfProbe::Render:
+        return "ImGui";
+    case PerfProbe::MMRUpdate:
+        return "MMR update";
+    default:
+        return "?";
+    }
+}
+
+// ============================================================================
+// AGGREGATES
+// ============================================================================
+
+PerfStats SummarizePerf(std::vector<float>& samples) {
+    PerfStats stats;
+    stats.samples = samples.size();
+    if (samples.empty()) {
+        return stats;
+    }
+
+    stats.average = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+
+    // Nearest rank, p99 of fewer than 100 samples is their maximum
+    auto rank = [&](double percentile) {
+        size_t index = static_cast<size_t>(percentile * (samples.size() - 1) + 0.5);
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return static_cast<double>(samples[index]);
+    };
+    stats.p50 = rank(0.50);
+    stats.p99 = rank(0.99);
+    stats.max = *std::max_element(samples.begin(), samples.end());
+    return stats;
+}
+
+// ============================================================================
+// RING
+// ============================================================================
+
+void PerfRing::Snapshot(std::vector<float>& out) const {
+    out.clear();
+
+    uint64_t end = head.load(std::memory_order_acquire);
+    uint64_t begin = std::max(floor.load(std::memory_order_relaxed), end > PERF_RING_SIZE ? end - PERF_RING_SIZE : 0);
+    for (uint64_t i = begin; i < end; i++) {
+        out.push_back(samples[i & (PERF_RING_SIZE - 1)].load(std::memory_order_relaxed));
+    }
+
+    // Slots the writer reused during the copy hold newer samples, drop them.
+    // Sample `now` may be half way in, so its slot counts as reused too.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t now = head.load(std::memory_order_relaxed);
+    if (now + 1 > begin + PERF_RING_SIZE) {
+        size_t reused = static_cast<size_t>(std::min<uint64_t>(now + 1 - begin - PERF_RING_SIZE, out.size()));
+        out.erase(out.begin(), out.begin() + reused);
+    }
+}
+
+#endif
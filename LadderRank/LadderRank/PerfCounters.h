@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// PERFORMANCE COUNTERS
+// ============================================================================
+//
+// Timers around the plugin's per-frame and per-update work. Build with
+// LADDERRANK_PERF=0 to compile them out: LADDERRANK_PERF_SCOPE() then
+// expands to nothing and the plugin leaves out its rings, the
+// ladderrank_perf command and the settings graphs.
+
+#ifndef LADDERRANK_PERF
+#define LADDERRANK_PERF 1
+#endif
+
+constexpr size_t PERF_RING_SIZE = 1024;  // Samples kept per probe, a power of two
+
+/**
+ * @brief What a PerfRing times
+ */
+enum class PerfProbe {
+    RenderCanvas,  // Game thread, every frame the overlay is drawn
+    Render,        // Render thread, every frame the ImGui window is open
+    MMRUpdate,     // Game thread, MMR notifier and scheduled refreshes
+    Count
+};
+
+constexpr size_t PERF_PROBE_COUNT = static_cast<size_t>(PerfProbe::Count);
+
+/**
+ * @brief Returns the display name of a probe
+ */
+const char* PerfProbeName(PerfProbe probe);
+
+/**
+ * @brief Aggregates over a window of samples, in microseconds
+ */
+struct PerfStats {
+    size_t samples = 0;      // Samples in the window
+    double average = 0.0;
+    double p50 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * @brief Computes the aggregates of a set of samples
+ * @param samples Durations in microseconds, reordered
+ */
+PerfStats SummarizePerf(std::vector<float>& samples);
+
+/**
+ * @brief Keeps the last PERF_RING_SIZE durations of one probe, lock-free
+ *
+ * One writer thread calls Record(), any thread reads. The writer stores the
+ * sample and then publishes the new head. A reader copies back from the
+ * head and drops the slots the writer may have reused while it copied.
+ */
+class PerfRing {
+public:
+    /**
+     * @brief Adds a sample, wait-free, writer thread only
+     * @param microseconds Duration to record
+     */
+    void Record(float microseconds) {
+        uint64_t index = head.load(std::memory_order_relaxed);
+        // A reader that sees this sample also sees the head before it
+        std::atomic_thread_fence(std::memory_order_release);
+        samples[index & (PERF_RING_SIZE - 1)].store(microseconds, std::memory_order_relaxed);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies the samples recorded since the last Reset(), oldest first
+     * @param out Receives at most PERF_RING_SIZE samples, its capacity is reused
+     */
+    void Snapshot(std::vector<float>& out) const;
+
+    /**
+     * @brief Starts a new window, samples recorded before are no longer read
+     */
+    void Reset() { floor.store(head.load(std::memory_order_acquire), std::memory_order_relaxed); }
+
+    /**
+     * @brief Samples recorded since the plugin loaded
+     */
+    uint64_t Recorded() const { return head.load(std::memory_order_relaxed); }
+
+private:
+    std::array<std::atomic<float>, PERF_RING_SIZE> samples{};
+    std::atomic<uint64_t> head{ 0 };   // Samples recorded so far
+    std::atomic<uint64_t> floor{ 0 };  // Head at the last Reset()
+};
+
+/**
+ * @brief Records the lifetime of a scope into a PerfRing
+ */
+class PerfTimer {
+public:
+    explicit PerfTimer(PerfRing& ring)
+        : ring(ring), start(std::chrono::steady_clock::now()) {
+    }
+
+    ~PerfTimer() {
+        ring.Record(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    PerfTimer(const PerfTimer&) = delete;
+    PerfTimer& operator=(const PerfTimer&) = delete;
+
+private:
+    PerfRing& ring;
+    std::chrono::steady_clock::time_point start;
+};
+
+#if LADDERRANK_PERF
+#define LADDERRANK_PERF_CONCAT_(a, b) a##b
+#define LADDERRANK_PERF_CONCAT(a, b) LADDERRANK_PERF_CONCAT_(a, b)
+#define LADDERRANK_PERF_SCOPE(ring) PerfTimer LADDERRANK_PERF_CONCAT(perfTimer, __LINE__)(ring)
+#else
+#define LADDERRANK_PERF_SCOPE(ring) ((void)0)
+#endif
@@ -0,0 +1,87 @@
+#include "RankBinary.h"
+
+uint32_t Fnv1a(const uint8_t* data, size_t size, uint32_t hash) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool RankBinaryView::Open(const std::filesystem::path& path, std::string& error) {
+    header = nullptr;
+    directory = nullptr;
+
+    if (!file.Open(path)) {
+        error = "cannot map " + path.string();
+        return false;
+    }
+
+    const uint8_t* data = file.Data();
+    size_t size = file.Size();
+
+    if (size < sizeof(RankBinaryHeader)) {
+        error = "truncated header";
+        return false;
+    }
+
+    const auto* candidate = reinterpret_cast<const RankBinaryHeader*>(data);
+    if (candidate->magic != RANK_BINARY_MAGIC) {
+        error = "bad magic";
+        return false;
+    }
+    if (candidate->version != RANK_BINARY_VERSION) {
+        error = "unsupported version " + std::to_string(candidate->version);
+        return false;
+    }
+
+    size_t directoryEnd = sizeof(RankBinaryHeader) + candidate->playlistCount * sizeof(RankBinaryPlaylist);
+    size_t columnBytes = candidate->entryCount * sizeof(int32_t);
+    if (directoryEnd > size) {
+        error = "truncated directory";
+        return false;
+    }
+
+    const auto* entries = reinterpret_cast<const RankBinaryPlaylist*>(data + sizeof(RankBinaryHeader));
+    for (uint32_t i = 0; i < candidate->playlistCount; i++) {
+        size_t offset = entries[i].offset;
+        if (offset % alignof(int32_t) != 0 || offset < directoryEnd || offset + RANK_BINARY_COLUMNS * columnBytes > size) {
+            error = "bad column offset for playlist " + std::to_string(entries[i].playlist);
+            return false;
+        }
+    }
+
+    uint32_t checksum = Fnv1a(data + sizeof(RankBinaryHeader), size - sizeof(RankBinaryHeader));
+    if (checksum != candidate->checksum) {
+        error = "checksum mismatch";
+        return false;
+    }
+
+    header = candidate;
+    directory = entries;
+    return true;
+}
+
+int RankBinaryView::PlaylistCount() const {
+    return header ? static_cast<int>(header->playlistCount) : 0;
+}
+
+int RankBinaryView::EntryCount() const {
+    return header ? static_cast<int>(header->entryCount) : 0;
+}
+
+const RankBinaryPlaylist& RankBinaryView::Playlist(int index) const {
+    return directory[index];
+}
+
+const int32_t* RankBinaryView::MinColumn(int index) const {
+    return reinterpret_cast<const int32_t*>(file.Data() + directory[index].offset);
+}
+
+const int32_t* RankBinaryView::MaxColumn(int index) const {
+    return MinColumn(index) + header->entryCount;
+}
+
+const int32_t* RankBinaryView::PlayersColumn(int index) const {
+    return MaxColumn(index) + header->entryCount;
+}
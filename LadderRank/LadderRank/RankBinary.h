@@ -0,0 +1,78 @@
+#pragma once
+
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// ============================================================================
+// BINARY RANK THRESHOLD FORMAT
+// ============================================================================
+//
+// Little endian, every field 4-byte aligned:
+//
+//   RankBinaryHeader
+//   RankBinaryPlaylist[playlistCount]
+//   per playlist: int32 minMMR[entryCount], int32 maxMMR[entryCount],
+//                 int32 players[entryCount]
+//
+// Entries are stored [tier][division] like PlaylistThresholds. The checksum
+// covers everything after the header. Each directory entry remembers the size
+// and hash of the JSON file it was built from so stale files can be detected.
+
+constexpr uint32_t RANK_BINARY_MAGIC = 0x4B4E524C;  // "LRNK"
+constexpr uint32_t RANK_BINARY_VERSION = 2;        // 2 added the players column
+constexpr uint32_t RANK_BINARY_COLUMNS = 3;        // minMMR, maxMMR, players
+
+struct RankBinaryHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t playlistCount;
+    uint32_t entryCount;     // Tier/division entries per playlist
+    uint32_t checksum;       // FNV-1a of everything after the header
+    uint32_t reserved;
+};
+
+struct RankBinaryPlaylist {
+    int32_t playlist;
+    uint32_t sourceSize;     // Size of the JSON file the columns came from
+    uint32_t sourceHash;     // FNV-1a of that JSON file
+    uint32_t offset;         // File offset of the minMMR column
+};
+
+/**
+ * @brief 32-bit FNV-1a hash
+ * @param data Bytes to hash
+ * @param size Number of bytes
+ * @param hash Running hash to continue from
+ * @return Updated hash
+ */
+uint32_t Fnv1a(const uint8_t* data, size_t size, uint32_t hash = 2166136261u);
+
+/**
+ * @brief Validated, zero-copy view of a mapped rank threshold binary
+ */
+class RankBinaryView {
+public:
+    /**
+     * @brief Maps a binary and checks its header, layout and checksum
+     * @param path Binary file
+     * @param error Receives the reason the file was rejected
+     * @return True if the file can be read
+     */
+    bool Open(const std::filesystem::path& path, std::string& error);
+
+    int PlaylistCount() const;
+    int EntryCount() const;
+    const RankBinaryPlaylist& Playlist(int index) const;
+    const int32_t* MinColumn(int index) const;
+    const int32_t* MaxColumn(int index) const;
+    const int32_t* PlayersColumn(int index) const;
+
+private:
+    MappedFile file;
+    const RankBinaryHeader* header = nullptr;
+    const RankBinaryPlaylist* directory = nullptr;
+};
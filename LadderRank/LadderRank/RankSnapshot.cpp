@@ -0,0 +1,162 @@
+#include "RankSnapshot.h"
+#include "MMRTrend.h"
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+std::string GetDivName(int rank, int div) {
+    if (rank < 0 || rank > 22) {
+        return "ERROR";
+    }
+
+    if (rank == 0 || rank == 22) {
+        return " ";
+    }
+
+    const std::string divNumbers[] = { "I", "II", "III", "IV" };
+    return "DIV " + divNumbers[div];
+}
+
+// ============================================================================
+// ADJACENT RANKS
+// ============================================================================
+
+static void HandlePlacementMatches(const RankTable& table, RankSnapshot& snapshot) {
+    snapshot.lowerTier = 1;
+    snapshot.upperTier = 22;
+
+    snapshot.nextLower = table.Lookup(snapshot.playlist, snapshot.upperTier, 0, true);
+    snapshot.nameNext = GetDivName(22, 0);
+
+    snapshot.beforeUpper = table.Lookup(snapshot.playlist, snapshot.lowerTier, 0, false);
+    snapshot.nameBefore = GetDivName(0, 0);
+}
+
+static void HandleLowestRank(const RankTable& table, RankSnapshot& snapshot) {
+    snapshot.upperTier = snapshot.tier;
+    snapshot.lowerTier = snapshot.tier;
+    snapshot.upperDiv = snapshot.division + 1;
+    snapshot.lowerDiv = 0;
+
+    snapshot.nextLower = table.Lookup(snapshot.playlist, snapshot.upperTier, snapshot.upperDiv, false);
+    snapshot.nameNext = GetDivName(snapshot.upperTier, snapshot.upperDiv);
+
+    snapshot.beforeUpper = table.Lookup(snapshot.playlist, snapshot.lowerTier, snapshot.lowerDiv, false);
+    snapshot.nameBefore = GetDivName(snapshot.lowerTier, snapshot.lowerDiv);
+}
+
+static void HandleHighestRank(const RankTable& table, RankSnapshot& snapshot) {
+    snapshot.upperTier = snapshot.tier;
+    snapshot.lowerTier = snapshot.tier - 1;
+    snapshot.upperDiv = 0;
+    snapshot.lowerDiv = 3;
+
+    snapshot.nextLower = table.Lookup(snapshot.playlist, snapshot.tier, 0, true);
+    snapshot.nameNext = GetDivName(snapshot.tier, 0);
+
+    snapshot.beforeUpper = table.Lookup(snapshot.playlist, snapshot.lowerTier, snapshot.lowerDiv, true);
+    snapshot.nameBefore = GetDivName(snapshot.lowerTier, snapshot.lowerDiv);
+}
+
+static void HandleNormalRank(const RankTable& table, RankSnapshot& snapshot) {
+    if (snapshot.division == 0) {
+        // First division of a rank
+        snapshot.upperTier = snapshot.tier;
+        snapshot.lowerTier = snapshot.tier - 1;
+        snapshot.upperDiv = snapshot.division + 1;
+        snapshot.lowerDiv = 3;
+    }
+    else if (snapshot.division == 3) {
+        // Last division of a rank
+        snapshot.upperTier = snapshot.tier + 1;
+        snapshot.lowerTier = snapshot.tier;
+        snapshot.upperDiv = 0;
+        snapshot.lowerDiv = snapshot.division - 1;
+    }
+    else {
+        // Middle divisions
+        snapshot.upperTier = snapshot.tier;
+        snapshot.lowerTier = snapshot.tier;
+        snapshot.upperDiv = snapshot.division + 1;
+        snapshot.lowerDiv = snapshot.division - 1;
+    }
+
+    snapshot.nextLower = table.Lookup(snapshot.playlist, snapshot.upperTier, snapshot.upperDiv, false);
+    snapshot.nameNext = GetDivName(snapshot.upperTier, snapshot.upperDiv);
+
+    snapshot.beforeUpper = table.Lookup(snapshot.playlist, snapshot.lowerTier, snapshot.lowerDiv, true);
+    snapshot.nameBefore = GetDivName(snapshot.lowerTier, snapshot.lowerDiv);
+}
+
+// ============================================================================
+// SNAPSHOT BUILDING
+// ============================================================================
+
+RankSnapshot BuildRankSnapshot(const RankTable& table, uint64_t tableGeneration,
+    int playlist, float mmr, int tier, int division, float mmrGain, float mmrLoss) {
+    RankSnapshot snapshot;
+    snapshot.playlist = playlist;
+    snapshot.tableGeneration = tableGeneration;
+    snapshot.mmr = mmr;
+    snapshot.reportedTier = tier;
+    snapshot.reportedDivision = division;
+    snapshot.mmrGain = mmrGain;
+    snapshot.mmrLoss = mmrLoss;
+    snapshot.tier = tier;
+    snapshot.division = division;
+
+    // Derive the rank from the MMR if the server did not report a usable one
+    if (tier < 0 || tier >= RANK_TIER_COUNT || division < 0 || division >= RANK_DIVISION_COUNT) {
+        RankPosition position = table.Locate(playlist, mmr);
+        snapshot.tier = position.tier;
+        snapshot.division = position.division;
+        snapshot.rankFromMMR = true;
+    }
+
+    snapshot.nameCurrent = GetDivName(snapshot.tier, snapshot.division);
+
+    // Calculate adjacent ranks based on division (for division thresholds)
+    if (snapshot.tier <= 0) {
+        HandlePlacementMatches(table, snapshot);
+    }
+    else if (snapshot.tier == 1 && snapshot.division == 0) {
+        HandleLowestRank(table, snapshot);
+    }
+    else if (snapshot.tier == 22) {
+        HandleHighestRank(table, snapshot);
+    }
+    else {
+        HandleNormalRank(table, snapshot);
+    }
+
+    // Calculate MMR for complete tiers (+/-1 tier) for display
+    int nextTierForDisplay = (snapshot.tier >= 22) ? 22 : snapshot.tier + 1;
+    int prevTierForDisplay = (snapshot.tier <= 1) ? 1 : snapshot.tier - 1;
+
+    // Minimum MMR of next tier (always Div I)
+    snapshot.nextTierMinMMR = table.Lookup(playlist, nextTierForDisplay, 0, false);
+
+    // Minimum MMR of current tier (falling below this drops you to lower tier)
+    snapshot.prevTierMaxMMR = table.Lookup(playlist, snapshot.tier, 0, false);
+
+    snapshot.topPercent = table.TopPercent(playlist, mmr);
+
+    // Projection done here so drawing it is a field read
+    snapshot.winsToNext = ProjectMatches(static_cast<float>(snapshot.nextLower) - mmr, mmrGain);
+    snapshot.lossesToPrevious = ProjectMatches(mmr - static_cast<float>(snapshot.beforeUpper), mmrLoss);
+    if (snapshot.winsToNext > 0) {
+        snapshot.projectionText = "~" + std::to_string(snapshot.winsToNext) + " W up";
+    }
+    if (snapshot.lossesToPrevious > 0) {
+        snapshot.projectionText += (snapshot.projectionText.empty() ? "~" : "  ~")
+            + std::to_string(snapshot.lossesToPrevious) + " L down";
+    }
+
+    // Icons always show tier +1 above and tier -1 below
+    snapshot.currentIcon = snapshot.tier;
+    snapshot.nextIcon = nextTierForDisplay;
+    snapshot.beforeIcon = prevTierForDisplay;
+
+    return snapshot;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "RankTable.h"
+
+#include <cstdint>
+#include <string>
+
+// ============================================================================
+// RANK SNAPSHOT
+// ============================================================================
+
+/**
+ * @brief Everything the overlay shows for one playlist, computed once per sync
+ *
+ * Immutable once built: switching the displayed playlist only swaps which
+ * snapshot is current, with no MMRWrapper query or threshold lookup.
+ * Has no BakkesMod dependency.
+ */
+struct RankSnapshot {
+    int playlist = 0;
+    uint64_t tableGeneration = 0;  // RankTableStore generation the thresholds come from
+
+    // Inputs, kept so a sync can tell whether anything changed
+    float mmr = 0.0f;
+    int reportedTier = 0;          // Tier reported by MMRWrapper
+    int reportedDivision = 0;      // Division reported by MMRWrapper
+    bool rankFromMMR = false;      // Reported rank was unusable, derived from the MMR
+    float mmrGain = 0.0f;          // Average MMR per win (MMRTrend), 0 if unknown
+    float mmrLoss = 0.0f;          // Average MMR per loss (MMRTrend), 0 if unknown
+
+    // Current rank information
+    int tier = 0;                  // Current tier (0-22)
+    int division = 0;              // Current division (0-3)
+
+    // Adjacent rank information (for division thresholds)
+    int upperTier = 0;
+    int lowerTier = 0;
+    int upperDiv = 0;
+    int lowerDiv = 0;
+
+    // MMR thresholds for divisions
+    int nextLower = 0;             // MMR for next division up
+    int beforeUpper = 0;           // MMR for previous division down
+
+    // MMR thresholds for complete tiers (for display)
+    int nextTierMinMMR = 0;        // Minimum MMR for tier +1
+    int prevTierMaxMMR = 0;        // Minimum MMR for current tier
+
+    // Share of the ranked population at or above the MMR, -1 when the
+    // RankNumbers files carry no player counts
+    float topPercent = -1.0f;
+
+    // Projected matches at the average gain/loss: wins to reach nextLower,
+    // losses to fall to beforeUpper. -1 without an estimate.
+    int winsToNext = -1;
+    int lossesToPrevious = -1;
+    std::string projectionText = "";  // Like "~3 W up  ~4 L down", empty without an estimate
+
+    // Rank display names
+    std::string nameCurrent = "";
+    std::string nameNext = "";
+    std::string nameBefore = "";
+
+    // Icon indices (RankIcons/<index>.png)
+    int currentIcon = 0;
+    int nextIcon = 0;
+    int beforeIcon = 0;
+
+    /**
+     * @brief Checks whether a sync would produce the same snapshot
+     * @param mmr MMR reported by the sync
+     * @param tier Tier reported by the sync
+     * @param division Division reported by the sync
+     * @param generation Current threshold table generation
+     * @return True if nothing the snapshot depends on changed
+     */
+    bool Matches(float mmr, int tier, int division, uint64_t generation) const {
+        return this->mmr == mmr && reportedTier == tier && reportedDivision == division
+            && tableGeneration == generation;
+    }
+};
+
+/**
+ * @brief Converts rank tier and division to display name
+ * @param rank Tier level (0-22)
+ * @param div Division within tier (0-3)
+ * @return Display name like "DIV I", "DIV II", etc.
+ */
+std::string GetDivName(int rank, int div);
+
+/**
+ * @brief Computes the snapshot of one playlist
+ *
+ * A tier/division outside the table is replaced by RankTable::Locate() on
+ * the MMR, so the snapshot is always usable.
+ * @param table Threshold table generation to read from
+ * @param tableGeneration Generation of the table
+ * @param playlist Playlist ID
+ * @param mmr Player MMR
+ * @param tier Tier reported by MMRWrapper
+ * @param division Division reported by MMRWrapper
+ * @param mmrGain Average MMR per win, 0 if unknown
+ * @param mmrLoss Average MMR per loss, 0 if unknown
+ * @return The snapshot
+ */
+RankSnapshot BuildRankSnapshot(const RankTable& table, uint64_t tableGeneration,
+    int playlist, float mmr, int tier, int division, float mmrGain = 0.0f, float mmrLoss = 0.0f);
@@ -0,0 +1,139 @@
+#include "RankSnapshotWorker.h"
+
+// ============================================================================
+// SNAPSHOT SET
+// ============================================================================
+
+std::shared_ptr<const RankSnapshot> RankSnapshotSet::Find(int playlist) const {
+    int slot = RankTable::PlaylistSlot(playlist);
+    return slot < 0 ? nullptr : snapshots[slot];
+}
+
+// ============================================================================
+// SNAPSHOT WORKER
+// ============================================================================
+
+RankSnapshotWorker::RankSnapshotWorker()
+    : current(std::make_shared<const RankSnapshotSet>()) {
+}
+
+RankSnapshotWorker::~RankSnapshotWorker() {
+    Stop();
+}
+
+void RankSnapshotWorker::Start(const RankTableStore& store, PublishCallback onPublish) {
+    Stop();
+
+    this->store = &store;
+    this->onPublish = std::move(onPublish);
+    stopRequested = false;
+
+    thread = std::thread(&RankSnapshotWorker::Run, this);
+}
+
+void RankSnapshotWorker::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+        pending = {};
+        workPending = false;
+    }
+    wake.notify_all();
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void RankSnapshotWorker::Submit(const std::vector<MMRSample>& samples) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const MMRSample& sample : samples) {
+            int slot = RankTable::PlaylistSlot(sample.playlist);
+            if (slot < 0) {
+                continue;
+            }
+            if (pending[slot]) {
+                mergedSamples++;
+            }
+            pending[slot] = sample;
+        }
+        workPending = true;
+    }
+    wake.notify_one();
+}
+
+void RankSnapshotWorker::Rebuild() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        workPending = true;
+    }
+    wake.notify_one();
+}
+
+void RankSnapshotWorker::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this]() { return stopRequested || workPending; });
+        if (stopRequested) {
+            break;
+        }
+
+        auto samples = pending;
+        pending = {};
+        workPending = false;
+        lock.unlock();
+
+        Build(samples);
+
+        lock.lock();
+    }
+}
+
+int RankSnapshotWorker::Build(const std::array<std::optional<MMRSample>, RANK_PLAYLIST_COUNT>& samples) {
+    // Pin one table generation so a concurrent reload cannot mix thresholds
+    RankTableStore::ReadGuard thresholds = store->Read();
+    uint64_t generation = thresholds.Generation();
+
+    // Only this thread publishes, so the current set cannot change under us
+    std::shared_ptr<const RankSnapshotSet> previous = current.load();
+    auto next = std::make_shared<RankSnapshotSet>(*previous);
+
+    int rebuilt = 0;
+    for (int slot = 0; slot < RANK_PLAYLIST_COUNT; slot++) {
+        auto& snapshot = next->snapshots[slot];
+
+        if (const auto& sample = samples[slot]) {
+            // Playlists whose MMR did not change keep their snapshot
+            if (snapshot && snapshot->Matches(sample->mmr, sample->tier, sample->division, generation)) {
+                continue;
+            }
+            snapshot = std::make_shared<const RankSnapshot>(BuildRankSnapshot(*thresholds, generation,
+                sample->playlist, sample->mmr, sample->tier, sample->division, sample->mmrGain, sample->mmrLoss));
+        }
+        else if (snapshot && snapshot->tableGeneration != generation) {
+            // Thresholds reloaded, rebuild from the snapshot's own inputs
+            snapshot = std::make_shared<const RankSnapshot>(BuildRankSnapshot(*thresholds, generation,
+                snapshot->playlist, snapshot->mmr, snapshot->reportedTier, snapshot->reportedDivision,
+                snapshot->mmrGain, snapshot->mmrLoss));
+        }
+        else {
+            continue;
+        }
+        rebuilt++;
+    }
+
+    if (rebuilt == 0) {
+        return 0;
+    }
+
+    next->version = previous->version + 1;
+    std::shared_ptr<const RankSnapshotSet> published = std::move(next);
+    current.store(published);
+    builds++;
+
+    if (onPublish) {
+        onPublish(std::move(published), rebuilt);
+    }
+    return rebuilt;
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "RankSnapshot.h"
+#include "RankTableStore.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// RAW MMR INPUT
+// ============================================================================
+
+/**
+ * @brief Rank data of one playlist exactly as MMRWrapper reported it
+ *
+ * Captured on the game thread, everything derived from it is computed by
+ * RankSnapshotWorker.
+ */
+struct MMRSample {
+    int playlist = 0;
+    float mmr = 0.0f;
+    int tier = 0;
+    int division = 0;
+
+    // MMRTrend averages after this reading, filled in on the game thread
+    float mmrGain = 0.0f;
+    float mmrLoss = 0.0f;
+
+    /**
+     * @brief Checks whether two samples hold the same MMRWrapper reading
+     */
+    bool SameReading(const MMRSample& other) const {
+        return playlist == other.playlist && mmr == other.mmr && tier == other.tier && division == other.division;
+    }
+
+    bool operator==(const MMRSample&) const = default;
+};
+
+/**
+ * @brief The snapshots of every ranked playlist, published as one unit
+ *
+ * Never modified once published. Readers keep the set alive by holding
+ * the shared_ptr, so a reader always sees snapshots from one build pass.
+ */
+struct RankSnapshotSet {
+    uint64_t version = 0;  // Bumped by every publish
+
+    // Indexed by RankTable::PlaylistSlot, empty until the playlist is synced
+    std::array<std::shared_ptr<const RankSnapshot>, RANK_PLAYLIST_COUNT> snapshots;
+
+    /**
+     * @brief Returns the snapshot of a playlist
+     * @param playlist Playlist ID
+     * @return Snapshot, or nullptr if the playlist has none yet
+     */
+    std::shared_ptr<const RankSnapshot> Find(int playlist) const;
+};
+
+// ============================================================================
+// SNAPSHOT WORKER
+// ============================================================================
+
+/**
+ * @brief Builds rank snapshots on a worker thread from captured MMR samples
+ *
+ * The game thread only reads MMRWrapper and hands the samples over with
+ * Submit(). The worker pins a threshold table, rebuilds the snapshots whose
+ * inputs or table generation changed, and publishes a new RankSnapshotSet
+ * through an atomic shared_ptr. Samples submitted while a build runs are
+ * merged, the newest sample of each playlist wins.
+ *
+ * Submit(), Rebuild() and Current() can be called from any thread.
+ * Has no BakkesMod dependency.
+ */
+class RankSnapshotWorker {
+public:
+    /**
+     * @brief Called on the worker thread after each publish
+     * @param published The set that just became current
+     * @param rebuilt Number of snapshots rebuilt by this pass
+     */
+    using PublishCallback = std::function<void(std::shared_ptr<const RankSnapshotSet> published, int rebuilt)>;
+
+    RankSnapshotWorker();
+    ~RankSnapshotWorker();
+
+    RankSnapshotWorker(const RankSnapshotWorker&) = delete;
+    RankSnapshotWorker& operator=(const RankSnapshotWorker&) = delete;
+
+    /**
+     * @brief Starts the worker thread, stopping any previous one
+     * @param store Thresholds the snapshots are built from, must outlive the worker
+     * @param onPublish Called after each publish
+     */
+    void Start(const RankTableStore& store, PublishCallback onPublish);
+
+    /**
+     * @brief Stops the worker thread and waits for it, pending samples are dropped
+     */
+    void Stop();
+
+    /**
+     * @brief Queues samples for the next build pass
+     * @param samples Samples of synced playlists, others keep their snapshot
+     */
+    void Submit(const std::vector<MMRSample>& samples);
+
+    /**
+     * @brief Queues a pass that rebuilds snapshots built from an older table
+     */
+    void Rebuild();
+
+    /**
+     * @brief Returns the current set, never null
+     */
+    std::shared_ptr<const RankSnapshotSet> Current() const { return current.load(); }
+
+    uint64_t Builds() const { return builds.load(); }
+    uint64_t MergedSamples() const { return mergedSamples.load(); }
+
+private:
+    void Run();
+
+    /**
+     * @brief Rebuilds what changed and publishes the result
+     * @return Number of snapshots rebuilt, nothing is published when 0
+     */
+    int Build(const std::array<std::optional<MMRSample>, RANK_PLAYLIST_COUNT>& samples);
+
+    const RankTableStore* store = nullptr;
+    PublishCallback onPublish;
+
+    std::atomic<std::shared_ptr<const RankSnapshotSet>> current;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::array<std::optional<MMRSample>, RANK_PLAYLIST_COUNT> pending;  // By playlist slot
+    bool workPending = false;
+    bool stopRequested = false;
+
+    std::atomic<uint64_t> builds{ 0 };         // Publishes so far
+    std::atomic<uint64_t> mergedSamples{ 0 };  // Samples replaced before the worker got to them
+};
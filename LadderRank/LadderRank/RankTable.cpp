@@ -0,0 +1,551 @@
+#include "RankTable.h"
+#include "RankBinary.h"
+#include "RankTablesEmbedded.h"
+#include "json.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using json = nlohmann::json;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Size and FNV-1a hash of a RankNumbers JSON file
+ * @return False if the file cannot be read
+ */
+static bool HashSourceFile(const std::filesystem::path& file, uint32_t& size, uint32_t& hash) {
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    size = static_cast<uint32_t>(bytes.size());
+    hash = Fnv1a(bytes.data(), bytes.size());
+    return true;
+}
+
+/**
+ * @brief Lists the divisions a loaded playlist is missing
+ * @param present Which [tier][division] entries the file provided
+ * @return Comma separated "tier/division" pairs, empty if there is no gap
+ */
+static std::string FindGaps(const std::array<bool, RANK_TIER_COUNT * RANK_DIVISION_COUNT>& present) {
+    std::string gaps;
+    for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+        for (int div = 0; div < RankDivisionCount(tier); div++) {
+            if (!present[tier * RANK_DIVISION_COUNT + div]) {
+                gaps += (gaps.empty() ? "" : ", ") + std::to_string(tier) + "/" + std::to_string(div);
+            }
+        }
+    }
+    return gaps;
+}
+
+/**
+ * @brief SAX handler pulling the thresholds out of a RankNumbers file
+ *
+ * Only data.data[*] objects are read. The tiers, divisions and playlists
+ * arrays are skipped as they stream past and no basic_json is ever built.
+ * Each entry is stored at its own tier/division.
+ */
+class RankFileHandler : public nlohmann::json_sax<json> {
+public:
+    explicit RankFileHandler(PlaylistThresholds& table) : table(table) {}
+
+    std::string error;
+    std::array<bool, RANK_TIER_COUNT * RANK_DIVISION_COUNT> present{};
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_float(number_float_t, const string_t&) override { return true; }
+    bool string(string_t&) override { return true; }
+    bool binary(binary_t&) override { return true; }
+
+    bool number_integer(number_integer_t value) override {
+        return Number(static_cast<int64_t>(value));
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        return Number(static_cast<int64_t>(value));
+    }
+
+    bool start_object(std::size_t) override {
+        return Enter();
+    }
+
+    bool start_array(std::size_t) override {
+        return Enter();
+    }
+
+    bool end_object() override {
+        return Leave();
+    }
+
+    bool end_array() override {
+        return Leave();
+    }
+
+    bool key(string_t& name) override {
+        if (skipDepth != 0) {
+            return true;
+        }
+
+        if (depth == ENTRY_DEPTH) {
+            field = (name == "minMMR") ? Field::MinMMR
+                : (name == "maxMMR") ? Field::MaxMMR
+                : (name == "tier") ? Field::Tier
+                : (name == "division") ? Field::Division
+                : (name == "players") ? Field::Players
+                : Field::None;
+        }
+        else {
+            keyIsData = (name == "data");
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& e) override {
+        error = e.what();
+        return false;
+    }
+
+private:
+    // Nesting of the values we keep: { "data": { "data": [ { entry } ] } }
+    static constexpr int ENTRY_DEPTH = 4;
+
+    enum class Field { None, MinMMR, MaxMMR, Tier, Division, Players };
+
+    static constexpr int ALL_FIELDS = 15;  // players is optional
+
+    bool Enter() {
+        depth++;
+        if (skipDepth != 0) {
+            return true;
+        }
+
+        bool wanted = (depth == 1) || (depth <= 3 && keyIsData) || (depth == ENTRY_DEPTH);
+        if (!wanted) {
+            skipDepth = depth;
+        }
+        else if (depth == ENTRY_DEPTH) {
+            field = Field::None;
+            entry = RankThreshold();
+            tier = 0;
+            division = 0;
+            players = 0;
+            seenFields = 0;
+        }
+        keyIsData = false;
+        return true;
+    }
+
+    bool Leave() {
+        if (skipDepth == depth) {
+            skipDepth = 0;
+        }
+        else if (skipDepth == 0 && depth == ENTRY_DEPTH && !StoreEntry()) {
+            return false;
+        }
+        depth--;
+        return true;
+    }
+
+    bool Number(int64_t value) {
+        if (skipDepth != 0 || depth != ENTRY_DEPTH) {
+            return true;
+        }
+
+        if (field == Field::MinMMR) {
+            entry.minMMR = static_cast<int32_t>(value);
+            seenFields |= 1;
+        }
+        else if (field == Field::MaxMMR) {
+            entry.maxMMR = static_cast<int32_t>(value);
+            seenFields |= 2;
+        }
+        else if (field == Field::Tier) {
+            tier = value;
+            seenFields |= 4;
+        }
+        else if (field == Field::Division) {
+            division = value;
+            seenFields |= 8;
+        }
+        else if (field == Field::Players) {
+            players = static_cast<int32_t>(std::clamp<int64_t>(value, 0, INT32_MAX));
+        }
+        field = Field::None;
+        return true;
+    }
+
+    bool StoreEntry() {
+        size_t i = entryCount++;
+        if (seenFields != ALL_FIELDS) {
+            error = "entry " + std::to_string(i) + " lacks tier, division, minMMR or maxMMR";
+            return false;
+        }
+
+        if (tier < 0 || tier >= RANK_TIER_COUNT || division < 0 || division >= RankDivisionCount(static_cast<int>(tier))) {
+            error = "entry " + std::to_string(i) + " has no slot for tier " + std::to_string(tier)
+                + " division " + std::to_string(division);
+            return false;
+        }
+
+        size_t index = static_cast<size_t>(tier * RANK_DIVISION_COUNT + division);
+        if (present[index]) {
+            error = "entry " + std::to_string(i) + " repeats tier " + std::to_string(tier)
+                + " division " + std::to_string(division);
+            return false;
+        }
+
+        present[index] = true;
+        table.entries[index] = entry;
+        table.players[index] = players;
+        return true;
+    }
+
+    PlaylistThresholds& table;
+
+    int depth = 0;
+    int skipDepth = 0;       // Depth of the subtree being skipped, 0 when reading
+    bool keyIsData = false;  // Last key above the entries was "data"
+    Field field = Field::None;
+
+    RankThreshold entry;
+    int64_t tier = 0;
+    int64_t division = 0;
+    int32_t players = 0;
+    int seenFields = 0;
+    size_t entryCount = 0;
+};
+
+// ============================================================================
+// SEARCH INDEX
+// ============================================================================
+
+void RankTable::BuildSearchIndex(PlaylistThresholds& table) {
+    // Bronze I Div I through Grand Champion III Div IV, then Supersonic Legend
+    std::array<uint8_t, RANK_SEARCH_SIZE> order{};
+    int count = 0;
+    for (int tier = 1; tier < RANK_TIER_COUNT; tier++) {
+        for (int div = 0; div < RankDivisionCount(tier); div++) {
+            order[count++] = static_cast<uint8_t>(tier * RANK_DIVISION_COUNT + div);
+        }
+    }
+
+    std::stable_sort(order.begin(), order.begin() + count, [&table](uint8_t a, uint8_t b) {
+        return table.entries[a].minMMR < table.entries[b].minMMR;
+        });
+
+    table.searchKeys.fill(INT32_MAX);
+    table.searchEntries.fill(order[count - 1]);
+    int64_t players = 0;
+    for (int i = 0; i < count; i++) {
+        table.searchKeys[i] = table.entries[order[i]].minMMR;
+        table.searchEntries[i] = order[i];
+        table.playersBelow[i] = players;
+        players += table.players[order[i]];
+    }
+    std::fill(table.playersBelow.begin() + count, table.playersBelow.end(), players - table.players[order[count - 1]]);
+    table.totalPlayers = players;
+    table.searchCount = count;
+}
+
+// ============================================================================
+// LOADING
+// ============================================================================
+
+void RankTable::LoadEmbeddedDefaults() {
+    for (const EmbeddedRankTable& embedded : EMBEDDED_RANK_TABLES) {
+        PlaylistThresholds& table = playlists[PlaylistSlot(embedded.playlist)];
+        table.playlist = embedded.playlist;
+        std::copy(std::begin(embedded.entries), std::end(embedded.entries), table.entries.begin());
+        std::copy(std::begin(embedded.players), std::end(embedded.players), table.players.begin());
+        BuildSearchIndex(table);
+        table.loaded = true;
+    }
+}
+
+bool RankTable::LoadPlaylistFile(int playlist, const std::filesystem::path& file, std::string& error) {
+    int slot = PlaylistSlot(playlist);
+    if (slot < 0) {
+        error = "playlist " + std::to_string(playlist) + " is not ranked";
+        return false;
+    }
+
+    MappedFile source;
+    if (!source.Open(file)) {
+        error = "cannot open " + file.string();
+        return false;
+    }
+
+    PlaylistThresholds table;
+    table.playlist = playlist;
+
+    RankFileHandler handler(table);
+    const char* begin = reinterpret_cast<const char*>(source.Data());
+    if (!json::sax_parse(begin, begin + source.Size(), &handler)) {
+        error = file.string() + ": " + handler.error;
+        return false;
+    }
+
+    std::string gaps = FindGaps(handler.present);
+    if (!gaps.empty()) {
+        error = file.string() + ": missing tier/division " + gaps;
+        return false;
+    }
+
+    BuildSearchIndex(table);
+    table.loaded = true;
+    playlists[slot] = table;
+    return true;
+}
+
+int RankTable::LoadFolder(const std::filesystem::path& folder, std::string& error) {
+    int loaded = 0;
+
+    for (int playlist : rankedPlaylists) {
+        std::string fileError;
+        if (LoadPlaylistFile(playlist, folder / (std::to_string(playlist) + ".json"), fileError)) {
+            loaded++;
+        }
+        else {
+            error += fileError + "\n";
+        }
+    }
+
+    return loaded;
+}
+
+bool RankTable::LoadBinary(const std::filesystem::path& file, const std::filesystem::path& jsonFolder, std::string& error) {
+    RankBinaryView view;
+    if (!view.Open(file, error)) {
+        return false;
+    }
+
+    if (view.EntryCount() != RANK_TIER_COUNT * RANK_DIVISION_COUNT) {
+        error = "unexpected entry count " + std::to_string(view.EntryCount());
+        return false;
+    }
+
+    std::array<PlaylistThresholds, RANK_PLAYLIST_COUNT> loadedPlaylists = playlists;
+
+    for (int i = 0; i < view.PlaylistCount(); i++) {
+        const RankBinaryPlaylist& source = view.Playlist(i);
+        int slot = PlaylistSlot(source.playlist);
+        if (slot < 0) {
+            continue;
+        }
+
+        // A JSON file edited after the binary was built wins over the binary
+        uint32_t size = 0;
+        uint32_t hash = 0;
+        auto jsonFile = jsonFolder / (std::to_string(source.playlist) + ".json");
+        if (HashSourceFile(jsonFile, size, hash) && (size != source.sourceSize || hash != source.sourceHash)) {
+            error = "stale: " + jsonFile.string() + " changed since the binary was built";
+            return false;
+        }
+
+        PlaylistThresholds& table = loadedPlaylists[slot];
+        const int32_t* minColumn = view.MinColumn(i);
+        const int32_t* maxColumn = view.MaxColumn(i);
+        const int32_t* playersColumn = view.PlayersColumn(i);
+        for (size_t e = 0; e < table.entries.size(); e++) {
+            table.entries[e].minMMR = minColumn[e];
+            table.entries[e].maxMMR = maxColumn[e];
+            table.players[e] = playersColumn[e];
+        }
+        table.playlist = source.playlist;
+        BuildSearchIndex(table);
+        table.loaded = true;
+    }
+
+    playlists = loadedPlaylists;
+    return true;
+}
+
+bool RankTable::SaveBinary(const std::filesystem::path& file, const std::filesystem::path& jsonFolder, std::string& error) const {
+    constexpr uint32_t entryCount = RANK_TIER_COUNT * RANK_DIVISION_COUNT;
+
+    std::vector<RankBinaryPlaylist> directory;
+    for (const PlaylistThresholds& table : playlists) {
+        if (!table.loaded) {
+            continue;
+        }
+
+        RankBinaryPlaylist entry{};
+        entry.playlist = table.playlist;
+        if (!HashSourceFile(jsonFolder / (std::to_string(table.playlist) + ".json"), entry.sourceSize, entry.sourceHash)) {
+            error = "cannot read source of playlist " + std::to_string(table.playlist);
+            return false;
+        }
+        directory.push_back(entry);
+    }
+
+    // Directory first, then a minMMR, maxMMR and players column per playlist
+    std::vector<uint8_t> body(directory.size() * sizeof(RankBinaryPlaylist));
+    for (size_t i = 0; i < directory.size(); i++) {
+        const PlaylistThresholds& table = playlists[PlaylistSlot(directory[i].playlist)];
+        directory[i].offset = static_cast<uint32_t>(sizeof(RankBinaryHeader) + body.size());
+
+        std::vector<int32_t> columns(RANK_BINARY_COLUMNS * entryCount);
+        for (uint32_t e = 0; e < entryCount; e++) {
+            columns[e] = table.entries[e].minMMR;
+            columns[entryCount + e] = table.entries[e].maxMMR;
+            columns[2 * entryCount + e] = table.players[e];
+        }
+
+        const auto* bytes = reinterpret_cast<const uint8_t*>(columns.data());
+        body.insert(body.end(), bytes, bytes + columns.size() * sizeof(int32_t));
+    }
+    std::memcpy(body.data(), directory.data(), directory.size() * sizeof(RankBinaryPlaylist));
+
+    RankBinaryHeader header{};
+    header.magic = RANK_BINARY_MAGIC;
+    header.version = RANK_BINARY_VERSION;
+    header.playlistCount = static_cast<uint32_t>(directory.size());
+    header.entryCount = entryCount;
+    header.checksum = Fnv1a(body.data(), body.size());
+
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        error = "cannot create " + file.string();
+        return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(body.data()), static_cast<std::streamsize>(body.size()));
+    if (!stream) {
+        error = "cannot write " + file.string();
+        return false;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+int RankTable::Lookup(int playlist, int tier, int div, bool upperLimit) const {
+    static constexpr RankThreshold outOfRange{};
+
+    // Every test is a select rather than a branch: invalid arguments read
+    // the zero entry instead of returning early.
+    int slot = PlaylistSlot(playlist);
+    bool valid = (slot >= 0)
+        & (static_cast<unsigned>(tier) < static_cast<unsigned>(RANK_TIER_COUNT))
+        & (static_cast<unsigned>(div) < static_cast<unsigned>(RANK_DIVISION_COUNT));
+    const PlaylistThresholds& table = playlists[valid ? slot : 0];
+    size_t index = valid ? static_cast<size_t>(tier * RANK_DIVISION_COUNT + div) : 0;
+
+    const RankThreshold& entry = valid ? table.entries[index] : outOfRange;
+    return upperLimit ? entry.maxMMR : entry.minMMR;
+}
+
+RankPosition RankTable::Locate(int playlist, float mmr) const {
+    int slot = PlaylistSlot(playlist);
+    if (slot < 0 || !playlists[slot].loaded) {
+        return RankPosition();
+    }
+    return LocateIn(playlists[slot], mmr);
+}
+
+void RankTable::LocateMany(int playlist, const float* mmr, RankPosition* positions, size_t count) const {
+    int slot = PlaylistSlot(playlist);
+    if (slot < 0 || !playlists[slot].loaded) {
+        std::fill(positions, positions + count, RankPosition());
+        return;
+    }
+
+    const PlaylistThresholds& table = playlists[slot];
+    for (size_t i = 0; i < count; i++) {
+        positions[i] = LocateIn(table, mmr[i]);
+    }
+}
+
+float RankTable::TopPercent(int playlist, float mmr) const {
+    int slot = PlaylistSlot(playlist);
+    if (slot < 0 || !std::isfinite(mmr) || !playlists[slot].loaded || playlists[slot].totalPlayers <= 0) {
+        return -1.0f;
+    }
+
+    const PlaylistThresholds& table = playlists[slot];
+    int i = SearchIn(table, mmr);
+    int index = table.searchEntries[i];
+    const RankThreshold& entry = table.entries[index];
+
+    // Assume players are spread evenly over the MMR range of their division
+    float width = static_cast<float>(entry.maxMMR - entry.minMMR);
+    float inside = (width > 0.0f) ? std::clamp((mmr - entry.minMMR) / width, 0.0f, 1.0f) : 0.0f;
+    double below = static_cast<double>(table.playersBelow[i]) + table.players[index] * static_cast<double>(inside);
+
+    return static_cast<float>(100.0 * (table.totalPlayers - below) / table.totalPlayers);
+}
+
+int RankTable::SearchIn(const PlaylistThresholds& table, float mmr) {
+    // NaN and out of range floats have no defined int32_t conversion. Clamp
+    // below the INT32_MAX padding key so the search never lands on padding.
+    if (!std::isfinite(mmr)) {
+        return 0;
+    }
+    double clamped = std::clamp(static_cast<double>(mmr), static_cast<double>(INT32_MIN), static_cast<double>(INT32_MAX - 1));
+    int32_t value = static_cast<int32_t>(clamped);
+
+    // Last key <= value. The loop has a fixed trip count and the select
+    // compiles to a conditional move, so there is no data dependent branch.
+    const int32_t* base = table.searchKeys.data();
+    size_t n = RANK_SEARCH_SIZE;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half] <= value) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<int>(base - table.searchKeys.data());
+}
+
+RankPosition RankTable::LocateIn(const PlaylistThresholds& table, float mmr) {
+    int i = SearchIn(table, mmr);
+
+    int index = table.searchEntries[i];
+    const RankThreshold& entry = table.entries[index];
+
+    RankPosition position;
+    position.tier = index / RANK_DIVISION_COUNT;
+    position.division = index % RANK_DIVISION_COUNT;
+    position.minMMR = entry.minMMR;
+    position.maxMMR = entry.maxMMR;
+    position.nextMinMMR = (i + 1 < table.searchCount) ? table.entries[table.searchEntries[i + 1]].minMMR : entry.maxMMR;
+    position.prevMaxMMR = (i > 0) ? table.entries[table.searchEntries[i - 1]].maxMMR : entry.minMMR;
+    return position;
+}
+
+bool RankTable::HasPlaylist(int playlist) const {
+    int slot = PlaylistSlot(playlist);
+    return slot >= 0 && playlists[slot].loaded;
+}
+
+bool RankTable::Matches(const RankTable& other, int playlist) const {
+    int slot = PlaylistSlot(playlist);
+    if (slot < 0) {
+        return false;
+    }
+
+    const PlaylistThresholds& a = playlists[slot];
+    const PlaylistThresholds& b = other.playlists[slot];
+    return a.loaded == b.loaded
+        && a.players == b.players
+        && std::equal(a.entries.begin(), a.entries.end(), b.entries.begin(),
+            [](const RankThreshold& x, const RankThreshold& y) {
+                return x.minMMR == y.minMMR && x.maxMMR == y.maxMMR;
+            });
+}
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+constexpr int RANK_TIER_COUNT = 23;      // Unranked (0) to Supersonic Legend (22)
+constexpr int RANK_DIVISION_COUNT = 4;   // Division I to Division IV
+constexpr int RANK_PLAYLIST_COUNT = 8;   // Ranked playlists with a RankNumbers file
+constexpr int RANK_SEARCH_SIZE = 128;    // Ranked divisions per playlist, padded to a power of two
+constexpr int RANK_MAX_PLAYLIST = 34;    // Highest ranked playlist ID
+
+/**
+ * @brief Number of divisions a tier has in the RankNumbers files
+ * @param tier Tier level (0-22)
+ * @return 1 for Unranked and Supersonic Legend, 4 otherwise
+ */
+constexpr int RankDivisionCount(int tier) {
+    return (tier == 0 || tier == RANK_TIER_COUNT - 1) ? 1 : RANK_DIVISION_COUNT;
+}
+
+// ============================================================================
+// RANK THRESHOLD TABLE
+// ============================================================================
+
+/**
+ * @brief MMR range of a single tier/division
+ */
+struct RankThreshold {
+    int32_t minMMR = 0;
+    int32_t maxMMR = 0;
+};
+
+/**
+ * @brief Tier/division reached by an MMR value, with its neighbours
+ */
+struct RankPosition {
+    int tier = 0;
+    int division = 0;
+    int minMMR = 0;        // Minimum MMR of this division
+    int maxMMR = 0;        // Maximum MMR of this division
+    int nextMinMMR = 0;    // Minimum MMR of the division above
+    int prevMaxMMR = 0;    // Maximum MMR of the division below
+};
+
+/**
+ * @brief Dense threshold table of one playlist, indexed [tier][division]
+ *
+ * Entries are placed by their own tier/division fields, never by their
+ * position in the source file. Divisions a tier does not have stay zero.
+ */
+struct PlaylistThresholds {
+    alignas(64) std::array<RankThreshold, RANK_TIER_COUNT * RANK_DIVISION_COUNT> entries{};
+    std::array<int32_t, RANK_TIER_COUNT * RANK_DIVISION_COUNT> players{};  // Population of each entry
+    int playlist = 0;
+    bool loaded = false;
+
+    // Ranked divisions sorted by minMMR for MMR -> rank lookups. Padding
+    // keys are INT32_MAX so the search never stops on them.
+    int searchCount = 0;
+    std::array<int32_t, RANK_SEARCH_SIZE> searchKeys{};
+    std::array<uint8_t, RANK_SEARCH_SIZE> searchEntries{};
+
+    // Players in the ranked divisions before each search position, so the
+    // population below an MMR is one prefix sum away. Placement is excluded.
+    int64_t totalPlayers = 0;
+    std::array<int64_t, RANK_SEARCH_SIZE> playersBelow{};
+};
+
+/**
+ * @brief In-memory copy of every RankNumbers/<playlist>.json file
+ *
+ * Starts from the tables embedded at build time and can be overridden from
+ * the data folder, so threshold lookups never touch the disk or allocate.
+ * Has no BakkesMod dependency.
+ */
+class RankTable {
+public:
+    /**
+     * @brief Array of ranked playlist IDs
+     */
+    static constexpr int rankedPlaylists[RANK_PLAYLIST_COUNT] = {
+        10,  // 1v1 (Duel)
+        11,  // 2v2 (Doubles)
+        13,  // 3v3 (Standard)
+        27,  // Hoops
+        28,  // Rumble
+        29,  // Dropshot
+        30,  // Snowday
+        34   // Tournaments
+    };
+
+    /**
+     * @brief Maps a playlist ID to its slot in rankedPlaylists
+     * @param playlist Playlist ID
+     * @return Slot index, or -1 if the playlist is not ranked
+     */
+    static int PlaylistSlot(int playlist) {
+        return (playlist >= 0 && playlist <= RANK_MAX_PLAYLIST) ? playlistSlots[playlist] : -1;
+    }
+
+    /**
+     * @brief Fills every playlist from the tables compiled into the plugin
+     *
+     * No disk access; files loaded afterwards override these defaults.
+     */
+    void LoadEmbeddedDefaults();
+
+    /**
+     * @brief Loads a single RankNumbers JSON file
+     *
+     * Entries may come in any order. The file is rejected if an entry is out
+     * of range or duplicated, or if a division is missing.
+     * @param playlist Playlist ID the file belongs to
+     * @param file Path of the JSON file
+     * @param error Receives a description of the failure
+     * @return True if the playlist was loaded
+     */
+    bool LoadPlaylistFile(int playlist, const std::filesystem::path& file, std::string& error);
+
+    /**
+     * @brief Loads <playlist>.json for every ranked playlist in a folder
+     * @param folder RankNumbers folder
+     * @param error Receives the failures, one per line
+     * @return Number of playlists loaded
+     */
+    int LoadFolder(const std::filesystem::path& folder, std::string& error);
+
+    /**
+     * @brief Loads every playlist from a binary built by RankPack
+     * @param file Binary threshold file
+     * @param jsonFolder RankNumbers folder the binary must still match
+     * @param error Receives the reason the binary was rejected
+     * @return True if the binary is valid and not stale
+     */
+    bool LoadBinary(const std::filesystem::path& file, const std::filesystem::path& jsonFolder, std::string& error);
+
+    /**
+     * @brief Writes the loaded playlists in the binary threshold format
+     * @param file Output file
+     * @param jsonFolder RankNumbers folder the playlists were loaded from
+     * @param error Receives a description of the failure
+     * @return True if the file was written
+     */
+    bool SaveBinary(const std::filesystem::path& file, const std::filesystem::path& jsonFolder, std::string& error) const;
+
+    /**
+     * @brief Returns the MMR threshold of a tier/division
+     * @param playlist Playlist ID
+     * @param tier Tier level (0-22)
+     * @param div Division within tier (0-3)
+     * @param upperLimit True for max MMR, false for min MMR
+     * @return MMR threshold, or 0 if the playlist is not loaded
+     */
+    int Lookup(int playlist, int tier, int div, bool upperLimit) const;
+
+    /**
+     * @brief Finds the tier/division an MMR value falls into
+     *
+     * Branchless binary search over the sorted minMMR column, so it works
+     * from a raw MMR value without MMRWrapper::GetPlayerRank(). Placement
+     * (tier 0) cannot be derived from MMR and is never returned.
+     * @param playlist Playlist ID
+     * @param mmr MMR value
+     * @return Rank position, all zero if the playlist is not loaded
+     */
+    RankPosition Locate(int playlist, float mmr) const;
+
+    /**
+     * @brief Locate() for many MMR values of the same playlist
+     * @param playlist Playlist ID
+     * @param mmr MMR values
+     * @param positions Receives one position per MMR value
+     * @param count Number of values
+     */
+    void LocateMany(int playlist, const float* mmr, RankPosition* positions, size_t count) const;
+
+    /**
+     * @brief Share of the ranked population at or above an MMR value
+     *
+     * Uses the players count of every division and interpolates inside the
+     * division the MMR falls into. Same O(log n) search as Locate().
+     * @param playlist Playlist ID
+     * @param mmr MMR value
+     * @return Percentage from 0 to 100, or -1 if the playlist has no player counts or the MMR is not finite
+     */
+    float TopPercent(int playlist, float mmr) const;
+
+    /**
+     * @brief Checks whether a playlist has been loaded
+     * @param playlist Playlist ID
+     * @return True if thresholds are available
+     */
+    bool HasPlaylist(int playlist) const;
+
+    /**
+     * @brief Compares the thresholds of one playlist with another table
+     * @param other Table to compare with
+     * @param playlist Playlist ID
+     * @return True if both tables hold the same entries and player counts for the playlist
+     */
+    bool Matches(const RankTable& other, int playlist) const;
+
+private:
+    /**
+     * @brief Slot of every playlist ID up to RANK_MAX_PLAYLIST, -1 if not ranked
+     */
+    static constexpr std::array<int8_t, RANK_MAX_PLAYLIST + 1> playlistSlots = [] {
+        std::array<int8_t, RANK_MAX_PLAYLIST + 1> slots{};
+        slots.fill(-1);
+        for (int i = 0; i < RANK_PLAYLIST_COUNT; i++) {
+            slots[rankedPlaylists[i]] = static_cast<int8_t>(i);
+        }
+        return slots;
+    }();
+
+    /**
+     * @brief Rebuilds the sorted minMMR column and player prefix sums of a playlist after loading
+     * @param table Playlist to index
+     */
+    static void BuildSearchIndex(PlaylistThresholds& table);
+
+    /**
+     * @brief Position in the search index of the last division starting at or below an MMR
+     */
+    static int SearchIn(const PlaylistThresholds& table, float mmr);
+
+    /**
+     * @brief Locate() on a playlist that is known to be loaded
+     */
+    static RankPosition LocateIn(const PlaylistThresholds& table, float mmr);
+
+    std::array<PlaylistThresholds, RANK_PLAYLIST_COUNT> playlists;
+};
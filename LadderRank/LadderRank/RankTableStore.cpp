@@ -0,0 +1,167 @@
+#include "RankTableStore.h"
+
+// ============================================================================
+// TABLE BUILDING
+// ============================================================================
+
+std::unique_ptr<RankTable> BuildRankTable(const std::filesystem::path& dataFolder, std::string& report) {
+    auto rankFolder = dataFolder / "RankNumbers";
+
+    auto defaults = std::make_unique<RankTable>();
+    defaults->LoadEmbeddedDefaults();
+
+    auto table = std::make_unique<RankTable>(*defaults);
+    std::string error;
+    if (table->LoadBinary(dataFolder / "RankNumbers.bin", rankFolder, error)) {
+        report = "source RankNumbers.bin";
+    }
+    else {
+        report = "RankNumbers.bin not used (" + error + "), source JSON files";
+
+        error.clear();
+        table->LoadFolder(rankFolder, error);
+        if (!error.empty()) {
+            report += "\nfiles not used, keeping embedded defaults:\n" + error;
+        }
+    }
+
+    int changed = 0;
+    for (int playlist : RankTable::rankedPlaylists) {
+        if (!table->Matches(*defaults, playlist)) {
+            changed++;
+        }
+    }
+    report += "\n" + std::to_string(changed) + "/" + std::to_string(RANK_PLAYLIST_COUNT)
+        + " playlists differ from the embedded defaults";
+
+    return table;
+}
+
+// ============================================================================
+// SNAPSHOT STORE
+// ============================================================================
+
+RankTableStore::ReadGuard::ReadGuard(const RankTableStore& store)
+    : store(store) {
+    // Register under the current generation before loading the pointer so
+    // Publish() waits for us. Retry if a publish retired that generation
+    // between the two loads, late readers must not join a retired counter.
+    for (;;) {
+        generation = store.generation.load();
+        slot = static_cast<int>(generation & 1);
+        store.activeReaders[slot].fetch_add(1);
+        if (store.generation.load() == generation) {
+            break;
+        }
+        store.activeReaders[slot].fetch_sub(1);
+    }
+    table = store.current.load();
+}
+
+RankTableStore::ReadGuard::~ReadGuard() {
+    if (store.generation.load() != generation) {
+        store.crossedReaders.fetch_add(1, std::memory_order_relaxed);
+    }
+    store.activeReaders[slot].fetch_sub(1);
+}
+
+RankTableStore::~RankTableStore() {
+    delete current.load();
+}
+
+void RankTableStore::Publish(std::unique_ptr<RankTable> table) {
+    std::lock_guard<std::mutex> lock(publishMutex);
+
+    const RankTable* previous = current.exchange(table.release());
+    uint64_t retired = generation.fetch_add(1);
+
+    // Grace period: anyone who could have loaded the previous pointer
+    // registered under the retired generation and is still counted there.
+    // New readers count under the next generation, so a steady stream of
+    // readers cannot keep this counter above zero.
+    while (activeReaders[retired & 1].load() != 0) {
+        std::this_thread::yield();
+    }
+
+    delete previous;
+}
+
+// ============================================================================
+// DATA FOLDER WATCHER
+// ============================================================================
+
+RankDataWatcher::~RankDataWatcher() {
+    Stop();
+}
+
+void RankDataWatcher::Start(RankTableStore& store, const std::filesystem::path& dataFolder,
+    std::chrono::milliseconds interval, ReloadCallback onReload) {
+    Stop();
+
+    this->store = &store;
+    this->dataFolder = dataFolder;
+    this->interval = interval;
+    this->onReload = std::move(onReload);
+    stopRequested = false;
+
+    thread = std::thread(&RankDataWatcher::Run, this);
+}
+
+void RankDataWatcher::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        stopRequested = true;
+    }
+    stopSignal.notify_all();
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+std::vector<int64_t> RankDataWatcher::ReadSignature() const {
+    std::vector<std::filesystem::path> files = { dataFolder / "RankNumbers.bin" };
+    for (int playlist : RankTable::rankedPlaylists) {
+        files.push_back(dataFolder / "RankNumbers" / (std::to_string(playlist) + ".json"));
+    }
+
+    std::vector<int64_t> signature;
+    for (const auto& file : files) {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(file, ec);
+        signature.push_back(ec ? -1 : static_cast<int64_t>(size));
+
+        auto time = std::filesystem::last_write_time(file, ec);
+        signature.push_back(ec ? -1 : static_cast<int64_t>(time.time_since_epoch().count()));
+    }
+    return signature;
+}
+
+void RankDataWatcher::Run() {
+    std::vector<int64_t> lastSignature;
+
+    std::unique_lock<std::mutex> lock(stopMutex);
+    while (!stopRequested) {
+        lock.unlock();
+
+        std::vector<int64_t> signature = ReadSignature();
+        if (signature != lastSignature) {
+            auto start = std::chrono::steady_clock::now();
+
+            std::string report;
+            store->Publish(BuildRankTable(dataFolder, report));
+
+            double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            lastReloadMilliseconds.store(milliseconds);
+            reloadCount.fetch_add(1);
+            lastSignature = signature;
+
+            if (onReload) {
+                onReload(report, milliseconds);
+            }
+        }
+
+        lock.lock();
+        stopSignal.wait_for(lock, interval, [this] { return stopRequested; });
+    }
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "RankTable.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// TABLE BUILDING
+// ============================================================================
+
+/**
+ * @brief Builds a table from the embedded defaults and the data folder overrides
+ *
+ * RankNumbers.bin is preferred, the RankNumbers JSON files are used when the
+ * binary is missing or stale, and playlists without a file keep their
+ * embedded thresholds.
+ * @param dataFolder LadderRank data folder
+ * @param report Receives a readable summary of what was loaded
+ * @return The new table
+ */
+std::unique_ptr<RankTable> BuildRankTable(const std::filesystem::path& dataFolder, std::string& report);
+
+// ============================================================================
+// SNAPSHOT STORE
+// ============================================================================
+
+/**
+ * @brief Publishes immutable RankTable generations to readers (RCU style)
+ *
+ * Readers never lock: they bump the counter of the current generation, load
+ * the current pointer and use it until their ReadGuard dies. Publish() swaps
+ * the pointer atomically and frees the previous generation once its counter
+ * drains, so a reader always sees one complete table. Readers arriving during
+ * the grace period count under the new generation and never delay it.
+ */
+class RankTableStore {
+public:
+    /**
+     * @brief Keeps one table generation alive while in scope
+     */
+    class ReadGuard {
+    public:
+        ReadGuard(const RankTableStore& store);
+        ~ReadGuard();
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const RankTable& operator*() const { return *table; }
+        const RankTable* operator->() const { return table; }
+
+        /**
+         * @brief Generation seen when pinning, never newer than the table
+         */
+        uint64_t Generation() const { return generation; }
+
+    private:
+        const RankTableStore& store;
+        const RankTable* table;
+        uint64_t generation;
+        int slot;  // Reader counter this guard is registered in
+    };
+
+    RankTableStore() = default;
+    ~RankTableStore();
+
+    RankTableStore(const RankTableStore&) = delete;
+    RankTableStore& operator=(const RankTableStore&) = delete;
+
+    /**
+     * @brief Pins the current table for reading
+     * @return Guard giving access to the table, must not outlive the store
+     */
+    ReadGuard Read() const { return ReadGuard(*this); }
+
+    /**
+     * @brief Makes a new table current and frees the previous one
+     *
+     * Waits for readers of the previous generation, so it must not be called
+     * while the calling thread holds a ReadGuard.
+     * @param table New table
+     */
+    void Publish(std::unique_ptr<RankTable> table);
+
+    uint64_t Generation() const { return generation.load(); }
+    uint64_t CrossedReaders() const { return crossedReaders.load(); }
+
+private:
+    std::atomic<const RankTable*> current{ nullptr };
+    std::atomic<uint64_t> generation{ 0 };
+
+    // Readers by generation parity. Publish() only waits for the counter of
+    // the generation it retires, the other one takes the new readers.
+    mutable std::array<std::atomic<int>, 2> activeReaders{};
+    mutable std::atomic<uint64_t> crossedReaders{ 0 };  // Readers that saw a swap while reading
+
+    std::mutex publishMutex;  // Serialises writers only
+};
+
+// ============================================================================
+// DATA FOLDER WATCHER
+// ============================================================================
+
+/**
+ * @brief Rebuilds and publishes the rank table when the data folder changes
+ *
+ * Polls RankNumbers.bin and the RankNumbers files from a background thread.
+ * The first poll always builds, which applies the data folder overrides.
+ */
+class RankDataWatcher {
+public:
+    /**
+     * @brief Called on the watcher thread after each reload
+     * @param report Summary from BuildRankTable()
+     * @param milliseconds Time taken to build and publish the table
+     */
+    using ReloadCallback = std::function<void(const std::string& report, double milliseconds)>;
+
+    ~RankDataWatcher();
+
+    /**
+     * @brief Starts watching, stopping any previous watch
+     * @param store Store the rebuilt tables are published to
+     * @param dataFolder LadderRank data folder
+     * @param interval Time between polls
+     * @param onReload Called after each reload
+     */
+    void Start(RankTableStore& store, const std::filesystem::path& dataFolder,
+        std::chrono::milliseconds interval, ReloadCallback onReload);
+
+    /**
+     * @brief Stops the watcher thread and waits for it
+     */
+    void Stop();
+
+    uint64_t ReloadCount() const { return reloadCount.load(); }
+    double LastReloadMilliseconds() const { return lastReloadMilliseconds.load(); }
+
+private:
+    /**
+     * @brief Size and write time of every watched file, changes on any edit
+     */
+    std::vector<int64_t> ReadSignature() const;
+
+    void Run();
+
+    RankTableStore* store = nullptr;
+    std::filesystem::path dataFolder;
+    std::chrono::milliseconds interval{ 0 };
+    ReloadCallback onReload;
+
+    std::thread thread;
+    std::mutex stopMutex;
+    std::condition_variable stopSignal;
+    bool stopRequested = false;
+
+    std::atomic<uint64_t> reloadCount{ 0 };
+    std::atomic<double> lastReloadMilliseconds{ 0.0 };
+};
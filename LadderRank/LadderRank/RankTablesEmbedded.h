@@ -0,0 +1,405 @@
+// Generated by generate_rank_tables.ps1 from LadderRankData/LadderRank/RankNumbers, do not edit.
+#pragma once
+
+#include "RankTable.h"
+
+struct EmbeddedRankTable {
+    int playlist;
+    RankThreshold entries[RANK_TIER_COUNT * RANK_DIVISION_COUNT];
+    int32_t players[RANK_TIER_COUNT * RANK_DIVISION_COUNT];
+};
+
+constexpr EmbeddedRankTable EMBEDDED_RANK_TABLES[RANK_PLAYLIST_COUNT] = {
+    { 10, {
+        { 483, 1137 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 114 }, { 115, 127 }, { 128, 140 }, { 144, 154 },
+        { 149, 158 }, { 160, 177 }, { 178, 196 }, { 197, 210 },
+        { 207, 218 }, { 219, 237 }, { 238, 256 }, { 257, 268 },
+        { 269, 278 }, { 279, 297 }, { 298, 316 }, { 317, 320 },
+        { 333, 338 }, { 339, 357 }, { 358, 376 }, { 377, 383 },
+        { 393, 398 }, { 399, 417 }, { 418, 436 }, { 437, 445 },
+        { 453, 458 }, { 459, 477 }, { 478, 496 }, { 497, 505 },
+        { 507, 518 }, { 519, 537 }, { 538, 556 }, { 557, 565 },
+        { 567, 578 }, { 579, 597 }, { 598, 616 }, { 617, 626 },
+        { 627, 638 }, { 639, 657 }, { 658, 676 }, { 677, 686 },
+        { 686, 698 }, { 699, 717 }, { 718, 736 }, { 737, 746 },
+        { 746, 758 }, { 759, 777 }, { 778, 796 }, { 797, 806 },
+        { 807, 818 }, { 819, 837 }, { 838, 856 }, { 857, 866 },
+        { 866, 878 }, { 879, 897 }, { 898, 916 }, { 917, 926 },
+        { 926, 938 }, { 939, 957 }, { 958, 976 }, { 977, 986 },
+        { 987, 998 }, { 999, 1017 }, { 1018, 1036 }, { 1037, 1045 },
+        { 1046, 1058 }, { 1059, 1077 }, { 1078, 1096 }, { 1097, 1106 },
+        { 1106, 1118 }, { 1120, 1135 }, { 1138, 1155 }, { 1157, 1165 },
+        { 1173, 1178 }, { 1180, 1193 }, { 1200, 1215 }, { 1217, 1226 },
+        { 1227, 1238 }, { 1240, 1247 }, { 1258, 1275 }, { 1277, 1286 },
+        { 1286, 1298 }, { 1300, 1308 }, { 1318, 1335 }, { 1337, 1346 },
+        { 1342, 1489 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 11, {
+        { 464, 1540 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 118 }, { 126, 137 }, { 140, 156 }, { 157, 174 },
+        { 164, 178 }, { 181, 197 }, { 198, 216 }, { 217, 221 },
+        { 226, 238 }, { 239, 257 }, { 258, 276 }, { 277, 280 },
+        { 288, 298 }, { 299, 317 }, { 318, 336 }, { 337, 341 },
+        { 351, 358 }, { 359, 377 }, { 378, 396 }, { 397, 403 },
+        { 410, 418 }, { 419, 437 }, { 438, 456 }, { 457, 462 },
+        { 469, 478 }, { 479, 497 }, { 498, 516 }, { 517, 523 },
+        { 530, 538 }, { 539, 557 }, { 558, 576 }, { 577, 585 },
+        { 590, 598 }, { 599, 617 }, { 618, 636 }, { 637, 644 },
+        { 650, 658 }, { 659, 677 }, { 678, 696 }, { 697, 704 },
+        { 709, 718 }, { 719, 737 }, { 738, 756 }, { 757, 765 },
+        { 770, 778 }, { 779, 797 }, { 798, 816 }, { 817, 825 },
+        { 835, 843 }, { 844, 867 }, { 868, 891 }, { 892, 900 },
+        { 915, 923 }, { 924, 947 }, { 948, 971 }, { 972, 980 },
+        { 994, 1003 }, { 1004, 1027 }, { 1028, 1051 }, { 1052, 1060 },
+        { 1075, 1093 }, { 1095, 1126 }, { 1128, 1158 }, { 1162, 1179 },
+        { 1195, 1213 }, { 1215, 1246 }, { 1248, 1276 }, { 1282, 1299 },
+        { 1314, 1333 }, { 1335, 1365 }, { 1368, 1397 }, { 1402, 1419 },
+        { 1435, 1456 }, { 1462, 1495 }, { 1498, 1526 }, { 1537, 1559 },
+        { 1574, 1597 }, { 1600, 1625 }, { 1638, 1665 }, { 1677, 1703 },
+        { 1715, 1737 }, { 1745, 1776 }, { 1788, 1825 }, { 1832, 1859 },
+        { 1862, 2072 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 13, {
+        { 406, 1660 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 118 }, { 126, 137 }, { 140, 156 }, { 157, 168 },
+        { 164, 178 }, { 181, 197 }, { 198, 216 }, { 217, 229 },
+        { 225, 238 }, { 239, 257 }, { 258, 276 }, { 277, 284 },
+        { 287, 298 }, { 299, 317 }, { 318, 336 }, { 337, 342 },
+        { 351, 358 }, { 359, 377 }, { 378, 396 }, { 397, 403 },
+        { 409, 418 }, { 419, 437 }, { 438, 456 }, { 457, 465 },
+        { 470, 478 }, { 479, 497 }, { 498, 516 }, { 517, 524 },
+        { 531, 538 }, { 539, 557 }, { 558, 576 }, { 577, 584 },
+        { 590, 598 }, { 599, 617 }, { 618, 636 }, { 637, 645 },
+        { 650, 658 }, { 659, 677 }, { 678, 696 }, { 697, 705 },
+        { 710, 718 }, { 719, 737 }, { 738, 756 }, { 757, 765 },
+        { 769, 778 }, { 779, 797 }, { 798, 816 }, { 817, 825 },
+        { 835, 843 }, { 844, 867 }, { 868, 891 }, { 892, 900 },
+        { 913, 923 }, { 924, 947 }, { 948, 971 }, { 972, 980 },
+        { 993, 1003 }, { 1004, 1027 }, { 1028, 1051 }, { 1052, 1060 },
+        { 1075, 1093 }, { 1095, 1115 }, { 1128, 1145 }, { 1162, 1180 },
+        { 1195, 1213 }, { 1215, 1247 }, { 1248, 1276 }, { 1282, 1300 },
+        { 1315, 1333 }, { 1335, 1365 }, { 1368, 1395 }, { 1402, 1419 },
+        { 1435, 1456 }, { 1461, 1487 }, { 1498, 1535 }, { 1537, 1559 },
+        { 1575, 1598 }, { 1600, 1637 }, { 1638, 1665 }, { 1677, 1700 },
+        { 1712, 1742 }, { 1744, 1773 }, { 1788, 1811 }, { 1832, 1860 },
+        { 1864, 2000 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 27, {
+        { 468, 1160 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 114 }, { 141, 156 }, { 162, 186 }, { 194, 200 },
+        { 205, 216 }, { 226, 233 }, { 241, 254 }, { 257, 270 },
+        { 263, 278 }, { 280, 297 }, { 302, 316 }, { 317, 334 },
+        { 325, 333 }, { 335, 347 }, { 348, 360 }, { 362, 374 },
+        { 365, 378 }, { 379, 397 }, { 398, 416 }, { 417, 433 },
+        { 423, 433 }, { 435, 447 }, { 448, 461 }, { 463, 474 },
+        { 465, 478 }, { 479, 497 }, { 498, 516 }, { 517, 522 },
+        { 521, 533 }, { 534, 547 }, { 548, 561 }, { 562, 574 },
+        { 574, 578 }, { 579, 597 }, { 598, 616 }, { 617, 622 },
+        { 623, 633 }, { 634, 647 }, { 648, 661 }, { 662, 672 },
+        { 671, 678 }, { 679, 697 }, { 698, 716 }, { 717, 722 },
+        { 723, 733 }, { 734, 747 }, { 748, 761 }, { 762, 769 },
+        { 774, 778 }, { 779, 797 }, { 798, 816 }, { 817, 823 },
+        { 824, 833 }, { 834, 847 }, { 848, 861 }, { 862, 869 },
+        { 867, 878 }, { 879, 897 }, { 898, 916 }, { 917, 922 },
+        { 924, 933 }, { 935, 947 }, { 948, 961 }, { 962, 971 },
+        { 969, 978 }, { 979, 997 }, { 998, 1016 }, { 1017, 1023 },
+        { 1027, 1038 }, { 1039, 1057 }, { 1058, 1076 }, { 1077, 1083 },
+        { 1095, 1098 }, { 1099, 1117 }, { 1118, 1134 }, { 1137, 1152 },
+        { 1146, 1158 }, { 1160, 1175 }, { 1178, 1195 }, { 1197, 1204 },
+        { 1205, 1218 }, { 1219, 1232 }, { 1238, 1255 }, { 1257, 1265 },
+        { 1262, 1345 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 28, {
+        { 477, 1170 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 97 }, { 114, 124 }, { 139, 139 }, { 140, 147 },
+        { 148, 156 }, { 163, 177 }, { 180, 195 }, { 197, 214 },
+        { 210, 218 }, { 220, 237 }, { 240, 255 }, { 257, 262 },
+        { 274, 278 }, { 280, 297 }, { 299, 316 }, { 317, 330 },
+        { 328, 338 }, { 339, 357 }, { 358, 376 }, { 377, 392 },
+        { 386, 398 }, { 399, 417 }, { 418, 436 }, { 437, 443 },
+        { 450, 458 }, { 459, 477 }, { 478, 496 }, { 497, 502 },
+        { 510, 518 }, { 519, 537 }, { 538, 556 }, { 557, 563 },
+        { 569, 578 }, { 579, 597 }, { 598, 616 }, { 617, 623 },
+        { 633, 638 }, { 639, 657 }, { 658, 676 }, { 677, 683 },
+        { 689, 698 }, { 699, 717 }, { 718, 736 }, { 737, 743 },
+        { 752, 758 }, { 759, 777 }, { 778, 796 }, { 797, 803 },
+        { 811, 818 }, { 819, 837 }, { 838, 856 }, { 857, 863 },
+        { 872, 878 }, { 879, 897 }, { 898, 916 }, { 917, 923 },
+        { 932, 938 }, { 939, 957 }, { 958, 976 }, { 977, 983 },
+        { 992, 998 }, { 999, 1017 }, { 1018, 1036 }, { 1037, 1044 },
+        { 1049, 1058 }, { 1059, 1077 }, { 1078, 1096 }, { 1097, 1105 },
+        { 1113, 1123 }, { 1125, 1147 }, { 1148, 1170 }, { 1172, 1181 },
+        { 1195, 1203 }, { 1204, 1226 }, { 1229, 1246 }, { 1252, 1261 },
+        { 1271, 1283 }, { 1285, 1302 }, { 1308, 1330 }, { 1332, 1344 },
+        { 1348, 1367 }, { 1371, 1388 }, { 1398, 1418 }, { 1427, 1441 },
+        { 1449, 1528 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 29, {
+        { 397, 825 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 125 }, { 130, 156 }, { 158, 185 }, { 187, 212 },
+        { 205, 218 }, { 220, 236 }, { 239, 255 }, { 257, 274 },
+        { 265, 278 }, { 279, 297 }, { 298, 316 }, { 317, 334 },
+        { 323, 333 }, { 334, 347 }, { 348, 361 }, { 362, 374 },
+        { 371, 378 }, { 379, 397 }, { 398, 416 }, { 417, 423 },
+        { 422, 433 }, { 434, 447 }, { 448, 461 }, { 462, 474 },
+        { 470, 478 }, { 479, 497 }, { 498, 516 }, { 517, 523 },
+        { 523, 533 }, { 534, 547 }, { 548, 561 }, { 562, 573 },
+        { 569, 578 }, { 579, 597 }, { 598, 616 }, { 617, 622 },
+        { 624, 633 }, { 634, 647 }, { 648, 661 }, { 662, 673 },
+        { 672, 678 }, { 679, 697 }, { 698, 716 }, { 717, 722 },
+        { 724, 733 }, { 734, 747 }, { 748, 761 }, { 762, 770 },
+        { 773, 778 }, { 779, 797 }, { 798, 816 }, { 817, 826 },
+        { 824, 833 }, { 834, 847 }, { 848, 861 }, { 862, 867 },
+        { 868, 878 }, { 879, 897 }, { 898, 916 }, { 917, 924 },
+        { 925, 933 }, { 935, 947 }, { 948, 961 }, { 962, 971 },
+        { 971, 978 }, { 979, 997 }, { 998, 1016 }, { 1017, 1030 },
+        { 1026, 1038 }, { 1039, 1057 }, { 1058, 1075 }, { 1077, 1091 },
+        { 1088, 1098 }, { 1099, 1110 }, { 1118, 1136 }, { 1137, 1154 },
+        { 1144, 1158 }, { 1160, 1177 }, { 1179, 1194 }, { 1197, 1213 },
+        { 1212, 1218 }, { 1220, 1236 }, { 1238, 1254 }, { 1257, 1269 },
+        { 1268, 1289 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 30, {
+        { 393, 913 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 91 }, { 135, 157 }, { 163, 184 }, { 187, 199 },
+        { 211, 218 }, { 220, 237 }, { 239, 255 }, { 257, 274 },
+        { 267, 278 }, { 279, 297 }, { 298, 315 }, { 317, 333 },
+        { 321, 333 }, { 335, 347 }, { 348, 360 }, { 362, 373 },
+        { 374, 378 }, { 379, 397 }, { 398, 416 }, { 417, 431 },
+        { 422, 433 }, { 435, 447 }, { 448, 461 }, { 462, 474 },
+        { 469, 478 }, { 479, 497 }, { 498, 516 }, { 517, 531 },
+        { 524, 533 }, { 535, 547 }, { 548, 561 }, { 562, 574 },
+        { 573, 578 }, { 579, 597 }, { 598, 616 }, { 617, 626 },
+        { 623, 633 }, { 635, 647 }, { 648, 661 }, { 662, 674 },
+        { 670, 678 }, { 679, 697 }, { 698, 716 }, { 717, 723 },
+        { 723, 733 }, { 734, 747 }, { 748, 761 }, { 762, 772 },
+        { 774, 778 }, { 779, 797 }, { 798, 816 }, { 817, 825 },
+        { 825, 833 }, { 834, 847 }, { 848, 861 }, { 862, 872 },
+        { 869, 878 }, { 879, 897 }, { 898, 916 }, { 917, 924 },
+        { 924, 933 }, { 935, 947 }, { 948, 961 }, { 962, 971 },
+        { 967, 978 }, { 979, 997 }, { 998, 1015 }, { 1017, 1025 },
+        { 1026, 1038 }, { 1039, 1057 }, { 1058, 1074 }, { 1077, 1086 },
+        { 1086, 1098 }, { 1099, 1117 }, { 1118, 1135 }, { 1137, 1150 },
+        { 1143, 1158 }, { 1160, 1168 }, { 1178, 1195 }, { 1197, 1210 },
+        { 1205, 1218 }, { 1219, 1236 }, { 1239, 1254 }, { 1257, 1268 },
+        { 1261, 1402 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+    { 34, {
+        { 0, 118 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 118 }, { 120, 135 }, { 138, 156 }, { 157, 160 },
+        { 161, 177 }, { 179, 197 }, { 198, 216 }, { 217, 220 },
+        { 221, 238 }, { 238, 257 }, { 258, 276 }, { 276, 280 },
+        { 280, 298 }, { 298, 317 }, { 317, 336 }, { 336, 340 },
+        { 340, 358 }, { 357, 377 }, { 377, 396 }, { 396, 400 },
+        { 400, 418 }, { 417, 437 }, { 436, 456 }, { 456, 462 },
+        { 460, 478 }, { 477, 497 }, { 497, 516 }, { 516, 524 },
+        { 520, 538 }, { 537, 557 }, { 556, 576 }, { 576, 585 },
+        { 580, 598 }, { 597, 617 }, { 616, 636 }, { 636, 654 },
+        { 640, 658 }, { 657, 677 }, { 676, 696 }, { 696, 714 },
+        { 700, 718 }, { 717, 737 }, { 736, 756 }, { 756, 774 },
+        { 760, 778 }, { 776, 797 }, { 796, 816 }, { 816, 835 },
+        { 820, 844 }, { 844, 867 }, { 868, 891 }, { 891, 914 },
+        { 900, 924 }, { 924, 947 }, { 948, 971 }, { 971, 994 },
+        { 980, 1004 }, { 1004, 1027 }, { 1028, 1051 }, { 1051, 1074 },
+        { 1060, 1093 }, { 1094, 1127 }, { 1128, 1161 }, { 1161, 1187 },
+        { 1180, 1214 }, { 1214, 1247 }, { 1248, 1281 }, { 1281, 1300 },
+        { 1300, 1333 }, { 1334, 1367 }, { 1368, 1401 }, { 1401, 1420 },
+        { 1420, 1458 }, { 1459, 1497 }, { 1498, 1536 }, { 1537, 1560 },
+        { 1560, 1598 }, { 1599, 1637 }, { 1638, 1676 }, { 1677, 1700 },
+        { 1701, 1743 }, { 1744, 1787 }, { 1788, 1829 }, { 1832, 1860 },
+        { 1861, 2033 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    }, {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+    } },
+};
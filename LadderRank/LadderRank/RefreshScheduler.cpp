@@ -0,0 +1,116 @@
+#include "RefreshScheduler.h"
+
+#include <algorithm>
+
+RefreshScheduler::RefreshScheduler(Timer timer, Fetch fetch, int maxInFlight)
+    : state(std::make_shared<State>()) {
+    state->timer = std::move(timer);
+    state->fetch = std::move(fetch);
+    state->maxInFlight = std::max(1, maxInFlight);
+}
+
+void RefreshScheduler::Request(int key, float delaySeconds, int attempts, float retrySeconds) {
+    state->requests++;
+
+    Entry& entry = state->entries[key];
+    if (entry.armed || entry.waiting) {
+        // Merge into the pending refresh, keep its deadline
+        state->coalesced++;
+        entry.attempts = std::max(entry.attempts, attempts);
+        entry.retrySeconds = retrySeconds;
+        return;
+    }
+
+    entry.delaySeconds = delaySeconds;
+    entry.attempts = std::max(1, attempts);
+    entry.retrySeconds = retrySeconds;
+    Arm(state, key, delaySeconds);
+}
+
+void RefreshScheduler::Cancel(int key) {
+    auto found = state->entries.find(key);
+    if (found == state->entries.end()) {
+        return;
+    }
+
+    Entry& entry = found->second;
+    entry.generation++;
+    if (entry.armed) {
+        entry.armed = false;
+        state->inFlight--;
+    }
+    entry.waiting = false;
+    entry.attempts = 0;
+
+    StartWaiting(state);
+}
+
+void RefreshScheduler::CancelAll() {
+    for (auto& [key, entry] : state->entries) {
+        entry.generation++;
+        entry.armed = false;
+        entry.waiting = false;
+        entry.attempts = 0;
+    }
+    state->waitingKeys.clear();
+    state->inFlight = 0;
+}
+
+void RefreshScheduler::Arm(const std::shared_ptr<State>& state, int key, float delaySeconds) {
+    Entry& entry = state->entries[key];
+    if (state->inFlight >= state->maxInFlight) {
+        entry.waiting = true;
+        entry.delaySeconds = delaySeconds;
+        state->waitingKeys.push_back(key);
+        return;
+    }
+
+    entry.armed = true;
+    state->inFlight++;
+
+    uint64_t generation = ++entry.generation;
+    std::weak_ptr<State> weak = state;
+    state->timer(delaySeconds, [weak, key, generation]() {
+        if (auto alive = weak.lock()) {
+            Fire(alive, key, generation);
+        }
+        });
+}
+
+void RefreshScheduler::Fire(const std::shared_ptr<State>& state, int key, uint64_t generation) {
+    Entry& entry = state->entries[key];
+    if (!entry.armed || entry.generation != generation) {
+        // Cancelled or superseded since this timer was armed
+        state->dropped++;
+        return;
+    }
+
+    entry.armed = false;
+    state->inFlight--;
+
+    state->fetches++;
+    bool done = state->fetch(key);
+
+    // The fetch may have requested the key again, that request wins
+    if (!entry.armed && !entry.waiting) {
+        entry.attempts--;
+        if (!done && entry.attempts > 0) {
+            Arm(state, key, entry.retrySeconds);
+        }
+    }
+
+    StartWaiting(state);
+}
+
+void RefreshScheduler::StartWaiting(const std::shared_ptr<State>& state) {
+    while (state->inFlight < state->maxInFlight && !state->waitingKeys.empty()) {
+        int key = state->waitingKeys.front();
+        state->waitingKeys.pop_front();
+
+        Entry& entry = state->entries[key];
+        if (entry.waiting) {
+            entry.waiting = false;
+            Arm(state, key, entry.delaySeconds);
+        }
+    }
+}
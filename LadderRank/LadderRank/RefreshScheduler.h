@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+
+// ============================================================================
+// REFRESH SCHEDULER
+// ============================================================================
+
+/**
+ * @brief Runs delayed, retried refreshes with at most one pending per key
+ *
+ * A request for a key that is already pending is merged into it instead of
+ * arming another timer. Every armed timer carries the generation of its key,
+ * so a callback superseded by Cancel() is dropped when it fires. At most
+ * maxInFlight timers are armed at once; further keys wait their turn.
+ *
+ * Single-threaded: Request() and the timer callbacks must run on the same
+ * thread. Has no BakkesMod dependency, the timer is injected.
+ */
+class RefreshScheduler {
+public:
+    /**
+     * @brief Calls callback once after delaySeconds
+     */
+    using Timer = std::function<void(float delaySeconds, std::function<void()> callback)>;
+
+    /**
+     * @brief Refreshes one key
+     * @return True when done, false to retry if attempts are left
+     */
+    using Fetch = std::function<bool(int key)>;
+
+    /**
+     * @param timer Timer used to delay the fetches
+     * @param fetch Work run for each key
+     * @param maxInFlight Maximum number of armed timers
+     */
+    RefreshScheduler(Timer timer, Fetch fetch, int maxInFlight);
+
+    /**
+     * @brief Requests a refresh of a key
+     *
+     * If the key is already pending, the request is merged: the pending
+     * deadline is kept and the larger attempt count wins.
+     * @param key Key to refresh (playlist ID)
+     * @param delaySeconds Delay before the first fetch
+     * @param attempts Fetches allowed until one returns true
+     * @param retrySeconds Delay between failed fetches
+     */
+    void Request(int key, float delaySeconds, int attempts = 1, float retrySeconds = 0.0f);
+
+    /**
+     * @brief Drops the pending refresh of a key, its timer fires into nothing
+     * @param key Key to cancel
+     */
+    void Cancel(int key);
+
+    /**
+     * @brief Drops every pending refresh
+     */
+    void CancelAll();
+
+    int InFlight() const { return state->inFlight; }
+    uint64_t Requests() const { return state->requests; }
+    uint64_t Coalesced() const { return state->coalesced; }
+    uint64_t Fetches() const { return state->fetches; }
+    uint64_t Dropped() const { return state->dropped; }
+
+private:
+    struct Entry {
+        uint64_t generation = 0;
+        bool armed = false;        // Timer armed for the current generation
+        bool waiting = false;      // Queued until an in-flight slot frees
+        float delaySeconds = 0.0f;
+        int attempts = 0;
+        float retrySeconds = 0.0f;
+    };
+
+    // Shared with the timer callbacks, which only hold a weak reference so
+    // a callback firing after the scheduler is gone does nothing
+    struct State {
+        Timer timer;
+        Fetch fetch;
+        int maxInFlight = 1;
+
+        std::map<int, Entry> entries;
+        std::deque<int> waitingKeys;
+        int inFlight = 0;
+
+        uint64_t requests = 0;
+        uint64_t coalesced = 0;
+        uint64_t fetches = 0;
+        uint64_t dropped = 0;
+    };
+
+    static void Arm(const std::shared_ptr<State>& state, int key, float delaySeconds);
+    static void Fire(const std::shared_ptr<State>& state, int key, uint64_t generation);
+    static void StartWaiting(const std::shared_ptr<State>& state);
+
+    std::shared_ptr<State> state;
+};
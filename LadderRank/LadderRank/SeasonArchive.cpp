@@ -0,0 +1,351 @@
+#include "SeasonArchive.h"
+#include "RankBinary.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Parses the season number out of a folder name like "14" or "season14"
+ * @return Season number, or -1 if the name has no trailing digits
+ */
+static int ParseSeasonNumber(const std::string& name) {
+    size_t digits = name.size();
+    while (digits > 0 && std::isdigit(static_cast<unsigned char>(name[digits - 1]))) {
+        digits--;
+    }
+    if (digits == name.size() || name.size() - digits > 6) {
+        return -1;
+    }
+    return std::stoi(name.substr(digits));
+}
+
+static size_t AlignTo4(size_t value) {
+    return (value + 3) & ~static_cast<size_t>(3);
+}
+
+static void AppendBytes(std::vector<uint8_t>& buffer, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+// ============================================================================
+// IMPORT AND WRITE
+// ============================================================================
+
+int ImportSeasonFolders(const std::filesystem::path& root, std::vector<SeasonTables>& seasons, std::string& error) {
+    std::error_code ec;
+    std::filesystem::directory_iterator folders(root, ec);
+    if (ec) {
+        error += "cannot list " + root.string() + "\n";
+        return 0;
+    }
+
+    for (const auto& folder : folders) {
+        if (!folder.is_directory()) {
+            continue;
+        }
+
+        int number = ParseSeasonNumber(folder.path().filename().string());
+        if (number < 0) {
+            continue;
+        }
+
+        auto jsonFolder = folder.path();
+        if (std::filesystem::is_directory(jsonFolder / "RankNumbers")) {
+            jsonFolder /= "RankNumbers";
+        }
+
+        SeasonTables season;
+        season.season = number;
+        for (int playlist : RankTable::rankedPlaylists) {
+            auto file = jsonFolder / (std::to_string(playlist) + ".json");
+            std::string fileError;
+            if (std::filesystem::exists(file) && !season.table.LoadPlaylistFile(playlist, file, fileError)) {
+                error += fileError + "\n";
+            }
+        }
+
+        bool duplicate = std::any_of(seasons.begin(), seasons.end(),
+            [number](const SeasonTables& other) { return other.season == number; });
+        if (duplicate) {
+            error += folder.path().string() + ": season " + std::to_string(number) + " already imported\n";
+            continue;
+        }
+        seasons.push_back(std::move(season));
+    }
+
+    std::sort(seasons.begin(), seasons.end(),
+        [](const SeasonTables& a, const SeasonTables& b) { return a.season < b.season; });
+    return static_cast<int>(seasons.size());
+}
+
+bool WriteSeasonArchive(const std::vector<SeasonTables>& seasons, const std::filesystem::path& file, std::string& error) {
+    constexpr uint32_t entryCount = RANK_TIER_COUNT * RANK_DIVISION_COUNT;
+    const uint32_t seasonCount = static_cast<uint32_t>(seasons.size());
+    const uint32_t playlistCount = RANK_PLAYLIST_COUNT;
+
+    if (seasons.empty()) {
+        error = "no season to write";
+        return false;
+    }
+
+    // Value of one entry of one season, 0 when the season has no file
+    auto value = [](const SeasonTables& season, int playlist, uint32_t entry, bool upper) {
+        return season.table.Lookup(playlist, static_cast<int>(entry / RANK_DIVISION_COUNT),
+            static_cast<int>(entry % RANK_DIVISION_COUNT), upper);
+    };
+
+    std::vector<uint8_t> body;
+    for (const SeasonTables& season : seasons) {
+        int32_t number = season.season;
+        AppendBytes(body, &number, sizeof(number));
+    }
+    for (int playlist : RankTable::rankedPlaylists) {
+        int32_t id = playlist;
+        AppendBytes(body, &id, sizeof(id));
+    }
+    for (const SeasonTables& season : seasons) {
+        for (int playlist : RankTable::rankedPlaylists) {
+            body.push_back(season.table.HasPlaylist(playlist) ? 1 : 0);
+        }
+    }
+    body.resize(AlignTo4(body.size()));
+
+    size_t directoryOffset = body.size();
+    std::vector<SeasonArchiveColumn> directory(playlistCount * 2);
+    body.resize(body.size() + directory.size() * sizeof(SeasonArchiveColumn));
+
+    for (uint32_t p = 0; p < playlistCount; p++) {
+        int playlist = RankTable::rankedPlaylists[p];
+
+        // The oldest season holding the playlist is the base of its deltas
+        auto baseSeason = std::find_if(seasons.begin(), seasons.end(),
+            [playlist](const SeasonTables& season) { return season.table.HasPlaylist(playlist); });
+
+        for (int c = 0; c < 2; c++) {
+            bool upper = (c == 1);
+
+            std::vector<int32_t> base(entryCount, 0);
+            if (baseSeason != seasons.end()) {
+                for (uint32_t e = 0; e < entryCount; e++) {
+                    base[e] = value(*baseSeason, playlist, e, upper);
+                }
+            }
+
+            std::vector<int32_t> deltas;
+            bool narrow = true;
+            for (uint32_t s = 1; s < seasonCount; s++) {
+                bool held = seasons[s].table.HasPlaylist(playlist);
+                for (uint32_t e = 0; e < entryCount; e++) {
+                    int32_t delta = held ? value(seasons[s], playlist, e, upper) - base[e] : 0;
+                    narrow = narrow && delta >= INT16_MIN && delta <= INT16_MAX;
+                    deltas.push_back(delta);
+                }
+            }
+
+            SeasonArchiveColumn& column = directory[p * 2 + c];
+            column.offset = static_cast<uint32_t>(sizeof(SeasonArchiveHeader) + body.size());
+            column.deltaBytes = narrow ? 2 : 4;
+
+            AppendBytes(body, base.data(), base.size() * sizeof(int32_t));
+            for (int32_t delta : deltas) {
+                if (narrow) {
+                    int16_t small = static_cast<int16_t>(delta);
+                    AppendBytes(body, &small, sizeof(small));
+                }
+                else {
+                    AppendBytes(body, &delta, sizeof(delta));
+                }
+            }
+            body.resize(AlignTo4(body.size()));
+        }
+    }
+    std::memcpy(body.data() + directoryOffset, directory.data(), directory.size() * sizeof(SeasonArchiveColumn));
+
+    SeasonArchiveHeader header{};
+    header.magic = SEASON_ARCHIVE_MAGIC;
+    header.version = SEASON_ARCHIVE_VERSION;
+    header.seasonCount = seasonCount;
+    header.playlistCount = playlistCount;
+    header.entryCount = entryCount;
+    header.checksum = Fnv1a(body.data(), body.size());
+
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        error = "cannot create " + file.string();
+        return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(body.data()), static_cast<std::streamsize>(body.size()));
+    if (!stream) {
+        error = "cannot write " + file.string();
+        return false;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+bool SeasonArchive::Open(const std::filesystem::path& path, std::string& error) {
+    header = nullptr;
+
+    if (!file.Open(path)) {
+        error = "cannot map " + path.string();
+        return false;
+    }
+
+    const uint8_t* data = file.Data();
+    size_t size = file.Size();
+
+    if (size < sizeof(SeasonArchiveHeader)) {
+        error = "truncated header";
+        return false;
+    }
+
+    const auto* candidate = reinterpret_cast<const SeasonArchiveHeader*>(data);
+    if (candidate->magic != SEASON_ARCHIVE_MAGIC) {
+        error = "bad magic";
+        return false;
+    }
+    if (candidate->version != SEASON_ARCHIVE_VERSION) {
+        error = "unsupported version " + std::to_string(candidate->version);
+        return false;
+    }
+    if (candidate->seasonCount == 0 || candidate->entryCount != RANK_TIER_COUNT * RANK_DIVISION_COUNT) {
+        error = "unexpected season or entry count";
+        return false;
+    }
+
+    size_t seasonCount = candidate->seasonCount;
+    size_t playlistCount = candidate->playlistCount;
+    size_t presentOffset = sizeof(SeasonArchiveHeader) + (seasonCount + playlistCount) * sizeof(int32_t);
+    size_t directoryOffset = presentOffset + AlignTo4(seasonCount * playlistCount);
+    size_t directoryEnd = directoryOffset + playlistCount * 2 * sizeof(SeasonArchiveColumn);
+    if (directoryEnd > size) {
+        error = "truncated directory";
+        return false;
+    }
+
+    const auto* directory = reinterpret_cast<const SeasonArchiveColumn*>(data + directoryOffset);
+    for (size_t c = 0; c < playlistCount * 2; c++) {
+        size_t offset = directory[c].offset;
+        size_t deltaBytes = directory[c].deltaBytes;
+        size_t columnEnd = offset + candidate->entryCount * (sizeof(int32_t) + deltaBytes * (seasonCount - 1));
+        if (offset % alignof(int32_t) != 0 || offset < directoryEnd || (deltaBytes != 2 && deltaBytes != 4) || columnEnd > size) {
+            error = "bad column " + std::to_string(c);
+            return false;
+        }
+    }
+
+    uint32_t checksum = Fnv1a(data + sizeof(SeasonArchiveHeader), size - sizeof(SeasonArchiveHeader));
+    if (checksum != candidate->checksum) {
+        error = "checksum mismatch";
+        return false;
+    }
+
+    header = candidate;
+    seasons = reinterpret_cast<const int32_t*>(data + sizeof(SeasonArchiveHeader));
+    playlists = seasons + seasonCount;
+    present = data + presentOffset;
+    columns = directory;
+    return true;
+}
+
+int SeasonArchive::SeasonCount() const {
+    return header ? static_cast<int>(header->seasonCount) : 0;
+}
+
+int SeasonArchive::SeasonNumber(int seasonIndex) const {
+    if (!header || seasonIndex < 0 || seasonIndex >= static_cast<int>(header->seasonCount)) {
+        return -1;
+    }
+    return seasons[seasonIndex];
+}
+
+int SeasonArchive::FindSeason(int season) const {
+    if (!header) {
+        return -1;
+    }
+
+    const int32_t* end = seasons + header->seasonCount;
+    const int32_t* found = std::lower_bound(seasons, end, season);
+    return (found != end && *found == season) ? static_cast<int>(found - seasons) : -1;
+}
+
+int SeasonArchive::PlaylistColumn(int playlist) const {
+    for (uint32_t p = 0; p < header->playlistCount; p++) {
+        if (playlists[p] == playlist) {
+            return static_cast<int>(p);
+        }
+    }
+    return -1;
+}
+
+bool SeasonArchive::HasPlaylist(int seasonIndex, int playlist) const {
+    if (!header || seasonIndex < 0 || seasonIndex >= static_cast<int>(header->seasonCount)) {
+        return false;
+    }
+
+    int column = PlaylistColumn(playlist);
+    return column >= 0 && present[seasonIndex * header->playlistCount + column] != 0;
+}
+
+int SeasonArchive::Lookup(int seasonIndex, int playlist, int tier, int div, bool upperLimit) const {
+    if (!HasPlaylist(seasonIndex, playlist) || tier < 0 || tier >= RANK_TIER_COUNT || div < 0 || div >= RANK_DIVISION_COUNT) {
+        return 0;
+    }
+
+    const SeasonArchiveColumn& column = columns[PlaylistColumn(playlist) * 2 + (upperLimit ? 1 : 0)];
+    const uint8_t* base = file.Data() + column.offset;
+    size_t entry = static_cast<size_t>(tier * RANK_DIVISION_COUNT + div);
+
+    // Base season, plus the single delta of any later season
+    int32_t value = reinterpret_cast<const int32_t*>(base)[entry];
+    if (seasonIndex > 0) {
+        const uint8_t* deltas = base + header->entryCount * (sizeof(int32_t) + column.deltaBytes * (seasonIndex - 1));
+        value += (column.deltaBytes == 2)
+            ? reinterpret_cast<const int16_t*>(deltas)[entry]
+            : reinterpret_cast<const int32_t*>(deltas)[entry];
+    }
+    return value;
+}
+
+std::vector<SeasonThresholdChange> SeasonArchive::Diff(int fromIndex, int toIndex, int playlist) const {
+    std::vector<SeasonThresholdChange> changes;
+    if (!header) {
+        return changes;
+    }
+
+    for (uint32_t p = 0; p < header->playlistCount; p++) {
+        int id = playlists[p];
+        if ((playlist != 0 && id != playlist) || !HasPlaylist(fromIndex, id) || !HasPlaylist(toIndex, id)) {
+            continue;
+        }
+
+        for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+            for (int div = 0; div < RankDivisionCount(tier); div++) {
+                SeasonThresholdChange change;
+                change.playlist = id;
+                change.tier = tier;
+                change.division = div;
+                change.from = { Lookup(fromIndex, id, tier, div, false), Lookup(fromIndex, id, tier, div, true) };
+                change.to = { Lookup(toIndex, id, tier, div, false), Lookup(toIndex, id, tier, div, true) };
+                if (change.from.minMMR != change.to.minMMR || change.from.maxMMR != change.to.maxMMR) {
+                    changes.push_back(change);
+                }
+            }
+        }
+    }
+
+    return changes;
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "RankTable.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// SEASON ARCHIVE FORMAT
+// ============================================================================
+//
+// Little endian, every section 4-byte aligned:
+//
+//   SeasonArchiveHeader
+//   int32 seasons[seasonCount]                 season numbers, ascending
+//   int32 playlists[playlistCount]
+//   uint8 present[seasonCount][playlistCount]  padded to 4 bytes
+//   SeasonArchiveColumn columns[playlistCount][2]  minMMR then maxMMR
+//   per column: int32 base[entryCount], then
+//               delta[seasonCount - 1][entryCount] (int16 or int32)
+//
+// The base is the oldest season. Every later season is stored as its delta
+// to the base, so a value is base + one delta whatever the season. Deltas
+// are int16 when every delta of the column fits. The checksum covers
+// everything after the header.
+
+constexpr uint32_t SEASON_ARCHIVE_MAGIC = 0x4153524C;  // "LRSA"
+constexpr uint32_t SEASON_ARCHIVE_VERSION = 1;
+
+struct SeasonArchiveHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seasonCount;
+    uint32_t playlistCount;
+    uint32_t entryCount;     // Tier/division entries per column
+    uint32_t checksum;       // FNV-1a of everything after the header
+};
+
+struct SeasonArchiveColumn {
+    uint32_t offset;         // File offset of the base values
+    uint32_t deltaBytes;     // 2 or 4
+};
+
+/**
+ * @brief Thresholds of one season, as loaded from its RankNumbers folder
+ */
+struct SeasonTables {
+    int season = 0;
+    RankTable table;
+};
+
+/**
+ * @brief One tier/division whose thresholds differ between two seasons
+ */
+struct SeasonThresholdChange {
+    int playlist = 0;
+    int tier = 0;
+    int division = 0;
+    RankThreshold from;
+    RankThreshold to;
+};
+
+// ============================================================================
+// IMPORT AND WRITE
+// ============================================================================
+
+/**
+ * @brief Loads every season folder below a root folder
+ *
+ * Each subfolder is one season, named by its number ("14" or "season14"),
+ * and holds <playlist>.json files either directly or in RankNumbers/.
+ * @param root Folder holding the season folders
+ * @param seasons Receives the seasons, oldest first
+ * @param error Receives the files that could not be loaded, one per line
+ * @return Number of seasons found
+ */
+int ImportSeasonFolders(const std::filesystem::path& root, std::vector<SeasonTables>& seasons, std::string& error);
+
+/**
+ * @brief Writes seasons in the season archive format
+ * @param seasons Seasons sorted by number, at least one
+ * @param file Output file
+ * @param error Receives a description of the failure
+ * @return True if the file was written
+ */
+bool WriteSeasonArchive(const std::vector<SeasonTables>& seasons, const std::filesystem::path& file, std::string& error);
+
+// ============================================================================
+// READER
+// ============================================================================
+
+/**
+ * @brief Validated, zero-copy view of a mapped season archive
+ *
+ * Lookups index straight into the mapped columns and never allocate.
+ */
+class SeasonArchive {
+public:
+    /**
+     * @brief Maps an archive and checks its header, layout and checksum
+     * @param path Archive file
+     * @param error Receives the reason the file was rejected
+     * @return True if the file can be read
+     */
+    bool Open(const std::filesystem::path& path, std::string& error);
+
+    bool IsOpen() const { return header != nullptr; }
+    int SeasonCount() const;
+
+    /**
+     * @brief Returns the season number stored at an index
+     * @param seasonIndex Season index
+     * @return Season number, or -1 if the index is out of range
+     */
+    int SeasonNumber(int seasonIndex) const;
+
+    /**
+     * @brief Finds the index of a season number
+     * @param season Season number
+     * @return Season index, or -1 if the archive does not hold it
+     */
+    int FindSeason(int season) const;
+
+    /**
+     * @brief Checks whether a season had a file for a playlist
+     * @param seasonIndex Season index
+     * @param playlist Playlist ID
+     * @return True if the season holds the playlist
+     */
+    bool HasPlaylist(int seasonIndex, int playlist) const;
+
+    /**
+     * @brief Returns the MMR threshold of a tier/division in a season
+     * @param seasonIndex Season index
+     * @param playlist Playlist ID
+     * @param tier Tier level (0-22)
+     * @param div Division within tier (0-3)
+     * @param upperLimit True for max MMR, false for min MMR
+     * @return MMR threshold, or 0 if the season does not hold the playlist
+     */
+    int Lookup(int seasonIndex, int playlist, int tier, int div, bool upperLimit) const;
+
+    /**
+     * @brief Lists the thresholds that moved between two seasons
+     * @param fromIndex Older season index
+     * @param toIndex Newer season index
+     * @param playlist Playlist ID, or 0 for every playlist both seasons hold
+     * @return Changed ranked divisions, by playlist then tier and division
+     */
+    std::vector<SeasonThresholdChange> Diff(int fromIndex, int toIndex, int playlist = 0) const;
+
+private:
+    int PlaylistColumn(int playlist) const;
+
+    MappedFile file;
+    const SeasonArchiveHeader* header = nullptr;
+    const int32_t* seasons = nullptr;
+    const int32_t* playlists = nullptr;
+    const uint8_t* present = nullptr;
+    const SeasonArchiveColumn* columns = nullptr;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// ============================================================================
+// SEQUENCE LOCK
+// ============================================================================
+
+/**
+ * @brief Publishes a small trivially copyable value from one writer to any readers
+ *
+ * The writer makes the sequence odd, copies the value in and makes it even
+ * again. A reader copies the value out and retries if the sequence moved or
+ * was odd, so neither side ever blocks and a reader never sees a half
+ * written value. The value is stored as relaxed atomic words, which keeps
+ * the racing copies well defined.
+ *
+ * Single writer: Store() must always be called from the same thread.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock values are copied bytewise");
+
+public:
+    SeqLock() { Store(T{}); }
+
+    explicit SeqLock(const T& value) { Store(value); }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /**
+     * @brief Replaces the value, wait-free
+     * @param value New value
+     */
+    void Store(const T& value) {
+        std::array<uint64_t, WORD_COUNT> buffer{};
+        std::memcpy(buffer.data(), &value, sizeof(T));
+
+        uint64_t start = sequence.load(std::memory_order_relaxed);
+        sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < WORD_COUNT; i++) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        sequence.store(start + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns a consistent copy of the value, retrying while a store overlaps
+     */
+    T Load() const {
+        std::array<uint64_t, WORD_COUNT> buffer;
+        uint64_t before;
+        uint64_t after;
+        do {
+            before = sequence.load(std::memory_order_acquire);
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while (before != after || (before & 1) != 0);
+
+        T value;
+        std::memcpy(static_cast<void*>(&value), buffer.data(), sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Number of stores so far, the initial value included
+     */
+    uint64_t Version() const { return sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr size_t WORD_COUNT = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> sequence{ 0 };
+    std::array<std::atomic<uint64_t>, WORD_COUNT> words{};
+};
@@ -0,0 +1,88 @@
+#include "SessionStats.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+std::string FormatSession(const PlaylistSession& session) {
+    if (!session.hasMMR && session.games == 0) {
+        return "";
+    }
+
+    char text[96];
+    int delta = static_cast<int>(std::lround(session.MMRDelta()));
+    int length = snprintf(text, sizeof(text), "Session %+d", delta);
+
+    if (session.games > 0) {
+        snprintf(text + length, sizeof(text) - length, "  %c%d  %d-%d (%.0f%%)",
+            session.streak >= 0 ? 'W' : 'L', std::abs(session.streak),
+            session.wins, session.losses, session.WinRate() * 100.0f);
+    }
+    return text;
+}
+
+SessionTracker::SessionTracker() {
+    for (int slot = 0; slot < RANK_PLAYLIST_COUNT; slot++) {
+        sessions[slot].playlist = RankTable::rankedPlaylists[slot];
+        Publish(slot);
+    }
+}
+
+void SessionTracker::RecordMMR(int playlist, float mmr) {
+    int slot = RankTable::PlaylistSlot(playlist);
+    if (slot < 0) {
+        return;
+    }
+
+    PlaylistSession& session = sessions[slot];
+    if (!session.hasMMR) {
+        session.hasMMR = true;
+        session.startMMR = mmr;
+    }
+    session.currentMMR = mmr;
+    Publish(slot);
+}
+
+void SessionTracker::RecordMatch(int playlist, MatchOutcome outcome) {
+    int slot = RankTable::PlaylistSlot(playlist);
+    if (slot < 0 || outcome == MatchOutcome::None) {
+        return;
+    }
+
+    PlaylistSession& session = sessions[slot];
+    session.games++;
+    if (outcome == MatchOutcome::Win) {
+        session.wins++;
+        session.streak = (session.streak > 0) ? session.streak + 1 : 1;
+    }
+    else {
+        session.losses++;
+        session.streak = (session.streak < 0) ? session.streak - 1 : -1;
+    }
+    Publish(slot);
+}
+
+void SessionTracker::Reset() {
+    for (int slot = 0; slot < RANK_PLAYLIST_COUNT; slot++) {
+        PlaylistSession& session = sessions[slot];
+        PlaylistSession fresh;
+        fresh.playlist = session.playlist;
+        fresh.hasMMR = session.hasMMR;
+        fresh.startMMR = session.currentMMR;
+        fresh.currentMMR = session.currentMMR;
+        session = fresh;
+        Publish(slot);
+    }
+}
+
+PlaylistSession SessionTracker::Read(int playlist) const {
+    int slot = RankTable::PlaylistSlot(playlist);
+    if (slot < 0) {
+        return PlaylistSession{};
+    }
+    return published[slot].Load();
+}
+
+void SessionTracker::Publish(int slot) {
+    published[slot].Store(sessions[slot]);
+}
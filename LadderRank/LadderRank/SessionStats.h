@@ -0,0 +1,90 @@
+#pragma once
+
+#include "MMRHistory.h"
+#include "RankTable.h"
+#include "SeqLock.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+// ============================================================================
+// SESSION STATISTICS
+// ============================================================================
+
+/**
+ * @brief Running aggregates of one playlist since the game started
+ *
+ * Trivially copyable so it can be published through a SeqLock.
+ */
+struct PlaylistSession {
+    int32_t playlist = 0;
+    bool hasMMR = false;      // startMMR and currentMMR are set
+    float startMMR = 0.0f;    // First reading of the session
+    float currentMMR = 0.0f;  // Latest reading
+    int32_t games = 0;        // Matches with a known outcome
+    int32_t wins = 0;
+    int32_t losses = 0;
+    int32_t streak = 0;       // Positive for wins in a row, negative for losses
+
+    float MMRDelta() const { return hasMMR ? currentMMR - startMMR : 0.0f; }
+    float WinRate() const { return games > 0 ? static_cast<float>(wins) / games : 0.0f; }
+};
+
+/**
+ * @brief Formats a session for the overlay, like "Session +23  W3  5-2 (71%)"
+ * @param session Session to format
+ * @return Display text, empty if the session has nothing to show yet
+ */
+std::string FormatSession(const PlaylistSession& session);
+
+/**
+ * @brief Keeps session statistics per ranked playlist, updated in O(1)
+ *
+ * Every update touches one PlaylistSession and republishes only that one.
+ * Record*() and Reset() must run on one thread (the game thread). Read()
+ * is lock-free and can run on any thread, including the render thread.
+ * Has no BakkesMod dependency.
+ */
+class SessionTracker {
+public:
+    SessionTracker();
+
+    /**
+     * @brief Records an MMR reading, the first one of a playlist starts its session
+     * @param playlist Playlist ID
+     * @param mmr MMR reading
+     */
+    void RecordMMR(int playlist, float mmr);
+
+    /**
+     * @brief Records the result of a match
+     * @param playlist Playlist ID
+     * @param outcome Result, None is ignored
+     */
+    void RecordMatch(int playlist, MatchOutcome outcome);
+
+    /**
+     * @brief Starts a new session for every playlist, from their latest MMR
+     */
+    void Reset();
+
+    /**
+     * @brief Returns a consistent copy of a playlist's session
+     * @param playlist Playlist ID
+     * @return Session, empty for playlists that are not ranked
+     */
+    PlaylistSession Read(int playlist) const;
+
+private:
+    /**
+     * @brief Publishes the writer's copy of one slot
+     */
+    void Publish(int slot);
+
+    // Writer's copies, only touched by the updating thread
+    std::array<PlaylistSession, RANK_PLAYLIST_COUNT> sessions;
+
+    // What readers see, indexed by RankTable::PlaylistSlot like sessions
+    std::array<SeqLock<PlaylistSession>, RANK_PLAYLIST_COUNT> published;
+};
@@ -0,0 +1,41 @@
+# Bakes IconBundle.bin from the RankIcons PNGs with tools/IconBake.
+# Usage: bake_icon_bundle.ps1 <RankIcons folder> <output file> <build folder>
+$iconFolder = $args[0]
+$output = $args[1]
+$buildFolder = $args[2]
+
+$toolFolder = Join-Path $PSScriptRoot "../tools/IconBake"
+$sources = @(
+    (Join-Path $toolFolder "IconBake.cpp"),
+    (Join-Path $PSScriptRoot "IconBundle.cpp"),
+    (Join-Path $PSScriptRoot "IconAtlas.cpp"),
+    (Join-Path $PSScriptRoot "IconImage.cpp"),
+    (Join-Path $PSScriptRoot "MappedFile.cpp"),
+    (Join-Path $PSScriptRoot "RankBinary.cpp")
+)
+$headers = "IconBundle.h", "IconAtlas.h", "IconImage.h", "MappedFile.h", "RankBinary.h" |
+    ForEach-Object { Join-Path $PSScriptRoot $_ }
+
+# Only bake when an icon or the baking code is newer than the bundle, it takes a few seconds
+$inputs = @(Get-ChildItem -Path $iconFolder -Filter "*.png") + @(Get-Item ($sources + $headers))
+if (Test-Path $output) {
+    $baked = (Get-Item $output).LastWriteTimeUtc
+    $newest = ($inputs | Measure-Object -Property LastWriteTimeUtc -Maximum).Maximum
+    if ($newest -le $baked) {
+        exit 0
+    }
+}
+
+# The bundle is optional, the plugin decodes the PNGs without one, so a failure only warns
+New-Item -ItemType Directory -Force -Path $buildFolder | Out-Null
+$tool = Join-Path $buildFolder "IconBake.exe"
+& cl.exe /nologo /std:c++20 /O2 /EHsc "/I$PSScriptRoot" "/Fo$buildFolder/" "/Fe$tool" $sources
+if ($LASTEXITCODE -ne 0) {
+    Write-Warning "IconBake did not build, IconBundle.bin was not baked"
+    exit 0
+}
+& $tool $iconFolder $output
+if ($LASTEXITCODE -ne 0) {
+    Write-Warning "IconBake failed, IconBundle.bin was not baked"
+    exit 0
+}
@@ -0,0 +1,77 @@
+# Generates RankTablesEmbedded.h from the RankNumbers JSON files.
+# Usage: generate_rank_tables.ps1 <RankNumbers folder> <output header>
+$rankFolder = $args[0]
+$output = $args[1]
+
+$playlists = 10, 11, 13, 27, 28, 29, 30, 34
+$tierCount = 23
+$divisionCount = 4
+
+$lines = @(
+    "// Generated by generate_rank_tables.ps1 from LadderRankData/LadderRank/RankNumbers, do not edit.",
+    "#pragma once",
+    "",
+    "#include `"RankTable.h`"",
+    "",
+    "struct EmbeddedRankTable {",
+    "    int playlist;",
+    "    RankThreshold entries[RANK_TIER_COUNT * RANK_DIVISION_COUNT];",
+    "    int32_t players[RANK_TIER_COUNT * RANK_DIVISION_COUNT];",
+    "};",
+    "",
+    "constexpr EmbeddedRankTable EMBEDDED_RANK_TABLES[RANK_PLAYLIST_COUNT] = {"
+)
+
+foreach ($playlist in $playlists) {
+    $json = Get-Content -Path (Join-Path $rankFolder "$playlist.json") -Raw | ConvertFrom-Json
+
+    $entries = New-Object 'string[]' ($tierCount * $divisionCount)
+    for ($i = 0; $i -lt $entries.Length; $i++) {
+        $entries[$i] = "{ 0, 0 }"
+    }
+    $players = New-Object 'long[]' ($tierCount * $divisionCount)
+    $present = New-Object 'bool[]' ($tierCount * $divisionCount)
+    foreach ($entry in $json.data.data) {
+        $index = $entry.tier * $divisionCount + $entry.division
+        if ($entry.tier -lt 0 -or $entry.tier -ge $tierCount -or $entry.division -lt 0 -or $entry.division -ge $divisionCount) {
+            throw "$playlist.json: no slot for tier $($entry.tier) division $($entry.division)"
+        }
+        if ($present[$index]) {
+            throw "$playlist.json: tier $($entry.tier) division $($entry.division) appears twice"
+        }
+        $present[$index] = $true
+        $entries[$index] = "{ $($entry.minMMR), $($entry.maxMMR) }"
+        $players[$index] = [Math]::Max(0, [long]$entry.players)
+    }
+
+    # Unranked and Supersonic Legend have a single division, every other tier has four
+    for ($tier = 0; $tier -lt $tierCount; $tier++) {
+        $divisions = if ($tier -eq 0 -or $tier -eq $tierCount - 1) { 1 } else { $divisionCount }
+        for ($division = 0; $division -lt $divisions; $division++) {
+            if (-not $present[$tier * $divisionCount + $division]) {
+                throw "$playlist.json: missing tier $tier division $division"
+            }
+        }
+    }
+
+    $lines += "    { $playlist, {"
+    for ($tier = 0; $tier -lt $tierCount; $tier++) {
+        $row = $entries[($tier * $divisionCount)..($tier * $divisionCount + $divisionCount - 1)] -join ", "
+        $lines += "        $row,"
+    }
+    $lines += "    }, {"
+    for ($tier = 0; $tier -lt $tierCount; $tier++) {
+        $row = $players[($tier * $divisionCount)..($tier * $divisionCount + $divisionCount - 1)] -join ", "
+        $lines += "        $row,"
+    }
+    $lines += "    } },"
+}
+
+$lines += "};"
+$content = ($lines -join "`n") + "`n"
+
+# Only touch the header when the data changed so it does not force a rebuild
+if ((Test-Path $output) -and ((Get-Content -Path $output -Raw) -eq $content)) {
+    exit 0
+}
+[System.IO.File]::WriteAllText((Join-Path (Get-Location) $output), $content)
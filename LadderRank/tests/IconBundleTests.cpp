@@ -0,0 +1,134 @@
+#include "AssetLoader.h"
+#include "IconBundle.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+constexpr int ICON_COUNT = 23;  // RANK_TIER_COUNT of the plugin
+
+static std::filesystem::path DataFile(const std::string& name) {
+    return std::filesystem::path(LADDERRANK_DATA_DIR) / name;
+}
+
+static std::filesystem::path BakedBundle() {
+    return LADDERRANK_BUNDLE;
+}
+
+static std::vector<std::filesystem::path> RankIconSources() {
+    std::vector<std::filesystem::path> sources;
+    for (int tier = 0; tier < ICON_COUNT; tier++) {
+        sources.push_back(DataFile("RankIcons") / (std::to_string(tier) + ".png"));
+    }
+    return sources;
+}
+
+/**
+ * @brief Runs one request through a loader and waits for its result
+ */
+static AssetResult LoadOnce(AssetRequest request) {
+    AssetLoader loader(4);
+    AssetResult result;
+    std::atomic<bool> done{ false };
+    loader.Start(1, [&](AssetResult& delivered) {
+        result = std::move(delivered);
+        done = true;
+        });
+    CHECK(loader.Submit(std::move(request)) != 0);
+    while (!done.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    loader.Stop();
+    return result;
+}
+
+// ============================================================================
+// BAKED BUNDLE
+// ============================================================================
+
+/**
+ * @brief The IconBundle.bin IconBake made from the RankIcons has the default
+ * buckets, and every bucket reads back intact
+ */
+static void TestBakedBundleMatchesIcons() {
+    IconBundle bundle;
+    std::string error;
+    CHECK(bundle.Open(BakedBundle(), error));
+    CHECK(bundle.IconCount() == ICON_COUNT);
+    CHECK(bundle.MatchesSources(RankIconSources(), error));
+    CHECK((bundle.CellSizes() == std::vector<int>{ 64, 128, 256 }));
+
+    std::vector<int> cells = bundle.CellSizes();
+    for (int bucket = 0; bucket < static_cast<int>(cells.size()); bucket++) {
+        IconAtlas atlas;
+        CHECK(bundle.ReadBucket(bucket, atlas, error));
+        CHECK(atlas.regions.size() == ICON_COUNT);
+        for (const AtlasRegion& region : atlas.regions) {
+            CHECK(region.Valid());
+            CHECK(std::max(region.width, region.height) <= cells[bucket]);
+        }
+    }
+}
+
+/**
+ * @brief The loader picks the bucket that fits the requested icon size
+ */
+static void TestLoaderPicksBucket() {
+    int cells[] = { 64, 128, 256 };
+    CHECK(PickIconBucket(cells, 0.0f) == 0);
+    CHECK(PickIconBucket(cells, 64.0f) == 0);
+    CHECK(PickIconBucket(cells, 65.0f) == 1);
+    CHECK(PickIconBucket(cells, 900.0f) == 2);
+
+    for (auto [pixels, cell] : { std::pair{ 60.0f, 64 }, std::pair{ 80.0f, 128 }, std::pair{ 300.0f, 256 } }) {
+        AssetResult result = LoadOnce(AssetRequest{ -1, RankIconSources(), 256, BakedBundle(), pixels });
+        CHECK(result.bundleError.empty());
+        CHECK(result.cellSize == cell);
+        CHECK(result.images.size() == 1);
+        CHECK(result.regions.size() == ICON_COUNT);
+    }
+}
+
+/**
+ * @brief A corrupt or stale bundle is rejected and the icons are decoded
+ */
+static void TestBadBundleFallsBack() {
+    auto corrupt = std::filesystem::temp_directory_path() / "LadderRankTests_IconBundle.bin";
+    std::filesystem::copy_file(BakedBundle(), corrupt, std::filesystem::copy_options::overwrite_existing);
+    {
+        std::fstream file(corrupt, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-10, std::ios::end);
+        file.put('x');
+    }
+
+    AssetResult result = LoadOnce(AssetRequest{ -1, RankIconSources(), 256, corrupt, 300.0f });
+    CHECK(!result.bundleError.empty());
+    CHECK(result.regions.empty());
+    CHECK(result.images.size() == ICON_COUNT);
+    CHECK(result.Failures() == 0);
+    std::filesystem::remove(corrupt);
+
+    std::vector<std::filesystem::path> swapped = RankIconSources();
+    std::swap(swapped[3], swapped[20]);
+    IconBundle bundle;
+    std::string error;
+    CHECK(bundle.Open(BakedBundle(), error));
+    CHECK(!bundle.MatchesSources(swapped, error));
+}
+
+int main() {
+    RUN_TEST(TestBakedBundleMatchesIcons);
+    RUN_TEST(TestLoaderPicksBucket);
+    RUN_TEST(TestBadBundleFallsBack);
+    return TestResult();
+}
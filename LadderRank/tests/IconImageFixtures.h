@@ -0,0 +1,790 @@
+#pragma once
+
+// Generated by make_png_fixtures.py, do not edit.
+//
+// 16x16 PNGs of the image TestPixel() describes, one filter type per row
+// in turn, deflated by zlib. The BAD_, BOMB_ and truncated ones keep valid
+// chunk checksums, so only the inflater or the unfilter can reject them.
+
+#include <cstdint>
+
+static const uint8_t RGBA_STORED[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x04, 0x1b, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x10, 0x04, 0xef, 0xfb,
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xf7, 0x00, 0xff, 0x20, 0xef, 0x00, 0xff, 0x30, 0xe7, 0x00,
+    0xff, 0x40, 0xdf, 0x00, 0xff, 0x50, 0xd7, 0x00, 0xff, 0x60, 0xcf, 0x00, 0xff, 0x70, 0xc7, 0x00,
+    0xff, 0x80, 0xbf, 0x00, 0xff, 0x90, 0xb7, 0x00, 0xff, 0xa0, 0xaf, 0x00, 0xff, 0xb0, 0xa7, 0x00,
+    0xff, 0xc0, 0x9f, 0x00, 0xff, 0xd0, 0x97, 0x00, 0xff, 0xe0, 0x8f, 0x00, 0xff, 0xf0, 0x87, 0x00,
+    0xff, 0x01, 0x01, 0xfb, 0x00, 0xf7, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x02, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0xf8, 0x01, 0xfc, 0x06, 0xf8, 0x01,
+    0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c, 0xf8, 0x01, 0xfc, 0x0f, 0xf8, 0x01, 0xfc, 0x12, 0xf8, 0x01,
+    0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18, 0xf8, 0x01, 0xfc, 0x1b, 0xf8, 0x01, 0xfc, 0x1e, 0xf8, 0x01,
+    0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24, 0xf8, 0x01, 0xfc, 0x27, 0xf8, 0x01, 0xfc, 0x2a, 0xf8, 0x01,
+    0xfc, 0x2d, 0xf8, 0x03, 0x02, 0x78, 0x00, 0x70, 0x09, 0xfa, 0x06, 0xfc, 0x09, 0xfa, 0x08, 0xfc,
+    0x09, 0xfa, 0x09, 0xfc, 0x09, 0xfa, 0x0b, 0xfc, 0x09, 0xfa, 0x0c, 0xfc, 0x09, 0xfa, 0x0e, 0xfc,
+    0x09, 0xfa, 0x0f, 0xfc, 0x09, 0xfa, 0x11, 0xfc, 0x09, 0xfa, 0x12, 0xfc, 0x09, 0xfa, 0x14, 0xfc,
+    0x09, 0xfa, 0x15, 0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa, 0x1a, 0xfc,
+    0x09, 0xfa, 0x1b, 0xfc, 0x04, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xfc, 0x06,
+    0x00, 0x01, 0xfc, 0x09, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c,
+    0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c,
+    0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c,
+    0x00, 0x01, 0xfc, 0x0c, 0x00, 0x00, 0x05, 0xeb, 0x00, 0xd7, 0x15, 0xe3, 0x0f, 0xd7, 0x25, 0xdb,
+    0x1e, 0xd7, 0x35, 0xd3, 0x2d, 0xd7, 0x45, 0xcb, 0x3c, 0xd7, 0x55, 0xc3, 0x4b, 0xd7, 0x65, 0xbb,
+    0x5a, 0xd7, 0x75, 0xb3, 0x69, 0xd7, 0x85, 0xab, 0x78, 0xd7, 0x95, 0xa3, 0x87, 0xd7, 0xa5, 0x9b,
+    0x96, 0xd7, 0xb5, 0x93, 0xa5, 0xd7, 0xc5, 0x8b, 0xb4, 0xd7, 0xd5, 0x83, 0xc3, 0xd7, 0xe5, 0x7b,
+    0xd2, 0xd7, 0xf5, 0x73, 0xe1, 0xd7, 0x01, 0x06, 0xe7, 0x00, 0xcf, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x02, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0xf8,
+    0x01, 0xfc, 0x06, 0xf8, 0x01, 0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c, 0xf8, 0x01, 0xfc, 0x0f, 0xf8,
+    0x01, 0xfc, 0x12, 0xf8, 0x01, 0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18, 0xf8, 0x01, 0xfc, 0x1b, 0xf8,
+    0x01, 0xfc, 0x1e, 0xf8, 0x01, 0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24, 0xf8, 0x01, 0xfc, 0x27, 0xf8,
+    0x01, 0xfc, 0x2a, 0xf8, 0x01, 0xfc, 0x2d, 0xf8, 0x03, 0x05, 0x6e, 0x00, 0x5c, 0x09, 0xfa, 0x0e,
+    0xfc, 0x09, 0xfa, 0x0f, 0xfc, 0x09, 0xfa, 0x11, 0xfc, 0x09, 0xfa, 0x12, 0xfc, 0x09, 0xfa, 0x14,
+    0xfc, 0x09, 0xfa, 0x15, 0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa, 0x1a,
+    0xfc, 0x09, 0xfa, 0x1b, 0xfc, 0x09, 0xfa, 0x1d, 0xfc, 0x09, 0xfa, 0x9e, 0xfc, 0x09, 0xfa, 0x20,
+    0xfc, 0x09, 0xfa, 0x21, 0xfc, 0x09, 0xfa, 0x23, 0xfc, 0x04, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc,
+    0x03, 0x00, 0x01, 0xfc, 0x06, 0x00, 0x01, 0xfc, 0x09, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc,
+    0x0f, 0x00, 0x01, 0xfc, 0x12, 0x00, 0x01, 0xfc, 0x15, 0x00, 0x01, 0xfc, 0x18, 0x00, 0x01, 0xfc,
+    0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x21, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc,
+    0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x00, 0x0a, 0xd7, 0x00, 0xaf, 0x1a,
+    0xcf, 0x1e, 0xaf, 0x2a, 0xc7, 0x3c, 0xaf, 0x3a, 0xbf, 0x5a, 0xaf, 0x4a, 0xb7, 0x78, 0xaf, 0x5a,
+    0xaf, 0x96, 0xaf, 0x6a, 0xa7, 0xb4, 0xaf, 0x7a, 0x9f, 0xd2, 0xaf, 0x8a, 0x97, 0xf0, 0xaf, 0x9a,
+    0x8f, 0x0e, 0xaf, 0xaa, 0x87, 0x2c, 0xaf, 0xba, 0x7f, 0x4a, 0xaf, 0xca, 0x77, 0x68, 0xaf, 0xda,
+    0x6f, 0x86, 0xaf, 0xea, 0x67, 0xa4, 0xaf, 0xfa, 0x5f, 0xc2, 0xaf, 0x01, 0x0b, 0xd3, 0x00, 0xa7,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x02, 0x01, 0xfc, 0x00,
+    0xf8, 0x01, 0xfc, 0x03, 0xf8, 0x01, 0xfc, 0x06, 0xf8, 0x01, 0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c,
+    0xf8, 0x01, 0xfc, 0x0f, 0xf8, 0x01, 0xfc, 0x12, 0xf8, 0x01, 0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18,
+    0xf8, 0x01, 0xfc, 0x1b, 0xf8, 0x01, 0xfc, 0x1e, 0xf8, 0x01, 0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24,
+    0xf8, 0x01, 0xfc, 0x27, 0xf8, 0x01, 0xfc, 0x2a, 0xf8, 0x01, 0xfc, 0x2d, 0xf8, 0x03, 0x07, 0x64,
+    0x00, 0x48, 0x09, 0xfa, 0x15, 0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa,
+    0x1a, 0xfc, 0x09, 0xfa, 0x1b, 0xfc, 0x09, 0xfa, 0x1d, 0xfc, 0x09, 0xfa, 0x1e, 0xfc, 0x09, 0xfa,
+    0x20, 0xfc, 0x09, 0xfa, 0x21, 0xfc, 0x09, 0xfa, 0x23, 0xfc, 0x09, 0xfa, 0x24, 0xfc, 0x09, 0xfa,
+    0x26, 0xfc, 0x09, 0xfa, 0x27, 0xfc, 0x09, 0xfa, 0x29, 0xfc, 0x09, 0xfa, 0x2a, 0xfc, 0x04, 0x01,
+    0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xfc, 0x06, 0x00, 0x01, 0xfc, 0x09, 0x00, 0x01,
+    0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0f, 0x00, 0x01, 0xfc, 0x12, 0x00, 0x01, 0xfc, 0x15, 0x00, 0x01,
+    0xfc, 0x18, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1e, 0x00, 0x01, 0xfc, 0x21, 0x00, 0x01,
+    0xfc, 0x24, 0x00, 0x01, 0xfc, 0x27, 0x00, 0x01, 0xfc, 0x2a, 0x00, 0x01, 0xfc, 0x2a, 0x00, 0x00,
+    0x0f, 0xc3, 0x00, 0x87, 0x1f, 0xbb, 0x2d, 0x87, 0x2f, 0xb3, 0x5a, 0x87, 0x3f, 0xab, 0x87, 0x87,
+    0x4f, 0xa3, 0xb4, 0x87, 0x5f, 0x9b, 0xe1, 0x87, 0x6f, 0x93, 0x0e, 0x87, 0x7f, 0x8b, 0x3b, 0x87,
+    0x8f, 0x83, 0x68, 0x87, 0x9f, 0x7b, 0x95, 0x87, 0xaf, 0x73, 0xc2, 0x87, 0xbf, 0x6b, 0xef, 0x87,
+    0xcf, 0x63, 0x1c, 0x87, 0xdf, 0x5b, 0x49, 0x87, 0xef, 0x53, 0x76, 0x87, 0xff, 0x4b, 0xa3, 0x87,
+    0x2b, 0x0a, 0xbe, 0xbc, 0xd8, 0x40, 0x14, 0x96, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t RGBA_FIXED[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x01, 0xf8, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x63, 0x60, 0xf8, 0xcf, 0xf0,
+    0x5f, 0xe0, 0x3b, 0xc3, 0x7f, 0x85, 0xf7, 0x0c, 0xff, 0x0d, 0x9e, 0x33, 0xfc, 0x77, 0xb8, 0xcf,
+    0xf0, 0x3f, 0xe0, 0x3a, 0xc3, 0xff, 0x84, 0xf3, 0x0c, 0xff, 0x0b, 0x8e, 0x33, 0xfc, 0x6f, 0xd8,
+    0xcf, 0xf0, 0x7f, 0xc2, 0x76, 0x86, 0xff, 0x0b, 0xd6, 0x33, 0xfc, 0xdf, 0xb0, 0x9c, 0xe1, 0xff,
+    0x81, 0xf9, 0x0c, 0xff, 0x2f, 0x4c, 0x67, 0xf8, 0xff, 0xa0, 0x9f, 0xe1, 0xff, 0x87, 0x76, 0x86,
+    0xff, 0x8c, 0x8c, 0xbf, 0x19, 0xbe, 0x0b, 0xfc, 0x60, 0x66, 0x20, 0x17, 0x33, 0x31, 0xfe, 0x61,
+    0xf8, 0xc1, 0xf8, 0x87, 0x19, 0x88, 0xd9, 0x80, 0x98, 0x13, 0x88, 0x79, 0x80, 0x98, 0x1f, 0x88,
+    0x85, 0x80, 0x58, 0x14, 0x88, 0x25, 0x80, 0x58, 0x1a, 0x88, 0xe5, 0x80, 0x58, 0x11, 0x88, 0x55,
+    0x80, 0x58, 0x1d, 0x88, 0xb5, 0x80, 0x58, 0xf7, 0x07, 0x33, 0x53, 0x05, 0x43, 0x01, 0xe7, 0x2f,
+    0xb6, 0x3f, 0x9c, 0xbf, 0x38, 0x80, 0x98, 0x13, 0x88, 0xb9, 0x81, 0x98, 0x07, 0x88, 0xf9, 0x80,
+    0x98, 0x1f, 0x88, 0x05, 0x81, 0x58, 0x08, 0x88, 0x45, 0x80, 0x58, 0x14, 0x88, 0xc5, 0x81, 0x58,
+    0x02, 0x88, 0xa5, 0x80, 0x58, 0xfa, 0x0f, 0x0b, 0xd4, 0x05, 0x0c, 0x40, 0x17, 0x00, 0x31, 0x27,
+    0x10, 0xf3, 0x90, 0x84, 0x19, 0x58, 0x5f, 0x33, 0x5c, 0x17, 0x7d, 0xcc, 0x7f, 0x5d, 0xf5, 0xb6,
+    0xdc, 0x75, 0xd3, 0xcb, 0xba, 0xd7, 0x5d, 0x4f, 0xdb, 0x5c, 0x0f, 0x3d, 0xec, 0x7d, 0x3d, 0x75,
+    0x77, 0xd4, 0xf5, 0xd2, 0xcd, 0x99, 0xd7, 0x5b, 0x57, 0x57, 0x5c, 0x9f, 0xba, 0xb8, 0xfd, 0xfa,
+    0xd2, 0xd9, 0xd3, 0xae, 0x6f, 0x9d, 0xbc, 0xf4, 0xfa, 0xd1, 0xee, 0x2d, 0xd7, 0xaf, 0x36, 0x1f,
+    0xbe, 0xfe, 0xb4, 0xfa, 0xd2, 0xf5, 0xaf, 0xc5, 0x0f, 0xaf, 0x33, 0xb2, 0x3d, 0x67, 0x38, 0x2f,
+    0xf0, 0x43, 0x88, 0x81, 0x5c, 0x4c, 0x79, 0x20, 0xb2, 0xe6, 0x31, 0xc4, 0x10, 0x1b, 0x60, 0x9c,
+    0xbf, 0x64, 0x81, 0x78, 0x1e, 0x10, 0x2b, 0x00, 0xb1, 0x22, 0x10, 0x2b, 0xe3, 0x0a, 0x44, 0x7e,
+    0x20, 0x16, 0x02, 0x62, 0x51, 0x20, 0x96, 0x00, 0x62, 0x69, 0x28, 0x56, 0x44, 0x62, 0x43, 0x30,
+    0x03, 0xd7, 0x75, 0x86, 0xf5, 0x52, 0xe7, 0xe5, 0xd6, 0x6b, 0x1d, 0xb7, 0x59, 0x6f, 0xb5, 0x3f,
+    0x6a, 0xbd, 0xd7, 0xf6, 0x8a, 0xf5, 0x51, 0xeb, 0xa7, 0xad, 0xcf, 0x5a, 0xbe, 0x65, 0x7d, 0xd5,
+    0xfc, 0x4b, 0xeb, 0xbb, 0xa6, 0x7f, 0x58, 0x3f, 0xab, 0x9f, 0x6f, 0xfd, 0xaa, 0x76, 0x9d, 0xf5,
+    0xbb, 0xea, 0xbd, 0xd6, 0x9f, 0x2a, 0xcf, 0x58, 0x7f, 0x2b, 0xbf, 0x6d, 0xfd, 0xab, 0xf4, 0x25,
+    0xeb, 0x7f, 0xc5, 0x1f, 0x5a, 0xcf, 0xc8, 0x7d, 0x99, 0x61, 0xb9, 0xc0, 0x0f, 0x45, 0x06, 0x72,
+    0x31, 0xe5, 0x81, 0xc8, 0x9e, 0xc2, 0xe0, 0x81, 0x3b, 0xc0, 0xe4, 0x50, 0x02, 0x8c, 0xf3, 0x97,
+    0x0a, 0x10, 0xab, 0x01, 0xb1, 0x3a, 0x10, 0x6b, 0x02, 0xb1, 0x16, 0x29, 0x81, 0x28, 0x07, 0x0d,
+    0x44, 0x15, 0x20, 0x56, 0x07, 0x62, 0x2d, 0x30, 0x66, 0xe0, 0x3f, 0xcc, 0xd0, 0x2e, 0xbf, 0x5b,
+    0xb7, 0x5d, 0x7f, 0x73, 0x54, 0xbb, 0xfd, 0xea, 0xf6, 0x76, 0xff, 0xc5, 0x5b, 0xda, 0xe3, 0x67,
+    0x3f, 0x6c, 0xcf, 0x9f, 0xcc, 0xd7, 0x5e, 0xdf, 0x6d, 0xdd, 0xde, 0xdf, 0x9c, 0xd1, 0x3e, 0xbf,
+    0x7a, 0x6a, 0xfb, 0xfa, 0xe2, 0x43, 0xed, 0xfb, 0xb3, 0xdf, 0xb7, 0x9f, 0x4f, 0x96, 0x69, 0xbf,
+    0x1f, 0xed, 0xd9, 0xfe, 0x3e, 0xb8, 0xac, 0xfd, 0xbf, 0xf7, 0xe2, 0x76, 0x00, 0x2b, 0x0a, 0xbe,
+    0xbc, 0xaf, 0x95, 0x59, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+    0x82,
+};
+
+static const uint8_t RGBA_DYNAMIC[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x01, 0xd5, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xa5, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0x72, 0xf5, 0xe6, 0xd8, 0xbb, 0x46, 0xa3, 0xe1, 0xea, 0xcd,
+    0xd1, 0x6a, 0x38, 0x1a, 0x75, 0xe9, 0x52, 0x42, 0x5d, 0x82, 0xd2, 0x43, 0x41, 0x74, 0x59, 0x81,
+    0x41, 0x45, 0x5a, 0x90, 0x82, 0x54, 0x23, 0x0f, 0x06, 0x52, 0x3f, 0xc8, 0xc3, 0x02, 0x51, 0x21,
+    0xa1, 0x05, 0x4b, 0x06, 0x79, 0xf8, 0x05, 0x2e, 0x84, 0x3c, 0x2c, 0x1c, 0x21, 0xd4, 0x61, 0xa1,
+    0xc4, 0x1f, 0xea, 0x60, 0x12, 0x21, 0xd8, 0x61, 0x5e, 0xc2, 0x97, 0xb7, 0xc1, 0xdf, 0x87, 0xda,
+    0xa1, 0x0e, 0x42, 0xce, 0xc3, 0x07, 0x9e, 0xe3, 0xc3, 0x97, 0x48, 0x93, 0x0e, 0xac, 0x91, 0x6e,
+    0xa9, 0x90, 0x3e, 0xba, 0x4c, 0xfa, 0xd4, 0x22, 0xe9, 0xf3, 0x8a, 0xf4, 0x95, 0x32, 0xe9, 0xde,
+    0x39, 0xd2, 0x0f, 0x8a, 0xa4, 0x9f, 0x4c, 0x93, 0x7e, 0x2e, 0xa4, 0x5f, 0xe5, 0x49, 0xbf, 0xcd,
+    0x92, 0xfe, 0x38, 0x46, 0xfa, 0x6b, 0x86, 0xf4, 0x2a, 0x93, 0x36, 0x8c, 0x5f, 0xb4, 0x16, 0x70,
+    0x3c, 0x54, 0xaf, 0x06, 0xa3, 0x4a, 0x8e, 0x51, 0xf5, 0x80, 0x17, 0x4c, 0xf0, 0x81, 0x05, 0x41,
+    0x08, 0x41, 0x18, 0x22, 0x60, 0x43, 0x14, 0x62, 0x10, 0x87, 0x04, 0x24, 0x1d, 0x4f, 0x43, 0x9a,
+    0x7a, 0x4d, 0xd7, 0x5b, 0x35, 0xdd, 0x1d, 0x60, 0x42, 0x13, 0xf8, 0xc0, 0x0f, 0x16, 0xec, 0x82,
+    0x20, 0xec, 0x86, 0x10, 0xec, 0x81, 0x30, 0x34, 0x43, 0xa4, 0xba, 0xad, 0xf6, 0x80, 0xf0, 0x00,
+    0x4c, 0xf0, 0x6d, 0x0a, 0x35, 0xfe, 0x20, 0x15, 0xfa, 0x66, 0xa9, 0x83, 0x5f, 0x6c, 0x75, 0x6c,
+    0x21, 0xa9, 0x4e, 0x7f, 0x68, 0x53, 0x17, 0x4b, 0x1d, 0xea, 0xfa, 0x4c, 0x4a, 0xdd, 0x99, 0xea,
+    0x56, 0x0f, 0x27, 0xd3, 0x6a, 0x24, 0xc7, 0x6a, 0x62, 0x7c, 0x54, 0xbd, 0x1e, 0x9e, 0x50, 0xef,
+    0x86, 0x0a, 0xea, 0xd3, 0x60, 0x49, 0x7d, 0xef, 0x9f, 0x57, 0x3f, 0xfb, 0x96, 0x94, 0xe1, 0x5d,
+    0xa6, 0x72, 0xc0, 0x09, 0x52, 0xbd, 0xb6, 0x1e, 0xb1, 0xf1, 0x36, 0x5d, 0xfe, 0xdf, 0x60, 0xa6,
+    0xbb, 0x0f, 0x9e, 0x41, 0x0b, 0x44, 0xe1, 0xc0, 0x46, 0x11, 0x2d, 0x08, 0x42, 0x08, 0xc2, 0x10,
+    0xa9, 0x89, 0xfe, 0xb5, 0xff, 0xa0, 0x9d, 0x8a, 0xa4, 0xb9, 0x6c, 0x4b, 0x62, 0xae, 0x4d, 0x8e,
+    0x17, 0x53, 0xd2, 0x3e, 0x9d, 0x96, 0x94, 0x8c, 0xca, 0xcd, 0x7c, 0x41, 0xee, 0x67, 0xe7, 0xe5,
+    0xf1, 0xd8, 0xaa, 0x3c, 0xcd, 0xf8, 0xe5, 0x25, 0x1f, 0x96, 0x37, 0x03, 0xed, 0xf2, 0xfe, 0x5e,
+    0x97, 0x7c, 0xee, 0x79, 0x24, 0x2b, 0x37, 0x5e, 0x88, 0xdb, 0x39, 0x2b, 0x46, 0xd3, 0x02, 0xe5,
+    0x03, 0x4e, 0x94, 0xea, 0xb5, 0xf5, 0x88, 0xdb, 0xaf, 0xd1, 0x99, 0x8d, 0x83, 0xd9, 0xff, 0x04,
+    0x33, 0xdd, 0x18, 0x1c, 0x82, 0x38, 0xb4, 0x42, 0x62, 0x33, 0x11, 0xed, 0x5a, 0xc4, 0x18, 0xc4,
+    0x21, 0xf1, 0x1b, 0x59, 0x25, 0xe2, 0xfd, 0x33, 0x49, 0x3e, 0x32, 0x95, 0xe2, 0x93, 0x93, 0xcc,
+    0xe7, 0x72, 0x05, 0xee, 0x1c, 0x5f, 0xe2, 0x9e, 0x61, 0x3f, 0x0f, 0x0c, 0x9d, 0xe0, 0xcc, 0x60,
+    0x17, 0x67, 0xfb, 0x47, 0x58, 0xfa, 0x66, 0xb9, 0x78, 0xab, 0xc2, 0xe5, 0xab, 0x7b, 0x79, 0xf1,
+    0xd2, 0x59, 0xae, 0x5c, 0xb8, 0xcb, 0xba, 0x23, 0xc7, 0xeb, 0x2b, 0x0a, 0xbe, 0xbc, 0x81, 0x8e,
+    0x94, 0x77, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t RGBA_SPLIT[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x00, 0x9d, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xa5, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0x72, 0xf5, 0xe6, 0xd8, 0xbb, 0x46, 0xa3, 0xe1, 0xea, 0xcd,
+    0xd1, 0x6a, 0x38, 0x1a, 0x75, 0xe9, 0x52, 0x42, 0x5d, 0x82, 0xd2, 0x43, 0x41, 0x74, 0x59, 0x81,
+    0x41, 0x45, 0x5a, 0x90, 0x82, 0x54, 0x23, 0x0f, 0x06, 0x52, 0x3f, 0xc8, 0xc3, 0x02, 0x51, 0x21,
+    0xa1, 0x05, 0x4b, 0x06, 0x79, 0xf8, 0x05, 0x2e, 0x84, 0x3c, 0x2c, 0x1c, 0x21, 0xd4, 0x61, 0xa1,
+    0xc4, 0x1f, 0xea, 0x60, 0x12, 0x21, 0xd8, 0x61, 0x5e, 0xc2, 0x97, 0xb7, 0xc1, 0xdf, 0x87, 0xda,
+    0xa1, 0x0e, 0x42, 0xce, 0xc3, 0x07, 0x9e, 0xe3, 0xc3, 0x97, 0x48, 0x93, 0x0e, 0xac, 0x91, 0x6e,
+    0xa9, 0x90, 0x3e, 0xba, 0x4c, 0xfa, 0xd4, 0x22, 0xe9, 0xf3, 0x8a, 0xf4, 0x95, 0x32, 0xe9, 0xde,
+    0x39, 0xd2, 0x0f, 0x8a, 0xa4, 0x9f, 0x4c, 0x93, 0x7e, 0x2e, 0xa4, 0x5f, 0xe5, 0x49, 0xbf, 0xcd,
+    0x92, 0xfe, 0x38, 0x46, 0xfa, 0x6b, 0x86, 0xf4, 0x2a, 0x93, 0x36, 0x8c, 0x5f, 0xb4, 0x16, 0x70,
+    0x3c, 0x54, 0xaf, 0x06, 0xa3, 0x4a, 0xe2, 0x7b, 0x34, 0xcc, 0x00, 0x00, 0x00, 0x9d, 0x49, 0x44,
+    0x41, 0x54, 0x8e, 0x51, 0xf5, 0x80, 0x17, 0x4c, 0xf0, 0x81, 0x05, 0x41, 0x08, 0x41, 0x18, 0x22,
+    0x60, 0x43, 0x14, 0x62, 0x10, 0x87, 0x04, 0x24, 0x1d, 0x4f, 0x43, 0x9a, 0x7a, 0x4d, 0xd7, 0x5b,
+    0x35, 0xdd, 0x1d, 0x60, 0x42, 0x13, 0xf8, 0xc0, 0x0f, 0x16, 0xec, 0x82, 0x20, 0xec, 0x86, 0x10,
+    0xec, 0x81, 0x30, 0x34, 0x43, 0xa4, 0xba, 0xad, 0xf6, 0x80, 0xf0, 0x00, 0x4c, 0xf0, 0x6d, 0x0a,
+    0x35, 0xfe, 0x20, 0x15, 0xfa, 0x66, 0xa9, 0x83, 0x5f, 0x6c, 0x75, 0x6c, 0x21, 0xa9, 0x4e, 0x7f,
+    0x68, 0x53, 0x17, 0x4b, 0x1d, 0xea, 0xfa, 0x4c, 0x4a, 0xdd, 0x99, 0xea, 0x56, 0x0f, 0x27, 0xd3,
+    0x6a, 0x24, 0xc7, 0x6a, 0x62, 0x7c, 0x54, 0xbd, 0x1e, 0x9e, 0x50, 0xef, 0x86, 0x0a, 0xea, 0xd3,
+    0x60, 0x49, 0x7d, 0xef, 0x9f, 0x57, 0x3f, 0xfb, 0x96, 0x94, 0xe1, 0x5d, 0xa6, 0x72, 0xc0, 0x09,
+    0x52, 0xbd, 0xb6, 0x1e, 0xb1, 0xf1, 0x36, 0x5d, 0xfe, 0xdf, 0x60, 0xa6, 0xbb, 0x0f, 0x9e, 0x41,
+    0x0b, 0x44, 0xe1, 0xc0, 0x46, 0x11, 0x2d, 0x08, 0x42, 0x08, 0xc2, 0x10, 0xa9, 0x89, 0xfe, 0x7a,
+    0x37, 0xb9, 0x1e, 0x00, 0x00, 0x00, 0x9b, 0x49, 0x44, 0x41, 0x54, 0xb5, 0xff, 0xa0, 0x9d, 0x8a,
+    0xa4, 0xb9, 0x6c, 0x4b, 0x62, 0xae, 0x4d, 0x8e, 0x17, 0x53, 0xd2, 0x3e, 0x9d, 0x96, 0x94, 0x8c,
+    0xca, 0xcd, 0x7c, 0x41, 0xee, 0x67, 0xe7, 0xe5, 0xf1, 0xd8, 0xaa, 0x3c, 0xcd, 0xf8, 0xe5, 0x25,
+    0x1f, 0x96, 0x37, 0x03, 0xed, 0xf2, 0xfe, 0x5e, 0x97, 0x7c, 0xee, 0x79, 0x24, 0x2b, 0x37, 0x5e,
+    0x88, 0xdb, 0x39, 0x2b, 0x46, 0xd3, 0x02, 0xe5, 0x03, 0x4e, 0x94, 0xea, 0xb5, 0xf5, 0x88, 0xdb,
+    0xaf, 0xd1, 0x99, 0x8d, 0x83, 0xd9, 0xff, 0x04, 0x33, 0xdd, 0x18, 0x1c, 0x82, 0x38, 0xb4, 0x42,
+    0x62, 0x33, 0x11, 0xed, 0x5a, 0xc4, 0x18, 0xc4, 0x21, 0xf1, 0x1b, 0x59, 0x25, 0xe2, 0xfd, 0x33,
+    0x49, 0x3e, 0x32, 0x95, 0xe2, 0x93, 0x93, 0xcc, 0xe7, 0x72, 0x05, 0xee, 0x1c, 0x5f, 0xe2, 0x9e,
+    0x61, 0x3f, 0x0f, 0x0c, 0x9d, 0xe0, 0xcc, 0x60, 0x17, 0x67, 0xfb, 0x47, 0x58, 0xfa, 0x66, 0xb9,
+    0x78, 0xab, 0xc2, 0xe5, 0xab, 0x7b, 0x79, 0xf1, 0xd2, 0x59, 0xae, 0x5c, 0xb8, 0xcb, 0xba, 0x23,
+    0xc7, 0xeb, 0x2b, 0x0a, 0xbe, 0xbc, 0x42, 0x46, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t RGBA_MIXED[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x03, 0x26, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x62, 0x60, 0xf8, 0xcf, 0xf0,
+    0x5f, 0xe0, 0x3b, 0xc3, 0x7f, 0x85, 0xf7, 0x0c, 0xff, 0x0d, 0x9e, 0x33, 0xfc, 0x77, 0xb8, 0xcf,
+    0xf0, 0x3f, 0xe0, 0x3a, 0xc3, 0xff, 0x84, 0xf3, 0x0c, 0xff, 0x0b, 0x8e, 0x33, 0xfc, 0x6f, 0xd8,
+    0xcf, 0xf0, 0x7f, 0xc2, 0x76, 0x86, 0xff, 0x0b, 0xd6, 0x33, 0xfc, 0xdf, 0xb0, 0x9c, 0xe1, 0xff,
+    0x81, 0xf9, 0x0c, 0xff, 0x2f, 0x4c, 0x67, 0xf8, 0xff, 0xa0, 0x9f, 0xe1, 0xff, 0x87, 0x76, 0x86,
+    0xff, 0x8c, 0x8c, 0xbf, 0x19, 0xbe, 0x0b, 0xfc, 0x60, 0x66, 0x20, 0x17, 0x33, 0x31, 0xfe, 0x61,
+    0xf8, 0xc1, 0xf8, 0x87, 0x19, 0x88, 0xd9, 0x80, 0x98, 0x13, 0x88, 0x79, 0x80, 0x98, 0x1f, 0x88,
+    0x85, 0x80, 0x58, 0x14, 0x88, 0x25, 0x80, 0x58, 0x1a, 0x88, 0xe5, 0x80, 0x58, 0x11, 0x88, 0x55,
+    0x80, 0x58, 0x1d, 0x88, 0xb5, 0x80, 0x58, 0xf7, 0x07, 0x33, 0x53, 0x05, 0x43, 0x01, 0xe7, 0x2f,
+    0xb6, 0x3f, 0x9c, 0xbf, 0x38, 0x80, 0x98, 0x13, 0x88, 0xb9, 0x81, 0x98, 0x07, 0x88, 0xf9, 0x80,
+    0x98, 0x1f, 0x88, 0x05, 0x81, 0x58, 0x08, 0x88, 0x45, 0x80, 0x58, 0x14, 0x88, 0xc5, 0x81, 0x58,
+    0x02, 0x88, 0xa5, 0x80, 0x58, 0xfa, 0x0f, 0x0b, 0xd4, 0x05, 0x0c, 0x40, 0x17, 0x00, 0x31, 0x27,
+    0x10, 0xf3, 0x90, 0x84, 0x19, 0x58, 0x5f, 0x33, 0x5c, 0x17, 0x7d, 0xcc, 0x7f, 0x5d, 0xf5, 0xb6,
+    0xdc, 0x75, 0xd3, 0xcb, 0xba, 0xd7, 0x5d, 0x4f, 0xdb, 0x5c, 0x0f, 0x3d, 0xec, 0x7d, 0x3d, 0x75,
+    0x77, 0xd4, 0xf5, 0xd2, 0xcd, 0x99, 0xd7, 0x5b, 0x57, 0x57, 0x5c, 0x9f, 0xba, 0xb8, 0xfd, 0xfa,
+    0xd2, 0xd9, 0xd3, 0xae, 0x6f, 0x9d, 0xbc, 0xf4, 0xfa, 0xd1, 0xee, 0x2d, 0xd7, 0xaf, 0x36, 0x1f,
+    0xbe, 0xfe, 0xb4, 0xfa, 0xd2, 0xf5, 0xaf, 0xc5, 0x0f, 0xaf, 0x33, 0xb2, 0x3d, 0x67, 0x38, 0x2f,
+    0xf0, 0x43, 0x88, 0x81, 0x5c, 0x4c, 0x71, 0x20, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x08,
+    0x02, 0xf7, 0xfd, 0x03, 0x05, 0x6e, 0x00, 0x5c, 0x09, 0xfa, 0x0e, 0xfc, 0x09, 0xfa, 0x0f, 0xfc,
+    0x09, 0xfa, 0x11, 0xfc, 0x09, 0xfa, 0x12, 0xfc, 0x09, 0xfa, 0x14, 0xfc, 0x09, 0xfa, 0x15, 0xfc,
+    0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa, 0x1a, 0xfc, 0x09, 0xfa, 0x1b, 0xfc,
+    0x09, 0xfa, 0x1d, 0xfc, 0x09, 0xfa, 0x9e, 0xfc, 0x09, 0xfa, 0x20, 0xfc, 0x09, 0xfa, 0x21, 0xfc,
+    0x09, 0xfa, 0x23, 0xfc, 0x04, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xfc, 0x06,
+    0x00, 0x01, 0xfc, 0x09, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0f, 0x00, 0x01, 0xfc, 0x12,
+    0x00, 0x01, 0xfc, 0x15, 0x00, 0x01, 0xfc, 0x18, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1b,
+    0x00, 0x01, 0xfc, 0x21, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1b,
+    0x00, 0x01, 0xfc, 0x1b, 0x00, 0x00, 0x0a, 0xd7, 0x00, 0xaf, 0x1a, 0xcf, 0x1e, 0xaf, 0x2a, 0xc7,
+    0x3c, 0xaf, 0x3a, 0xbf, 0x5a, 0xaf, 0x4a, 0xb7, 0x78, 0xaf, 0x5a, 0xaf, 0x96, 0xaf, 0x6a, 0xa7,
+    0xb4, 0xaf, 0x7a, 0x9f, 0xd2, 0xaf, 0x8a, 0x97, 0xf0, 0xaf, 0x9a, 0x8f, 0x0e, 0xaf, 0xaa, 0x87,
+    0x2c, 0xaf, 0xba, 0x7f, 0x4a, 0xaf, 0xca, 0x77, 0x68, 0xaf, 0xda, 0x6f, 0x86, 0xaf, 0xea, 0x67,
+    0xa4, 0xaf, 0xfa, 0x5f, 0xc2, 0xaf, 0x01, 0x0b, 0xd3, 0x00, 0xa7, 0x10, 0xf8, 0x21, 0x00, 0x10,
+    0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10,
+    0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10,
+    0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10,
+    0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x02, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0xf8,
+    0x01, 0xfc, 0x06, 0xf8, 0x01, 0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c, 0xf8, 0x01, 0xfc, 0x0f, 0xf8,
+    0x01, 0xfc, 0x12, 0xf8, 0x01, 0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18, 0xf8, 0x01, 0xfc, 0x1b, 0xf8,
+    0x01, 0xfc, 0x1e, 0xf8, 0x01, 0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24, 0xf8, 0x01, 0xfc, 0x27, 0xf8,
+    0x01, 0xfc, 0x2a, 0xf8, 0x01, 0xfc, 0x2d, 0xf8, 0x03, 0x07, 0x64, 0x00, 0x48, 0x09, 0xfa, 0x15,
+    0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa, 0x1a, 0xfc, 0x09, 0xfa, 0x1b,
+    0xfc, 0x09, 0xfa, 0x1d, 0xfc, 0x09, 0xfa, 0x1e, 0xfc, 0x09, 0xfa, 0x20, 0xfc, 0x09, 0xfa, 0x21,
+    0xfc, 0x09, 0xfa, 0x23, 0xfc, 0x09, 0xfa, 0x24, 0xfc, 0x09, 0xfa, 0x26, 0xfc, 0x09, 0xfa, 0x27,
+    0xfc, 0x09, 0xfa, 0x29, 0xfc, 0x09, 0xfa, 0x2a, 0xfc, 0x04, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc,
+    0x03, 0x00, 0x01, 0xfc, 0x06, 0x00, 0x01, 0xfc, 0x09, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc,
+    0x0f, 0x00, 0x01, 0xfc, 0x12, 0x00, 0x01, 0xfc, 0x15, 0x00, 0x01, 0xfc, 0x18, 0x00, 0x01, 0xfc,
+    0x1b, 0x00, 0x01, 0xfc, 0x1e, 0x00, 0x01, 0xfc, 0x21, 0x00, 0x01, 0xfc, 0x24, 0x00, 0x01, 0xfc,
+    0x27, 0x00, 0x01, 0xfc, 0x2a, 0x00, 0x01, 0xfc, 0x2a, 0x00, 0x00, 0x0f, 0xc3, 0x00, 0x87, 0x1f,
+    0xbb, 0x2d, 0x87, 0x2f, 0xb3, 0x5a, 0x87, 0x3f, 0xab, 0x87, 0x87, 0x4f, 0xa3, 0xb4, 0x87, 0x5f,
+    0x9b, 0xe1, 0x87, 0x6f, 0x93, 0x0e, 0x87, 0x7f, 0x8b, 0x3b, 0x87, 0x8f, 0x83, 0x68, 0x87, 0x9f,
+    0x7b, 0x95, 0x87, 0xaf, 0x73, 0xc2, 0x87, 0xbf, 0x6b, 0xef, 0x87, 0xcf, 0x63, 0x1c, 0x87, 0xdf,
+    0x5b, 0x49, 0x87, 0xef, 0x53, 0x76, 0x87, 0xff, 0x4b, 0xa3, 0x87, 0x2b, 0x0a, 0xbe, 0xbc, 0x0b,
+    0xc8, 0x62, 0x58, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t GREY[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x98, 0xa0,
+    0xbd, 0x00, 0x00, 0x00, 0x6d, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0x10, 0x50, 0x30,
+    0x70, 0x08, 0x48, 0x28, 0x68, 0x98, 0xb0, 0x60, 0xc3, 0x81, 0x0b, 0x0f, 0x3e, 0x30, 0x32, 0x0a,
+    0xa0, 0x02, 0x26, 0x46, 0x34, 0xc0, 0xcc, 0xc4, 0x89, 0x0a, 0x58, 0xd0, 0x55, 0x30, 0xb0, 0x8a,
+    0xaa, 0x9a, 0xba, 0x86, 0xa6, 0x96, 0xb6, 0x4e, 0x5d, 0xba, 0xf5, 0xe8, 0xd5, 0xa7, 0x5f, 0x19,
+    0xd9, 0x08, 0x1a, 0xca, 0x4a, 0xd0, 0x50, 0x2e, 0x29, 0x2d, 0x2b, 0xaf, 0xa8, 0xac, 0xaa, 0xae,
+    0x59, 0xab, 0x76, 0x9d, 0xba, 0xf5, 0xea, 0x17, 0x23, 0x37, 0x41, 0x43, 0xd9, 0x09, 0x1a, 0xca,
+    0x2f, 0xaf, 0x6f, 0xef, 0x1f, 0x9f, 0x5f, 0xdf, 0x3f, 0x7f, 0xfd, 0xfe, 0xf3, 0xf7, 0xdf, 0xff,
+    0x07, 0x00, 0xf3, 0x12, 0x24, 0xe4, 0xc9, 0x78, 0xf4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t GREY_ALPHA[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0xb5, 0xfa, 0x37,
+    0xea, 0x00, 0x00, 0x00, 0xc0, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0xf8, 0x2f, 0xf0,
+    0x5f, 0xe1, 0xbf, 0xc1, 0x7f, 0x87, 0xff, 0x01, 0xff, 0x13, 0xfe, 0x17, 0xfc, 0x6f, 0xf8, 0x3f,
+    0xe1, 0xff, 0x82, 0xff, 0x1b, 0xfe, 0x1f, 0xf8, 0x7f, 0xe1, 0xff, 0x83, 0xff, 0x1f, 0xfe, 0x33,
+    0x32, 0x7e, 0x17, 0x60, 0xc0, 0x07, 0x99, 0x18, 0x7f, 0xe0, 0x87, 0xcc, 0x4c, 0x05, 0x9c, 0x7f,
+    0xf0, 0x41, 0x16, 0xa0, 0x2a, 0x06, 0x7c, 0x90, 0x81, 0xf5, 0xba, 0xe8, 0x75, 0xd5, 0xeb, 0xa6,
+    0xd7, 0x5d, 0xaf, 0x87, 0x5e, 0x4f, 0xbd, 0x5e, 0x7a, 0xbd, 0xf5, 0xfa, 0xd4, 0xeb, 0x4b, 0xaf,
+    0x6f, 0xbd, 0x7e, 0xf4, 0xfa, 0xd5, 0xeb, 0x4f, 0xaf, 0x7f, 0xbd, 0xce, 0xc8, 0x76, 0x9e, 0x52,
+    0x47, 0xb2, 0xc6, 0x50, 0xea, 0x48, 0xae, 0xf5, 0x52, 0xeb, 0xb5, 0xd6, 0x5b, 0xad, 0xf7, 0x5a,
+    0x1f, 0xb5, 0x3e, 0x6b, 0x7d, 0xd5, 0xfa, 0xae, 0xf5, 0xb3, 0xd6, 0xaf, 0x5a, 0xbf, 0x6b, 0xfd,
+    0xa9, 0xf5, 0xb7, 0xd6, 0xbf, 0x5a, 0xff, 0x6b, 0x3d, 0x23, 0xf7, 0x72, 0x4a, 0x1d, 0xc9, 0xee,
+    0x41, 0xa9, 0x23, 0xf9, 0xdb, 0xe5, 0xdb, 0xf5, 0xdb, 0xed, 0xdb, 0xfd, 0xdb, 0xe3, 0xdb, 0xf3,
+    0xdb, 0xeb, 0xdb, 0xfb, 0xdb, 0xe7, 0xb7, 0xaf, 0x6f, 0xdf, 0xdf, 0x7e, 0xbe, 0xfd, 0x7e, 0xfb,
+    0xfb, 0xf6, 0xff, 0xed, 0x00, 0xa5, 0xa1, 0xb6, 0xd9, 0x21, 0x9c, 0xbb, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t RGB[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x02, 0x00, 0x00, 0x00, 0x90, 0x91, 0x68,
+    0x36, 0x00, 0x00, 0x01, 0x8c, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x95, 0xcf, 0x4d, 0x28, 0xc3,
+    0x71, 0x18, 0xc0, 0xf1, 0xe7, 0xb1, 0x19, 0x8f, 0x69, 0x63, 0x59, 0x96, 0x31, 0x96, 0xb7, 0xfc,
+    0xb3, 0xb8, 0xb8, 0xa0, 0xb8, 0x38, 0xe0, 0x40, 0xc9, 0x65, 0x0e, 0x14, 0xf2, 0x56, 0x28, 0x61,
+    0x71, 0x98, 0x5a, 0xac, 0x38, 0x4c, 0x69, 0x14, 0x65, 0x6a, 0xa4, 0xec, 0x30, 0xb5, 0x49, 0x71,
+    0x98, 0x2c, 0x29, 0x0e, 0x13, 0x49, 0x71, 0x40, 0x92, 0xe2, 0x30, 0x17, 0xd1, 0xe3, 0x57, 0x23,
+    0x07, 0x17, 0x62, 0xab, 0xef, 0xfd, 0xdb, 0x07, 0x20, 0x02, 0x29, 0xaf, 0x90, 0x13, 0x86, 0xd2,
+    0x07, 0xa8, 0xbe, 0x86, 0xc6, 0x0b, 0x68, 0x0b, 0xc1, 0xe0, 0x21, 0x4c, 0x04, 0x60, 0x76, 0x1b,
+    0x56, 0xbc, 0xb0, 0xb9, 0x0e, 0x7b, 0x2e, 0x38, 0x59, 0x80, 0x1b, 0x07, 0x3c, 0xdb, 0x01, 0xf1,
+    0x1d, 0x52, 0xde, 0x64, 0xd1, 0x17, 0x87, 0x02, 0x50, 0xc8, 0x50, 0x28, 0x50, 0x10, 0x8a, 0x64,
+    0x14, 0x6a, 0x14, 0x1a, 0x14, 0x5a, 0x14, 0x3a, 0x14, 0x7a, 0x14, 0x06, 0x14, 0x46, 0x14, 0x79,
+    0x28, 0x0a, 0x51, 0x48, 0x28, 0x4c, 0xb2, 0x38, 0x0b, 0x10, 0x2b, 0x88, 0x13, 0x89, 0x89, 0x58,
+    0x49, 0x9c, 0x4c, 0xac, 0x22, 0x56, 0x13, 0xa7, 0x12, 0x6b, 0x88, 0xd3, 0x88, 0xb5, 0xc4, 0xe9,
+    0xc4, 0x3a, 0xe2, 0x0c, 0x62, 0xbd, 0xfc, 0xc7, 0xe1, 0x9f, 0x20, 0xfe, 0x09, 0xb4, 0x77, 0xea,
+    0xfc, 0x2b, 0x43, 0xd9, 0x99, 0xa9, 0xe6, 0xb8, 0xb2, 0x39, 0x58, 0xdf, 0xb9, 0x6b, 0x1e, 0xf6,
+    0xf5, 0x4c, 0x7a, 0x2c, 0x4e, 0xb7, 0x7d, 0x6d, 0x69, 0x7e, 0x6b, 0x6e, 0xed, 0x60, 0xc6, 0x7f,
+    0x6e, 0x0b, 0xde, 0x8f, 0x9f, 0xbe, 0x0c, 0xdd, 0xa2, 0xe2, 0xe1, 0x13, 0xad, 0x89, 0xbe, 0xd8,
+    0xd1, 0xf1, 0xfd, 0xf0, 0xb7, 0x92, 0x38, 0x8b, 0x78, 0x99, 0x38, 0x87, 0xd8, 0x48, 0x9c, 0x2b,
+    0xff, 0xef, 0xa0, 0xff, 0x3a, 0xe8, 0xbf, 0x83, 0xa4, 0x0b, 0xc8, 0x08, 0x19, 0xa4, 0xc3, 0xca,
+    0xf2, 0x80, 0xb9, 0x6e, 0xdb, 0x62, 0xf6, 0xce, 0xf7, 0xae, 0xfb, 0xc7, 0x5c, 0xa7, 0xd3, 0x0b,
+    0xcf, 0x8b, 0x0e, 0xd5, 0x86, 0xbd, 0x78, 0xc7, 0x5a, 0x77, 0x34, 0xda, 0x7d, 0x39, 0x30, 0xf5,
+    0xd8, 0xb5, 0xca, 0xad, 0xfb, 0xa8, 0x3c, 0xfb, 0x44, 0x1b, 0xa3, 0x2f, 0x76, 0x74, 0x42, 0x07,
+    0xfc, 0xa6, 0x34, 0x7c, 0x2b, 0x89, 0xf3, 0x88, 0x0b, 0x88, 0x0b, 0x89, 0x8b, 0x88, 0x25, 0x79,
+    0x8c, 0x07, 0x09, 0xd4, 0x41, 0xc8, 0xde, 0x35, 0x95, 0xf8, 0xcc, 0x55, 0x1e, 0x7b, 0x83, 0xdb,
+    0xdf, 0xba, 0x74, 0x3b, 0x30, 0xa7, 0xb2, 0xce, 0x54, 0x38, 0x6c, 0xdd, 0xae, 0x71, 0xa7, 0x77,
+    0x68, 0x3f, 0xd0, 0x17, 0x0e, 0xb5, 0x67, 0x5e, 0xb7, 0xd4, 0x86, 0x9b, 0x46, 0x22, 0xf5, 0xee,
+    0x0f, 0xda, 0x4c, 0x2c, 0xc7, 0xc2, 0xdf, 0x35, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
+    0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t PALETTE[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x03, 0x00, 0x00, 0x00, 0x28, 0x2d, 0x0f,
+    0x53, 0x00, 0x00, 0x00, 0x30, 0x50, 0x4c, 0x54, 0x45, 0x00, 0xff, 0x00, 0x10, 0xef, 0x05, 0x20,
+    0xdf, 0x0a, 0x30, 0xcf, 0x0f, 0x40, 0xbf, 0x14, 0x50, 0xaf, 0x19, 0x60, 0x9f, 0x1e, 0x70, 0x8f,
+    0x23, 0x80, 0x7f, 0x28, 0x90, 0x6f, 0x2d, 0xa0, 0x5f, 0x32, 0xb0, 0x4f, 0x37, 0xc0, 0x3f, 0x3c,
+    0xd0, 0x2f, 0x41, 0xe0, 0x1f, 0x46, 0xf0, 0x0f, 0x4b, 0xb2, 0x3b, 0x0f, 0x2e, 0x00, 0x00, 0x00,
+    0x10, 0x74, 0x52, 0x4e, 0x53, 0xff, 0xf5, 0xeb, 0xe1, 0xd7, 0xcd, 0xc3, 0xb9, 0xaf, 0xa5, 0x9b,
+    0x91, 0x87, 0x7d, 0x73, 0x69, 0x8f, 0x29, 0xf6, 0x8b, 0x00, 0x00, 0x00, 0x52, 0x49, 0x44, 0x41,
+    0x54, 0x78, 0xda, 0x5d, 0xcf, 0x5b, 0x0a, 0x80, 0x30, 0x0c, 0x05, 0xd1, 0x4c, 0xd2, 0x87, 0x5a,
+    0xb5, 0xfb, 0x5f, 0xa6, 0x3b, 0x10, 0x8b, 0x4a, 0x93, 0xfc, 0x1d, 0x2e, 0x0c, 0x44, 0x04, 0xb5,
+    0x94, 0x4b, 0x5d, 0xd6, 0xad, 0xed, 0xc7, 0xd9, 0x09, 0x77, 0x69, 0x30, 0xa6, 0xde, 0xa4, 0x60,
+    0x64, 0xea, 0x8d, 0x3e, 0xc5, 0xed, 0xa0, 0xc1, 0x58, 0xf6, 0xfe, 0xa3, 0x9f, 0x91, 0xa9, 0x37,
+    0xfa, 0x34, 0xb7, 0xbf, 0xd1, 0xc9, 0x58, 0xf5, 0x7e, 0xa2, 0xce, 0x48, 0x0f, 0xff, 0xdf, 0x6e,
+    0xa2, 0x0e, 0x19, 0x6c, 0xc2, 0xb3, 0x25, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82,
+};
+
+static const uint8_t BAD_ADLER[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x01, 0xd5, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xa5, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0x72, 0xf5, 0xe6, 0xd8, 0xbb, 0x46, 0xa3, 0xe1, 0xea, 0xcd,
+    0xd1, 0x6a, 0x38, 0x1a, 0x75, 0xe9, 0x52, 0x42, 0x5d, 0x82, 0xd2, 0x43, 0x41, 0x74, 0x59, 0x81,
+    0x41, 0x45, 0x5a, 0x90, 0x82, 0x54, 0x23, 0x0f, 0x06, 0x52, 0x3f, 0xc8, 0xc3, 0x02, 0x51, 0x21,
+    0xa1, 0x05, 0x4b, 0x06, 0x79, 0xf8, 0x05, 0x2e, 0x84, 0x3c, 0x2c, 0x1c, 0x21, 0xd4, 0x61, 0xa1,
+    0xc4, 0x1f, 0xea, 0x60, 0x12, 0x21, 0xd8, 0x61, 0x5e, 0xc2, 0x97, 0xb7, 0xc1, 0xdf, 0x87, 0xda,
+    0xa1, 0x0e, 0x42, 0xce, 0xc3, 0x07, 0x9e, 0xe3, 0xc3, 0x97, 0x48, 0x93, 0x0e, 0xac, 0x91, 0x6e,
+    0xa9, 0x90, 0x3e, 0xba, 0x4c, 0xfa, 0xd4, 0x22, 0xe9, 0xf3, 0x8a, 0xf4, 0x95, 0x32, 0xe9, 0xde,
+    0x39, 0xd2, 0x0f, 0x8a, 0xa4, 0x9f, 0x4c, 0x93, 0x7e, 0x2e, 0xa4, 0x5f, 0xe5, 0x49, 0xbf, 0xcd,
+    0x92, 0xfe, 0x38, 0x46, 0xfa, 0x6b, 0x86, 0xf4, 0x2a, 0x93, 0x36, 0x8c, 0x5f, 0xb4, 0x16, 0x70,
+    0x3c, 0x54, 0xaf, 0x06, 0xa3, 0x4a, 0x8e, 0x51, 0xf5, 0x80, 0x17, 0x4c, 0xf0, 0x81, 0x05, 0x41,
+    0x08, 0x41, 0x18, 0x22, 0x60, 0x43, 0x14, 0x62, 0x10, 0x87, 0x04, 0x24, 0x1d, 0x4f, 0x43, 0x9a,
+    0x7a, 0x4d, 0xd7, 0x5b, 0x35, 0xdd, 0x1d, 0x60, 0x42, 0x13, 0xf8, 0xc0, 0x0f, 0x16, 0xec, 0x82,
+    0x20, 0xec, 0x86, 0x10, 0xec, 0x81, 0x30, 0x34, 0x43, 0xa4, 0xba, 0xad, 0xf6, 0x80, 0xf0, 0x00,
+    0x4c, 0xf0, 0x6d, 0x0a, 0x35, 0xfe, 0x20, 0x15, 0xfa, 0x66, 0xa9, 0x83, 0x5f, 0x6c, 0x75, 0x6c,
+    0x21, 0xa9, 0x4e, 0x7f, 0x68, 0x53, 0x17, 0x4b, 0x1d, 0xea, 0xfa, 0x4c, 0x4a, 0xdd, 0x99, 0xea,
+    0x56, 0x0f, 0x27, 0xd3, 0x6a, 0x24, 0xc7, 0x6a, 0x62, 0x7c, 0x54, 0xbd, 0x1e, 0x9e, 0x50, 0xef,
+    0x86, 0x0a, 0xea, 0xd3, 0x60, 0x49, 0x7d, 0xef, 0x9f, 0x57, 0x3f, 0xfb, 0x96, 0x94, 0xe1, 0x5d,
+    0xa6, 0x72, 0xc0, 0x09, 0x52, 0xbd, 0xb6, 0x1e, 0xb1, 0xf1, 0x36, 0x5d, 0xfe, 0xdf, 0x60, 0xa6,
+    0xbb, 0x0f, 0x9e, 0x41, 0x0b, 0x44, 0xe1, 0xc0, 0x46, 0x11, 0x2d, 0x08, 0x42, 0x08, 0xc2, 0x10,
+    0xa9, 0x89, 0xfe, 0xb5, 0xff, 0xa0, 0x9d, 0x8a, 0xa4, 0xb9, 0x6c, 0x4b, 0x62, 0xae, 0x4d, 0x8e,
+    0x17, 0x53, 0xd2, 0x3e, 0x9d, 0x96, 0x94, 0x8c, 0xca, 0xcd, 0x7c, 0x41, 0xee, 0x67, 0xe7, 0xe5,
+    0xf1, 0xd8, 0xaa, 0x3c, 0xcd, 0xf8, 0xe5, 0x25, 0x1f, 0x96, 0x37, 0x03, 0xed, 0xf2, 0xfe, 0x5e,
+    0x97, 0x7c, 0xee, 0x79, 0x24, 0x2b, 0x37, 0x5e, 0x88, 0xdb, 0x39, 0x2b, 0x46, 0xd3, 0x02, 0xe5,
+    0x03, 0x4e, 0x94, 0xea, 0xb5, 0xf5, 0x88, 0xdb, 0xaf, 0xd1, 0x99, 0x8d, 0x83, 0xd9, 0xff, 0x04,
+    0x33, 0xdd, 0x18, 0x1c, 0x82, 0x38, 0xb4, 0x42, 0x62, 0x33, 0x11, 0xed, 0x5a, 0xc4, 0x18, 0xc4,
+    0x21, 0xf1, 0x1b, 0x59, 0x25, 0xe2, 0xfd, 0x33, 0x49, 0x3e, 0x32, 0x95, 0xe2, 0x93, 0x93, 0xcc,
+    0xe7, 0x72, 0x05, 0xee, 0x1c, 0x5f, 0xe2, 0x9e, 0x61, 0x3f, 0x0f, 0x0c, 0x9d, 0xe0, 0xcc, 0x60,
+    0x17, 0x67, 0xfb, 0x47, 0x58, 0xfa, 0x66, 0xb9, 0x78, 0xab, 0xc2, 0xe5, 0xab, 0x7b, 0x79, 0xf1,
+    0xd2, 0x59, 0xae, 0x5c, 0xb8, 0xcb, 0xba, 0x23, 0xc7, 0xeb, 0x2b, 0x0a, 0xbe, 0xbd, 0xf6, 0x89,
+    0xa4, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t BAD_BLOCK_TYPE[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x01, 0xd5, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x07, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0x72, 0xf5, 0xe6, 0xd8, 0xbb, 0x46, 0xa3, 0xe1, 0xea, 0xcd,
+    0xd1, 0x6a, 0x38, 0x1a, 0x75, 0xe9, 0x52, 0x42, 0x5d, 0x82, 0xd2, 0x43, 0x41, 0x74, 0x59, 0x81,
+    0x41, 0x45, 0x5a, 0x90, 0x82, 0x54, 0x23, 0x0f, 0x06, 0x52, 0x3f, 0xc8, 0xc3, 0x02, 0x51, 0x21,
+    0xa1, 0x05, 0x4b, 0x06, 0x79, 0xf8, 0x05, 0x2e, 0x84, 0x3c, 0x2c, 0x1c, 0x21, 0xd4, 0x61, 0xa1,
+    0xc4, 0x1f, 0xea, 0x60, 0x12, 0x21, 0xd8, 0x61, 0x5e, 0xc2, 0x97, 0xb7, 0xc1, 0xdf, 0x87, 0xda,
+    0xa1, 0x0e, 0x42, 0xce, 0xc3, 0x07, 0x9e, 0xe3, 0xc3, 0x97, 0x48, 0x93, 0x0e, 0xac, 0x91, 0x6e,
+    0xa9, 0x90, 0x3e, 0xba, 0x4c, 0xfa, 0xd4, 0x22, 0xe9, 0xf3, 0x8a, 0xf4, 0x95, 0x32, 0xe9, 0xde,
+    0x39, 0xd2, 0x0f, 0x8a, 0xa4, 0x9f, 0x4c, 0x93, 0x7e, 0x2e, 0xa4, 0x5f, 0xe5, 0x49, 0xbf, 0xcd,
+    0x92, 0xfe, 0x38, 0x46, 0xfa, 0x6b, 0x86, 0xf4, 0x2a, 0x93, 0x36, 0x8c, 0x5f, 0xb4, 0x16, 0x70,
+    0x3c, 0x54, 0xaf, 0x06, 0xa3, 0x4a, 0x8e, 0x51, 0xf5, 0x80, 0x17, 0x4c, 0xf0, 0x81, 0x05, 0x41,
+    0x08, 0x41, 0x18, 0x22, 0x60, 0x43, 0x14, 0x62, 0x10, 0x87, 0x04, 0x24, 0x1d, 0x4f, 0x43, 0x9a,
+    0x7a, 0x4d, 0xd7, 0x5b, 0x35, 0xdd, 0x1d, 0x60, 0x42, 0x13, 0xf8, 0xc0, 0x0f, 0x16, 0xec, 0x82,
+    0x20, 0xec, 0x86, 0x10, 0xec, 0x81, 0x30, 0x34, 0x43, 0xa4, 0xba, 0xad, 0xf6, 0x80, 0xf0, 0x00,
+    0x4c, 0xf0, 0x6d, 0x0a, 0x35, 0xfe, 0x20, 0x15, 0xfa, 0x66, 0xa9, 0x83, 0x5f, 0x6c, 0x75, 0x6c,
+    0x21, 0xa9, 0x4e, 0x7f, 0x68, 0x53, 0x17, 0x4b, 0x1d, 0xea, 0xfa, 0x4c, 0x4a, 0xdd, 0x99, 0xea,
+    0x56, 0x0f, 0x27, 0xd3, 0x6a, 0x24, 0xc7, 0x6a, 0x62, 0x7c, 0x54, 0xbd, 0x1e, 0x9e, 0x50, 0xef,
+    0x86, 0x0a, 0xea, 0xd3, 0x60, 0x49, 0x7d, 0xef, 0x9f, 0x57, 0x3f, 0xfb, 0x96, 0x94, 0xe1, 0x5d,
+    0xa6, 0x72, 0xc0, 0x09, 0x52, 0xbd, 0xb6, 0x1e, 0xb1, 0xf1, 0x36, 0x5d, 0xfe, 0xdf, 0x60, 0xa6,
+    0xbb, 0x0f, 0x9e, 0x41, 0x0b, 0x44, 0xe1, 0xc0, 0x46, 0x11, 0x2d, 0x08, 0x42, 0x08, 0xc2, 0x10,
+    0xa9, 0x89, 0xfe, 0xb5, 0xff, 0xa0, 0x9d, 0x8a, 0xa4, 0xb9, 0x6c, 0x4b, 0x62, 0xae, 0x4d, 0x8e,
+    0x17, 0x53, 0xd2, 0x3e, 0x9d, 0x96, 0x94, 0x8c, 0xca, 0xcd, 0x7c, 0x41, 0xee, 0x67, 0xe7, 0xe5,
+    0xf1, 0xd8, 0xaa, 0x3c, 0xcd, 0xf8, 0xe5, 0x25, 0x1f, 0x96, 0x37, 0x03, 0xed, 0xf2, 0xfe, 0x5e,
+    0x97, 0x7c, 0xee, 0x79, 0x24, 0x2b, 0x37, 0x5e, 0x88, 0xdb, 0x39, 0x2b, 0x46, 0xd3, 0x02, 0xe5,
+    0x03, 0x4e, 0x94, 0xea, 0xb5, 0xf5, 0x88, 0xdb, 0xaf, 0xd1, 0x99, 0x8d, 0x83, 0xd9, 0xff, 0x04,
+    0x33, 0xdd, 0x18, 0x1c, 0x82, 0x38, 0xb4, 0x42, 0x62, 0x33, 0x11, 0xed, 0x5a, 0xc4, 0x18, 0xc4,
+    0x21, 0xf1, 0x1b, 0x59, 0x25, 0xe2, 0xfd, 0x33, 0x49, 0x3e, 0x32, 0x95, 0xe2, 0x93, 0x93, 0xcc,
+    0xe7, 0x72, 0x05, 0xee, 0x1c, 0x5f, 0xe2, 0x9e, 0x61, 0x3f, 0x0f, 0x0c, 0x9d, 0xe0, 0xcc, 0x60,
+    0x17, 0x67, 0xfb, 0x47, 0x58, 0xfa, 0x66, 0xb9, 0x78, 0xab, 0xc2, 0xe5, 0xab, 0x7b, 0x79, 0xf1,
+    0xd2, 0x59, 0xae, 0x5c, 0xb8, 0xcb, 0xba, 0x23, 0xc7, 0xeb, 0x2b, 0x0a, 0xbe, 0xbc, 0xf4, 0xd2,
+    0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t BAD_STORED_LENGTH[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x04, 0x1b, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x10, 0x04, 0x10, 0xfb,
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xf7, 0x00, 0xff, 0x20, 0xef, 0x00, 0xff, 0x30, 0xe7, 0x00,
+    0xff, 0x40, 0xdf, 0x00, 0xff, 0x50, 0xd7, 0x00, 0xff, 0x60, 0xcf, 0x00, 0xff, 0x70, 0xc7, 0x00,
+    0xff, 0x80, 0xbf, 0x00, 0xff, 0x90, 0xb7, 0x00, 0xff, 0xa0, 0xaf, 0x00, 0xff, 0xb0, 0xa7, 0x00,
+    0xff, 0xc0, 0x9f, 0x00, 0xff, 0xd0, 0x97, 0x00, 0xff, 0xe0, 0x8f, 0x00, 0xff, 0xf0, 0x87, 0x00,
+    0xff, 0x01, 0x01, 0xfb, 0x00, 0xf7, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8, 0x03, 0x00, 0x10, 0xf8,
+    0x03, 0x00, 0x02, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0xf8, 0x01, 0xfc, 0x06, 0xf8, 0x01,
+    0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c, 0xf8, 0x01, 0xfc, 0x0f, 0xf8, 0x01, 0xfc, 0x12, 0xf8, 0x01,
+    0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18, 0xf8, 0x01, 0xfc, 0x1b, 0xf8, 0x01, 0xfc, 0x1e, 0xf8, 0x01,
+    0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24, 0xf8, 0x01, 0xfc, 0x27, 0xf8, 0x01, 0xfc, 0x2a, 0xf8, 0x01,
+    0xfc, 0x2d, 0xf8, 0x03, 0x02, 0x78, 0x00, 0x70, 0x09, 0xfa, 0x06, 0xfc, 0x09, 0xfa, 0x08, 0xfc,
+    0x09, 0xfa, 0x09, 0xfc, 0x09, 0xfa, 0x0b, 0xfc, 0x09, 0xfa, 0x0c, 0xfc, 0x09, 0xfa, 0x0e, 0xfc,
+    0x09, 0xfa, 0x0f, 0xfc, 0x09, 0xfa, 0x11, 0xfc, 0x09, 0xfa, 0x12, 0xfc, 0x09, 0xfa, 0x14, 0xfc,
+    0x09, 0xfa, 0x15, 0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa, 0x1a, 0xfc,
+    0x09, 0xfa, 0x1b, 0xfc, 0x04, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xfc, 0x06,
+    0x00, 0x01, 0xfc, 0x09, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c,
+    0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c,
+    0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0c,
+    0x00, 0x01, 0xfc, 0x0c, 0x00, 0x00, 0x05, 0xeb, 0x00, 0xd7, 0x15, 0xe3, 0x0f, 0xd7, 0x25, 0xdb,
+    0x1e, 0xd7, 0x35, 0xd3, 0x2d, 0xd7, 0x45, 0xcb, 0x3c, 0xd7, 0x55, 0xc3, 0x4b, 0xd7, 0x65, 0xbb,
+    0x5a, 0xd7, 0x75, 0xb3, 0x69, 0xd7, 0x85, 0xab, 0x78, 0xd7, 0x95, 0xa3, 0x87, 0xd7, 0xa5, 0x9b,
+    0x96, 0xd7, 0xb5, 0x93, 0xa5, 0xd7, 0xc5, 0x8b, 0xb4, 0xd7, 0xd5, 0x83, 0xc3, 0xd7, 0xe5, 0x7b,
+    0xd2, 0xd7, 0xf5, 0x73, 0xe1, 0xd7, 0x01, 0x06, 0xe7, 0x00, 0xcf, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x10,
+    0xf8, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x02, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0xf8,
+    0x01, 0xfc, 0x06, 0xf8, 0x01, 0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c, 0xf8, 0x01, 0xfc, 0x0f, 0xf8,
+    0x01, 0xfc, 0x12, 0xf8, 0x01, 0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18, 0xf8, 0x01, 0xfc, 0x1b, 0xf8,
+    0x01, 0xfc, 0x1e, 0xf8, 0x01, 0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24, 0xf8, 0x01, 0xfc, 0x27, 0xf8,
+    0x01, 0xfc, 0x2a, 0xf8, 0x01, 0xfc, 0x2d, 0xf8, 0x03, 0x05, 0x6e, 0x00, 0x5c, 0x09, 0xfa, 0x0e,
+    0xfc, 0x09, 0xfa, 0x0f, 0xfc, 0x09, 0xfa, 0x11, 0xfc, 0x09, 0xfa, 0x12, 0xfc, 0x09, 0xfa, 0x14,
+    0xfc, 0x09, 0xfa, 0x15, 0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa, 0x1a,
+    0xfc, 0x09, 0xfa, 0x1b, 0xfc, 0x09, 0xfa, 0x1d, 0xfc, 0x09, 0xfa, 0x9e, 0xfc, 0x09, 0xfa, 0x20,
+    0xfc, 0x09, 0xfa, 0x21, 0xfc, 0x09, 0xfa, 0x23, 0xfc, 0x04, 0x01, 0xfc, 0x00, 0xf8, 0x01, 0xfc,
+    0x03, 0x00, 0x01, 0xfc, 0x06, 0x00, 0x01, 0xfc, 0x09, 0x00, 0x01, 0xfc, 0x0c, 0x00, 0x01, 0xfc,
+    0x0f, 0x00, 0x01, 0xfc, 0x12, 0x00, 0x01, 0xfc, 0x15, 0x00, 0x01, 0xfc, 0x18, 0x00, 0x01, 0xfc,
+    0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x21, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc,
+    0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x00, 0x0a, 0xd7, 0x00, 0xaf, 0x1a,
+    0xcf, 0x1e, 0xaf, 0x2a, 0xc7, 0x3c, 0xaf, 0x3a, 0xbf, 0x5a, 0xaf, 0x4a, 0xb7, 0x78, 0xaf, 0x5a,
+    0xaf, 0x96, 0xaf, 0x6a, 0xa7, 0xb4, 0xaf, 0x7a, 0x9f, 0xd2, 0xaf, 0x8a, 0x97, 0xf0, 0xaf, 0x9a,
+    0x8f, 0x0e, 0xaf, 0xaa, 0x87, 0x2c, 0xaf, 0xba, 0x7f, 0x4a, 0xaf, 0xca, 0x77, 0x68, 0xaf, 0xda,
+    0x6f, 0x86, 0xaf, 0xea, 0x67, 0xa4, 0xaf, 0xfa, 0x5f, 0xc2, 0xaf, 0x01, 0x0b, 0xd3, 0x00, 0xa7,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00,
+    0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x10, 0xf8, 0x21, 0x00, 0x02, 0x01, 0xfc, 0x00,
+    0xf8, 0x01, 0xfc, 0x03, 0xf8, 0x01, 0xfc, 0x06, 0xf8, 0x01, 0xfc, 0x09, 0xf8, 0x01, 0xfc, 0x0c,
+    0xf8, 0x01, 0xfc, 0x0f, 0xf8, 0x01, 0xfc, 0x12, 0xf8, 0x01, 0xfc, 0x15, 0xf8, 0x01, 0xfc, 0x18,
+    0xf8, 0x01, 0xfc, 0x1b, 0xf8, 0x01, 0xfc, 0x1e, 0xf8, 0x01, 0xfc, 0x21, 0xf8, 0x01, 0xfc, 0x24,
+    0xf8, 0x01, 0xfc, 0x27, 0xf8, 0x01, 0xfc, 0x2a, 0xf8, 0x01, 0xfc, 0x2d, 0xf8, 0x03, 0x07, 0x64,
+    0x00, 0x48, 0x09, 0xfa, 0x15, 0xfc, 0x09, 0xfa, 0x17, 0xfc, 0x09, 0xfa, 0x18, 0xfc, 0x09, 0xfa,
+    0x1a, 0xfc, 0x09, 0xfa, 0x1b, 0xfc, 0x09, 0xfa, 0x1d, 0xfc, 0x09, 0xfa, 0x1e, 0xfc, 0x09, 0xfa,
+    0x20, 0xfc, 0x09, 0xfa, 0x21, 0xfc, 0x09, 0xfa, 0x23, 0xfc, 0x09, 0xfa, 0x24, 0xfc, 0x09, 0xfa,
+    0x26, 0xfc, 0x09, 0xfa, 0x27, 0xfc, 0x09, 0xfa, 0x29, 0xfc, 0x09, 0xfa, 0x2a, 0xfc, 0x04, 0x01,
+    0xfc, 0x00, 0xf8, 0x01, 0xfc, 0x03, 0x00, 0x01, 0xfc, 0x06, 0x00, 0x01, 0xfc, 0x09, 0x00, 0x01,
+    0xfc, 0x0c, 0x00, 0x01, 0xfc, 0x0f, 0x00, 0x01, 0xfc, 0x12, 0x00, 0x01, 0xfc, 0x15, 0x00, 0x01,
+    0xfc, 0x18, 0x00, 0x01, 0xfc, 0x1b, 0x00, 0x01, 0xfc, 0x1e, 0x00, 0x01, 0xfc, 0x21, 0x00, 0x01,
+    0xfc, 0x24, 0x00, 0x01, 0xfc, 0x27, 0x00, 0x01, 0xfc, 0x2a, 0x00, 0x01, 0xfc, 0x2a, 0x00, 0x00,
+    0x0f, 0xc3, 0x00, 0x87, 0x1f, 0xbb, 0x2d, 0x87, 0x2f, 0xb3, 0x5a, 0x87, 0x3f, 0xab, 0x87, 0x87,
+    0x4f, 0xa3, 0xb4, 0x87, 0x5f, 0x9b, 0xe1, 0x87, 0x6f, 0x93, 0x0e, 0x87, 0x7f, 0x8b, 0x3b, 0x87,
+    0x8f, 0x83, 0x68, 0x87, 0x9f, 0x7b, 0x95, 0x87, 0xaf, 0x73, 0xc2, 0x87, 0xbf, 0x6b, 0xef, 0x87,
+    0xcf, 0x63, 0x1c, 0x87, 0xdf, 0x5b, 0x49, 0x87, 0xef, 0x53, 0x76, 0x87, 0xff, 0x4b, 0xa3, 0x87,
+    0x2b, 0x0a, 0xbe, 0xbc, 0x92, 0x79, 0xeb, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t TRUNCATED_DEFLATE[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x00, 0xea, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xa5, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0x72, 0xf5, 0xe6, 0xd8, 0xbb, 0x46, 0xa3, 0xe1, 0xea, 0xcd,
+    0xd1, 0x6a, 0x38, 0x1a, 0x75, 0xe9, 0x52, 0x42, 0x5d, 0x82, 0xd2, 0x43, 0x41, 0x74, 0x59, 0x81,
+    0x41, 0x45, 0x5a, 0x90, 0x82, 0x54, 0x23, 0x0f, 0x06, 0x52, 0x3f, 0xc8, 0xc3, 0x02, 0x51, 0x21,
+    0xa1, 0x05, 0x4b, 0x06, 0x79, 0xf8, 0x05, 0x2e, 0x84, 0x3c, 0x2c, 0x1c, 0x21, 0xd4, 0x61, 0xa1,
+    0xc4, 0x1f, 0xea, 0x60, 0x12, 0x21, 0xd8, 0x61, 0x5e, 0xc2, 0x97, 0xb7, 0xc1, 0xdf, 0x87, 0xda,
+    0xa1, 0x0e, 0x42, 0xce, 0xc3, 0x07, 0x9e, 0xe3, 0xc3, 0x97, 0x48, 0x93, 0x0e, 0xac, 0x91, 0x6e,
+    0xa9, 0x90, 0x3e, 0xba, 0x4c, 0xfa, 0xd4, 0x22, 0xe9, 0xf3, 0x8a, 0xf4, 0x95, 0x32, 0xe9, 0xde,
+    0x39, 0xd2, 0x0f, 0x8a, 0xa4, 0x9f, 0x4c, 0x93, 0x7e, 0x2e, 0xa4, 0x5f, 0xe5, 0x49, 0xbf, 0xcd,
+    0x92, 0xfe, 0x38, 0x46, 0xfa, 0x6b, 0x86, 0xf4, 0x2a, 0x93, 0x36, 0x8c, 0x5f, 0xb4, 0x16, 0x70,
+    0x3c, 0x54, 0xaf, 0x06, 0xa3, 0x4a, 0x8e, 0x51, 0xf5, 0x80, 0x17, 0x4c, 0xf0, 0x81, 0x05, 0x41,
+    0x08, 0x41, 0x18, 0x22, 0x60, 0x43, 0x14, 0x62, 0x10, 0x87, 0x04, 0x24, 0x1d, 0x4f, 0x43, 0x9a,
+    0x7a, 0x4d, 0xd7, 0x5b, 0x35, 0xdd, 0x1d, 0x60, 0x42, 0x13, 0xf8, 0xc0, 0x0f, 0x16, 0xec, 0x82,
+    0x20, 0xec, 0x86, 0x10, 0xec, 0x81, 0x30, 0x34, 0x43, 0xa4, 0xba, 0xad, 0xf6, 0x80, 0xf0, 0x00,
+    0x4c, 0xf0, 0x6d, 0x0a, 0x35, 0xfe, 0x20, 0x15, 0xfa, 0x66, 0xa9, 0x83, 0x5f, 0x6c, 0x75, 0x6c,
+    0x21, 0xa9, 0x4e, 0x51, 0xf3, 0xf9, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82,
+};
+
+static const uint8_t BAD_ZLIB_HEADER[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x01, 0xd5, 0x49, 0x44, 0x41, 0x54, 0x79, 0xda, 0xa5, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0x72, 0xf5, 0xe6, 0xd8, 0xbb, 0x46, 0xa3, 0xe1, 0xea, 0xcd,
+    0xd1, 0x6a, 0x38, 0x1a, 0x75, 0xe9, 0x52, 0x42, 0x5d, 0x82, 0xd2, 0x43, 0x41, 0x74, 0x59, 0x81,
+    0x41, 0x45, 0x5a, 0x90, 0x82, 0x54, 0x23, 0x0f, 0x06, 0x52, 0x3f, 0xc8, 0xc3, 0x02, 0x51, 0x21,
+    0xa1, 0x05, 0x4b, 0x06, 0x79, 0xf8, 0x05, 0x2e, 0x84, 0x3c, 0x2c, 0x1c, 0x21, 0xd4, 0x61, 0xa1,
+    0xc4, 0x1f, 0xea, 0x60, 0x12, 0x21, 0xd8, 0x61, 0x5e, 0xc2, 0x97, 0xb7, 0xc1, 0xdf, 0x87, 0xda,
+    0xa1, 0x0e, 0x42, 0xce, 0xc3, 0x07, 0x9e, 0xe3, 0xc3, 0x97, 0x48, 0x93, 0x0e, 0xac, 0x91, 0x6e,
+    0xa9, 0x90, 0x3e, 0xba, 0x4c, 0xfa, 0xd4, 0x22, 0xe9, 0xf3, 0x8a, 0xf4, 0x95, 0x32, 0xe9, 0xde,
+    0x39, 0xd2, 0x0f, 0x8a, 0xa4, 0x9f, 0x4c, 0x93, 0x7e, 0x2e, 0xa4, 0x5f, 0xe5, 0x49, 0xbf, 0xcd,
+    0x92, 0xfe, 0x38, 0x46, 0xfa, 0x6b, 0x86, 0xf4, 0x2a, 0x93, 0x36, 0x8c, 0x5f, 0xb4, 0x16, 0x70,
+    0x3c, 0x54, 0xaf, 0x06, 0xa3, 0x4a, 0x8e, 0x51, 0xf5, 0x80, 0x17, 0x4c, 0xf0, 0x81, 0x05, 0x41,
+    0x08, 0x41, 0x18, 0x22, 0x60, 0x43, 0x14, 0x62, 0x10, 0x87, 0x04, 0x24, 0x1d, 0x4f, 0x43, 0x9a,
+    0x7a, 0x4d, 0xd7, 0x5b, 0x35, 0xdd, 0x1d, 0x60, 0x42, 0x13, 0xf8, 0xc0, 0x0f, 0x16, 0xec, 0x82,
+    0x20, 0xec, 0x86, 0x10, 0xec, 0x81, 0x30, 0x34, 0x43, 0xa4, 0xba, 0xad, 0xf6, 0x80, 0xf0, 0x00,
+    0x4c, 0xf0, 0x6d, 0x0a, 0x35, 0xfe, 0x20, 0x15, 0xfa, 0x66, 0xa9, 0x83, 0x5f, 0x6c, 0x75, 0x6c,
+    0x21, 0xa9, 0x4e, 0x7f, 0x68, 0x53, 0x17, 0x4b, 0x1d, 0xea, 0xfa, 0x4c, 0x4a, 0xdd, 0x99, 0xea,
+    0x56, 0x0f, 0x27, 0xd3, 0x6a, 0x24, 0xc7, 0x6a, 0x62, 0x7c, 0x54, 0xbd, 0x1e, 0x9e, 0x50, 0xef,
+    0x86, 0x0a, 0xea, 0xd3, 0x60, 0x49, 0x7d, 0xef, 0x9f, 0x57, 0x3f, 0xfb, 0x96, 0x94, 0xe1, 0x5d,
+    0xa6, 0x72, 0xc0, 0x09, 0x52, 0xbd, 0xb6, 0x1e, 0xb1, 0xf1, 0x36, 0x5d, 0xfe, 0xdf, 0x60, 0xa6,
+    0xbb, 0x0f, 0x9e, 0x41, 0x0b, 0x44, 0xe1, 0xc0, 0x46, 0x11, 0x2d, 0x08, 0x42, 0x08, 0xc2, 0x10,
+    0xa9, 0x89, 0xfe, 0xb5, 0xff, 0xa0, 0x9d, 0x8a, 0xa4, 0xb9, 0x6c, 0x4b, 0x62, 0xae, 0x4d, 0x8e,
+    0x17, 0x53, 0xd2, 0x3e, 0x9d, 0x96, 0x94, 0x8c, 0xca, 0xcd, 0x7c, 0x41, 0xee, 0x67, 0xe7, 0xe5,
+    0xf1, 0xd8, 0xaa, 0x3c, 0xcd, 0xf8, 0xe5, 0x25, 0x1f, 0x96, 0x37, 0x03, 0xed, 0xf2, 0xfe, 0x5e,
+    0x97, 0x7c, 0xee, 0x79, 0x24, 0x2b, 0x37, 0x5e, 0x88, 0xdb, 0x39, 0x2b, 0x46, 0xd3, 0x02, 0xe5,
+    0x03, 0x4e, 0x94, 0xea, 0xb5, 0xf5, 0x88, 0xdb, 0xaf, 0xd1, 0x99, 0x8d, 0x83, 0xd9, 0xff, 0x04,
+    0x33, 0xdd, 0x18, 0x1c, 0x82, 0x38, 0xb4, 0x42, 0x62, 0x33, 0x11, 0xed, 0x5a, 0xc4, 0x18, 0xc4,
+    0x21, 0xf1, 0x1b, 0x59, 0x25, 0xe2, 0xfd, 0x33, 0x49, 0x3e, 0x32, 0x95, 0xe2, 0x93, 0x93, 0xcc,
+    0xe7, 0x72, 0x05, 0xee, 0x1c, 0x5f, 0xe2, 0x9e, 0x61, 0x3f, 0x0f, 0x0c, 0x9d, 0xe0, 0xcc, 0x60,
+    0x17, 0x67, 0xfb, 0x47, 0x58, 0xfa, 0x66, 0xb9, 0x78, 0xab, 0xc2, 0xe5, 0xab, 0x7b, 0x79, 0xf1,
+    0xd2, 0x59, 0xae, 0x5c, 0xb8, 0xcb, 0xba, 0x23, 0xc7, 0xeb, 0x2b, 0x0a, 0xbe, 0xbc, 0x94, 0xf6,
+    0xf5, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t DISTANCE_TOO_FAR[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x00, 0x09, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x2d, 0xc6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82,
+};
+
+static const uint8_t BOMB_DEFLATE[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x04, 0x0f, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xc1, 0x31, 0x01, 0x00,
+    0x00, 0x00, 0xc2, 0xa0, 0xf5, 0x4f, 0x6d, 0x08, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x03, 0x00, 0xf0, 0x00, 0x01, 0x9d, 0x5d, 0xf5, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t BOMB_STORED[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x08, 0x0b, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x00, 0x08, 0xff, 0xf7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x01, 0xde, 0xaa, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t BAD_FILTER[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x01, 0xd6, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xa5, 0xd0, 0x41, 0x48, 0x93,
+    0x71, 0x1c, 0xc6, 0xf1, 0xdf, 0xeb, 0xda, 0xea, 0xcd, 0xb1, 0x77, 0x8d, 0x46, 0xc3, 0xd5, 0x9b,
+    0xa3, 0xd9, 0x68, 0x34, 0xea, 0xd2, 0xa5, 0x84, 0xba, 0x04, 0xa5, 0x87, 0x82, 0xe8, 0xb2, 0x02,
+    0x83, 0x8a, 0xcc, 0x20, 0x05, 0xa9, 0x46, 0x1e, 0x0c, 0xa4, 0x7e, 0x90, 0x87, 0x05, 0xa2, 0x42,
+    0x42, 0x0b, 0x96, 0x0c, 0xf2, 0xf0, 0x0b, 0x5c, 0x08, 0x79, 0x58, 0x38, 0x42, 0xa8, 0xc3, 0x42,
+    0x89, 0x3f, 0xd4, 0xc1, 0x24, 0x42, 0xa8, 0xc3, 0xbc, 0x84, 0x2f, 0x6f, 0x83, 0x7f, 0x0f, 0xb5,
+    0x43, 0x1d, 0x84, 0x9c, 0x87, 0x0f, 0x3c, 0xc7, 0x87, 0xaf, 0x97, 0x34, 0xe9, 0xe0, 0x1a, 0xe9,
+    0xd6, 0x2a, 0xe9, 0xc3, 0x2b, 0xa4, 0x4f, 0x2c, 0x91, 0x3e, 0xab, 0x48, 0x5f, 0xaa, 0x90, 0xee,
+    0x9b, 0x27, 0x7d, 0xaf, 0x44, 0xfa, 0xd1, 0x0c, 0xe9, 0xa7, 0x42, 0xfa, 0x45, 0x81, 0xf4, 0xeb,
+    0x1c, 0xe9, 0xf7, 0xe3, 0xa4, 0x3f, 0x67, 0x49, 0xaf, 0x32, 0x69, 0xc3, 0xf8, 0x49, 0x6b, 0x41,
+    0xc7, 0x43, 0x8d, 0x6a, 0x32, 0x6a, 0xe4, 0x18, 0x35, 0x0f, 0xf8, 0xc0, 0x04, 0x3f, 0x58, 0x10,
+    0x82, 0x30, 0x44, 0x20, 0x0a, 0x36, 0xc4, 0x20, 0x0e, 0x09, 0x48, 0x42, 0xca, 0xf1, 0x34, 0x65,
+    0xa8, 0xcf, 0x74, 0x7d, 0x35, 0xd3, 0xdd, 0x06, 0x26, 0x34, 0x83, 0x1f, 0x02, 0x60, 0xc1, 0x0e,
+    0x08, 0xc1, 0x4e, 0x08, 0xc3, 0x2e, 0x88, 0x40, 0x0b, 0x44, 0x6b, 0x5b, 0xea, 0x0f, 0x08, 0x0f,
+    0xc0, 0x04, 0xff, 0x86, 0x90, 0xf7, 0x3b, 0xa9, 0xf0, 0x17, 0x4b, 0xb5, 0x7d, 0xb2, 0xd5, 0x91,
+    0xc5, 0x94, 0x3a, 0xf9, 0xae, 0x5d, 0x9d, 0x2f, 0x77, 0xaa, 0xab, 0xb3, 0x69, 0x75, 0x6b, 0xfa,
+    0xba, 0xba, 0x3f, 0x95, 0x51, 0xa3, 0x79, 0x56, 0x93, 0x13, 0x63, 0xea, 0xe5, 0xc8, 0xa4, 0x7a,
+    0x33, 0x5c, 0x54, 0x1f, 0x86, 0xca, 0xea, 0xeb, 0xc0, 0x82, 0xfa, 0xd1, 0xbf, 0xac, 0x0c, 0xdf,
+    0x0a, 0x55, 0x82, 0x4e, 0x88, 0x1a, 0xb5, 0xf9, 0x88, 0xde, 0x9b, 0x74, 0xf1, 0x7f, 0x83, 0x99,
+    0xee, 0x1e, 0x78, 0x02, 0xad, 0x10, 0x83, 0x7d, 0xeb, 0x45, 0xb4, 0x20, 0x04, 0x61, 0x88, 0x40,
+    0xb4, 0x2e, 0xf6, 0xd7, 0xfe, 0x83, 0xb6, 0x2b, 0x92, 0x96, 0x8a, 0x2d, 0xc9, 0xf9, 0x76, 0x39,
+    0x5a, 0x4a, 0x4b, 0xc7, 0x4c, 0x46, 0xd2, 0x32, 0x26, 0x3d, 0x85, 0xa2, 0xdc, 0xcd, 0x2d, 0xc8,
+    0xc3, 0xf1, 0x55, 0x79, 0x9c, 0x0d, 0xc8, 0x73, 0x3e, 0x28, 0xaf, 0x06, 0x3b, 0xe4, 0xed, 0x9d,
+    0x6e, 0xf9, 0xd8, 0xfb, 0x40, 0xbe, 0x5d, 0x7b, 0x26, 0x6e, 0xd7, 0x9c, 0x18, 0xcd, 0x8b, 0x54,
+    0x08, 0x3a, 0x31, 0x6a, 0xd4, 0xe6, 0x23, 0x6e, 0xbd, 0x42, 0xa7, 0xd6, 0x0f, 0x66, 0xff, 0x13,
+    0xcc, 0x74, 0xe3, 0xb0, 0x1f, 0x12, 0x70, 0x00, 0x92, 0x1b, 0x89, 0x68, 0xd7, 0x23, 0xc6, 0x21,
+    0x01, 0xc9, 0xdf, 0xc8, 0x2a, 0x13, 0xef, 0x9d, 0x4d, 0xf1, 0xa1, 0xe9, 0x34, 0x1f, 0x9f, 0x62,
+    0x3e, 0x93, 0x2f, 0x72, 0xd7, 0xc4, 0x32, 0xf7, 0x8e, 0x04, 0x78, 0x70, 0xf8, 0x18, 0x67, 0x87,
+    0xba, 0x39, 0x37, 0x30, 0xca, 0xd2, 0x3f, 0xc7, 0xa5, 0x1b, 0x55, 0xae, 0x5c, 0xde, 0xcd, 0x4b,
+    0x17, 0x4e, 0x73, 0xf5, 0xdc, 0x6d, 0xd6, 0x9d, 0x79, 0xfe, 0x05, 0x3f, 0x5a, 0xbe, 0xc1, 0x06,
+    0xd1, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
@@ -0,0 +1,251 @@
+#include "IconAtlas.h"
+#include "IconImage.h"
+#include "IconImageFixtures.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Pixel of the fixture image, same formula as make_png_fixtures.py
+ */
+static std::array<uint8_t, 4> TestPixel(int x, int y) {
+    return { static_cast<uint8_t>(x * 16 + y), static_cast<uint8_t>(255 - x * 8 - y * 4),
+        static_cast<uint8_t>(x * y * 3), static_cast<uint8_t>(255 - y * 8) };
+}
+
+/**
+ * @brief The fixture image as each PNG colour type turns it into RGBA
+ */
+static IconImage Expected(int colorType) {
+    IconImage image;
+    image.width = 16;
+    image.height = 16;
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 16; x++) {
+            auto [r, g, b, a] = TestPixel(x, y);
+            std::array<uint8_t, 4> rgba = { r, g, b, a };
+            if (colorType == 0) {
+                rgba = { r, r, r, 255 };
+            }
+            else if (colorType == 2) {
+                rgba = { r, g, b, 255 };
+            }
+            else if (colorType == 3) {
+                int index = (x + y) % 16;
+                rgba = { static_cast<uint8_t>(index * 16), static_cast<uint8_t>(255 - index * 16),
+                    static_cast<uint8_t>(index * 5), static_cast<uint8_t>(255 - index * 10) };
+            }
+            else if (colorType == 4) {
+                rgba = { r, r, r, a };
+            }
+            image.rgba.insert(image.rgba.end(), rgba.begin(), rgba.end());
+        }
+    }
+    return image;
+}
+
+static bool Decodes(std::span<const uint8_t> png, const IconImage& expected) {
+    IconImage image;
+    std::string error;
+    return DecodePNG(png, image, error) && error.empty()
+        && image.width == expected.width && image.height == expected.height && image.rgba == expected.rgba;
+}
+
+static std::string DecodeError(std::span<const uint8_t> png) {
+    IconImage image;
+    std::string error;
+    return DecodePNG(png, image, error) ? std::string() : error;
+}
+
+static std::vector<IconImage> ShippedIcons() {
+    std::vector<IconImage> icons(23);
+    for (int tier = 0; tier < 23; tier++) {
+        std::string error;
+        CHECK(LoadPNG(std::string(LADDERRANK_DATA_DIR) + "/RankIcons/" + std::to_string(tier) + ".png", icons[tier], error));
+    }
+    return icons;
+}
+
+// ============================================================================
+// DECODE
+// ============================================================================
+
+/**
+ * @brief Stored, fixed Huffman and dynamic Huffman blocks inflate to the same image
+ *
+ * RGBA_SPLIT spreads the stream over three IDAT chunks, RGBA_MIXED has
+ * stored blocks after a Huffman block.
+ */
+static void TestDeflateBlockTypes() {
+    IconImage expected = Expected(6);
+    CHECK(Decodes(RGBA_STORED, expected));
+    CHECK(Decodes(RGBA_FIXED, expected));
+    CHECK(Decodes(RGBA_DYNAMIC, expected));
+    CHECK(Decodes(RGBA_SPLIT, expected));
+    CHECK(Decodes(RGBA_MIXED, expected));
+}
+
+/**
+ * @brief Every supported colour type converts to RGBA
+ */
+static void TestColorTypes() {
+    CHECK(Decodes(GREY, Expected(0)));
+    CHECK(Decodes(RGB, Expected(2)));
+    CHECK(Decodes(PALETTE, Expected(3)));
+    CHECK(Decodes(GREY_ALPHA, Expected(4)));
+}
+
+/**
+ * @brief Broken zlib, deflate and filter data is rejected with a reason
+ */
+static void TestCorruptStreams() {
+    CHECK(!DecodeError(BAD_ADLER).empty());
+    CHECK(!DecodeError(BAD_ZLIB_HEADER).empty());
+    CHECK(!DecodeError(BAD_FILTER).empty());
+    CHECK(!DecodeError(BAD_BLOCK_TYPE).empty());
+    CHECK(!DecodeError(BAD_STORED_LENGTH).empty());
+    CHECK(!DecodeError(DISTANCE_TOO_FAR).empty());
+    CHECK(!DecodeError(TRUNCATED_DEFLATE).empty());
+
+#if !LADDERRANK_STB_IMAGE
+    // The built-in inflater names what it found
+    CHECK(DecodeError(BAD_ADLER) == "zlib checksum mismatch");
+    CHECK(DecodeError(BAD_ZLIB_HEADER) == "unsupported zlib header");
+    CHECK(DecodeError(BAD_FILTER) == "invalid filter type");
+#endif
+}
+
+/**
+ * @brief Streams that inflate past the image size stop at the image size
+ */
+static void TestInflateLimit() {
+    CHECK(!DecodeError(BOMB_DEFLATE).empty());
+    CHECK(!DecodeError(BOMB_STORED).empty());
+#if !LADDERRANK_STB_IMAGE
+    CHECK(DecodeError(BOMB_DEFLATE) == "deflate stream larger than the image");
+    CHECK(DecodeError(BOMB_STORED) == "deflate stream larger than the image");
+#endif
+}
+
+/**
+ * @brief Every prefix and every flipped byte of a valid file is rejected
+ */
+static void TestTruncatedAndFlipped() {
+    for (const std::span<const uint8_t> png : { std::span<const uint8_t>(RGBA_FIXED), std::span<const uint8_t>(RGBA_DYNAMIC) }) {
+        for (size_t size = 0; size < png.size(); size++) {
+            CHECK(!DecodeError(png.first(size)).empty());
+        }
+
+        std::vector<uint8_t> copy(png.begin(), png.end());
+        for (size_t i = 0; i < copy.size(); i++) {
+            copy[i] ^= 0x20;
+            CHECK(!DecodeError(copy).empty());
+            copy[i] ^= 0x20;
+        }
+    }
+}
+
+/**
+ * @brief EncodePNG() output and the shipped icons read back unchanged
+ */
+static void TestRoundTrip() {
+    IconImage expected = Expected(6);
+    std::vector<uint8_t> png = EncodePNG(expected);
+    CHECK(Decodes(png, expected));
+
+    for (const IconImage& icon : ShippedIcons()) {
+        CHECK(!icon.Empty());
+        CHECK(icon.Bytes() == static_cast<size_t>(icon.width) * icon.height * 4);
+        CHECK(Decodes(EncodePNG(icon), icon));
+    }
+}
+
+/**
+ * @brief The area filter averages with premultiplied alpha
+ */
+static void TestResize() {
+    IconImage image;
+    image.width = 2;
+    image.height = 2;
+    image.rgba = { 255, 0, 0, 255,   0, 0, 0, 0,
+                   255, 0, 0, 255,   0, 0, 0, 0 };
+
+    IconImage half = ResizeIcon(image, 1, 1);
+    CHECK(half.width == 1 && half.height == 1);
+    CHECK(half.rgba == std::vector<uint8_t>({ 255, 0, 0, 128 }));
+
+    IconImage same = ResizeIcon(Expected(2), 16, 16);
+    CHECK(same.rgba == Expected(2).rgba);
+    CHECK(ResizeIcon(image, 0, 4).Empty());
+}
+
+// ============================================================================
+// ATLAS
+// ============================================================================
+
+/**
+ * @brief Regions stay inside the atlas, apart, within a cell, with matching UVs and pixels
+ */
+static void TestAtlasPacking() {
+    std::vector<IconImage> icons = ShippedIcons();
+    icons.push_back(IconImage{});   // A missing icon
+
+    for (int cell : { 64, 128, 256 }) {
+        IconAtlas atlas;
+        std::string error;
+        CHECK(BuildIconAtlas(icons, cell, 2, atlas, error));
+        CHECK(atlas.regions.size() == icons.size());
+        CHECK(atlas.image.width == atlas.image.height);
+        CHECK(!atlas.regions.back().Valid());
+
+        for (size_t i = 0; i + 1 < atlas.regions.size(); i++) {
+            const AtlasRegion& a = atlas.regions[i];
+            CHECK(a.Valid());
+            CHECK(a.x >= 2 && a.y >= 2 && a.x + a.width + 2 <= atlas.image.width && a.y + a.height + 2 <= atlas.image.height);
+            CHECK(std::max(a.width, a.height) <= cell);
+            CHECK(a.u0 == static_cast<float>(a.x) / atlas.image.width && a.v1 == static_cast<float>(a.y + a.height) / atlas.image.height);
+
+            for (size_t j = i + 1; j + 1 < atlas.regions.size(); j++) {
+                const AtlasRegion& b = atlas.regions[j];
+                CHECK(a.x + a.width + 4 <= b.x || b.x + b.width + 4 <= a.x
+                    || a.y + a.height + 4 <= b.y || b.y + b.height + 4 <= a.y);
+            }
+
+            // Icons that fit a cell are copied as they are
+            const IconImage& icon = icons[i];
+            if (std::max(icon.width, icon.height) <= cell) {
+                for (int y = 0; y < icon.height; y++) {
+                    CHECK(std::memcmp(atlas.image.rgba.data() + (static_cast<size_t>(a.y + y) * atlas.image.width + a.x) * 4,
+                        icon.rgba.data() + static_cast<size_t>(y) * icon.width * 4, static_cast<size_t>(icon.width) * 4) == 0);
+                }
+            }
+        }
+    }
+
+    IconAtlas atlas;
+    std::string error;
+    CHECK(!BuildIconAtlas(std::vector<IconImage>(3), 64, 2, atlas, error));
+    CHECK(error == "no icons to pack");
+    CHECK(!BuildIconAtlas(icons, 0, 2, atlas, error));
+}
+
+int main() {
+    RUN_TEST(TestDeflateBlockTypes);
+    RUN_TEST(TestColorTypes);
+    RUN_TEST(TestCorruptStreams);
+    RUN_TEST(TestInflateLimit);
+    RUN_TEST(TestTruncatedAndFlipped);
+    RUN_TEST(TestRoundTrip);
+    RUN_TEST(TestResize);
+    RUN_TEST(TestAtlasPacking);
+    return TestResult();
+}
@@ -0,0 +1,354 @@
+// LadderRankBench - times the portable modules against the code paths they
+// replaced. Not run by CTest, timings depend on the machine.
+//
+// Usage:
+//   LadderRankBench [bench names...]   (default: every bench)
+
+#include "LobbyRanks.h"
+#include "MMRHistory.h"
+#include "RankTable.h"
+#include "json.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+// ============================================================================
+// ALLOCATION COUNTER
+// ============================================================================
+
+// Every operator new of the process, read before and after a timed loop
+static std::atomic<uint64_t> allocations{ 0 };
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// operator new above allocates with malloc, so free is the matching release.
+// GCC only sees a pointer from operator new reaching free once the replaced
+// operators are inlined, and warns.
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static double MicrosecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static std::string RankNumbersFolder() {
+    return std::string(LADDERRANK_DATA_DIR) + "/RankNumbers";
+}
+
+static std::string RankNumbersFile(int playlist) {
+    return RankNumbersFolder() + "/" + std::to_string(playlist) + ".json";
+}
+
+// ============================================================================
+// BENCHES
+// ============================================================================
+
+/**
+ * @brief unranker() parsing a RankNumbers file per call against RankTable::Lookup()
+ */
+static void BenchLookup() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+
+    // Printed, so the timed loops cannot be optimised away
+    int64_t checksum = 0;
+
+    constexpr int PARSES = 200;
+    auto start = Clock::now();
+    for (int i = 0; i < PARSES; i++) {
+        std::ifstream file(RankNumbersFile(11));
+        nlohmann::json data = nlohmann::json::parse(file);
+        checksum += data["data"]["data"][5]["minMMR"].get<int>();
+    }
+    double parseMicroseconds = MicrosecondsSince(start) / PARSES;
+
+    constexpr int LOOKUPS = 10000000;
+    start = Clock::now();
+    for (int i = 0; i < LOOKUPS; i++) {
+        checksum += table.Lookup(11, (i % 22) + 1, i & 3, i & 1);
+    }
+    double lookupNanoseconds = MicrosecondsSince(start) * 1000.0 / LOOKUPS;
+
+    std::printf("lookup: json::parse per call %.1f us, RankTable::Lookup %.2f ns (checksum %lld)\n",
+        parseMicroseconds, lookupNanoseconds, static_cast<long long>(checksum));
+}
+
+/**
+ * @brief Cold start: every RankNumbers JSON file against RankNumbers.bin
+ */
+static void BenchLoad() {
+    std::string binary = std::string(LADDERRANK_DATA_DIR) + "/RankNumbers.bin";
+    std::string error;
+
+    constexpr int ROUNDS = 200;
+    double jsonMicroseconds = 0.0;
+    double binaryMicroseconds = 0.0;
+    for (int i = 0; i < ROUNDS; i++) {
+        auto start = Clock::now();
+        RankTable fromJson;
+        fromJson.LoadFolder(RankNumbersFolder(), error);
+        jsonMicroseconds += MicrosecondsSince(start);
+
+        start = Clock::now();
+        RankTable fromBinary;
+        if (!fromBinary.LoadBinary(binary, RankNumbersFolder(), error)) {
+            std::printf("load: RankNumbers.bin rejected: %s\n", error.c_str());
+            return;
+        }
+        binaryMicroseconds += MicrosecondsSince(start);
+    }
+
+    std::printf("load: 8 JSON files %.0f us, RankNumbers.bin %.0f us\n",
+        jsonMicroseconds / ROUNDS, binaryMicroseconds / ROUNDS);
+}
+
+/**
+ * @brief Streaming SAX loader against json::parse on every RankNumbers file
+ */
+static void BenchParse() {
+    constexpr int ROUNDS = 100;
+    std::string error;
+
+    for (int playlist : RankTable::rankedPlaylists) {
+        RankTable table;
+        uint64_t before = allocations.load();
+        auto start = Clock::now();
+        for (int i = 0; i < ROUNDS; i++) {
+            if (!table.LoadPlaylistFile(playlist, RankNumbersFile(playlist), error)) {
+                std::printf("parse: %s\n", error.c_str());
+                return;
+            }
+        }
+        double saxMicroseconds = MicrosecondsSince(start) / ROUNDS;
+        uint64_t saxAllocations = (allocations.load() - before) / ROUNDS;
+
+        before = allocations.load();
+        start = Clock::now();
+        for (int i = 0; i < ROUNDS; i++) {
+            std::ifstream file(RankNumbersFile(playlist));
+            nlohmann::json data = nlohmann::json::parse(file);
+        }
+        double domMicroseconds = MicrosecondsSince(start) / ROUNDS;
+        uint64_t domAllocations = (allocations.load() - before) / ROUNDS;
+
+        std::printf("parse %2d.json: SAX %4.0f us %5llu allocations, json::parse %4.0f us %5llu allocations\n",
+            playlist, saxMicroseconds, static_cast<unsigned long long>(saxAllocations),
+            domMicroseconds, static_cast<unsigned long long>(domAllocations));
+    }
+}
+
+/**
+ * @brief 1M random TopPercent() queries against scanning every division
+ */
+static void BenchPercentile() {
+    // Bell curve of players centred on Platinum, the shipped files have none
+    std::ifstream source(RankNumbersFile(11));
+    nlohmann::json file = nlohmann::json::parse(source);
+    std::vector<std::array<double, 3>> divisions;
+    for (auto& entry : file["data"]["data"]) {
+        int tier = entry["tier"];
+        entry["players"] = (tier == 0) ? 0 : static_cast<int>(100000 * std::exp(-(tier - 11) * (tier - 11) / 20.0));
+        if (tier != 0) {
+            divisions.push_back({ entry["minMMR"].get<double>(), entry["maxMMR"].get<double>(), entry["players"].get<double>() });
+        }
+    }
+    auto path = std::filesystem::temp_directory_path() / "LadderRankBench_11.json";
+    std::ofstream(path) << file.dump();
+
+    RankTable table;
+    std::string error;
+    bool loaded = table.LoadPlaylistFile(11, path, error);
+    std::filesystem::remove(path);
+    if (!loaded) {
+        std::printf("percentile: %s\n", error.c_str());
+        return;
+    }
+
+    constexpr int QUERIES = 1000000;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> range(0.0f, 2200.0f);
+    std::vector<float> queries(QUERIES);
+    for (float& mmr : queries) {
+        mmr = range(rng);
+    }
+
+    double checksum = 0.0;
+    auto start = Clock::now();
+    for (float mmr : queries) {
+        checksum += table.TopPercent(11, mmr);
+    }
+    double indexMicroseconds = MicrosecondsSince(start);
+
+    double total = 0.0;
+    for (const auto& division : divisions) {
+        total += division[2];
+    }
+    start = Clock::now();
+    for (float mmr : queries) {
+        double below = 0.0;
+        for (const auto& [minMMR, maxMMR, players] : divisions) {
+            below += (mmr >= maxMMR) ? players : (mmr > minMMR) ? players * (mmr - minMMR) / (maxMMR - minMMR) : 0.0;
+        }
+        checksum += 100.0 * (total - below) / total;
+    }
+    double scanMicroseconds = MicrosecondsSince(start);
+
+    std::printf("percentile: 1M TopPercent %.1f ms (%.1f ns each), 1M scans of %zu divisions %.1f ms (checksum %.0f)\n",
+        indexMicroseconds / 1000.0, indexMicroseconds * 1000.0 / QUERIES, divisions.size(),
+        scanMicroseconds / 1000.0, checksum);
+}
+
+static void BenchHistory() {
+    constexpr int RECORDS = 1000000;
+    constexpr int64_t START = 1700000000000;
+    constexpr int PLAYLISTS[] = { 10, 11, 13, 27, 28, 29, 30, 34 };
+    auto path = std::filesystem::temp_directory_path() / "LadderRankBench_MMRHistory.bin";
+    std::filesystem::remove(path);
+
+    MMRHistoryWriter writer;
+    std::string error;
+    if (!writer.Open(path, std::chrono::milliseconds(50), error)) {
+        std::printf("history: %s\n", error.c_str());
+        return;
+    }
+    uint64_t before = allocations.load();
+    auto start = Clock::now();
+    for (int i = 0; i < RECORDS; i++) {
+        writer.Append(MakeHistoryRecord(START + i * 1000LL, PLAYLISTS[i % 8], 1000.0f + (i % 300),
+            10 + (i % 5), i % 4, MatchOutcome::None));
+    }
+    writer.Close();
+    double appendMicroseconds = MicrosecondsSince(start);
+    uint64_t appendAllocations = allocations.load() - before;
+
+    start = Clock::now();
+    MMRHistory history;
+    if (!history.Open(path, error)) {
+        std::printf("history: %s\n", error.c_str());
+        std::filesystem::remove(path);
+        return;
+    }
+    double openMicroseconds = MicrosecondsSince(start);
+
+    double checksum = 0.0;
+    start = Clock::now();
+    for (const MMRHistoryRecord& record : history.All()) {
+        checksum += record.mmr;
+    }
+    double scanMicroseconds = MicrosecondsSince(start);
+
+    start = Clock::now();
+    std::vector<MMRHistoryRecord> window = history.Query(11, START + 400000 * 1000LL, START + 500000 * 1000LL);
+    double queryMicroseconds = MicrosecondsSince(start);
+    checksum += window.size();
+
+    history.Close();
+    std::filesystem::remove(path);
+    std::printf("history: 1M appends %.1f ms (%.1f ns each, %llu allocations, %llu syncs), open %.1f us, "
+        "scan %.1f ms, 100k window of one playlist %.1f us (checksum %.0f)\n",
+        appendMicroseconds / 1000.0, appendMicroseconds * 1000.0 / RECORDS,
+        static_cast<unsigned long long>(appendAllocations), static_cast<unsigned long long>(writer.Syncs()),
+        openMicroseconds, scanMicroseconds / 1000.0, queryMicroseconds, checksum);
+}
+
+static void BenchLobby() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    std::vector<LobbyPlayer> lobby;
+    for (int i = 0; i < 8; i++) {
+        lobby.push_back(LobbyPlayer{ "Steam|76561198" + std::to_string(100000 + i) + "|0", "Player", i % 2 });
+    }
+    uint64_t fetches = 0;
+    LobbyRankCache::Fetch fetch = [&fetches](const LobbyPlayer& player, int, float& mmr) {
+        fetches++;
+        mmr = 200.0f + static_cast<float>(std::hash<std::string>()(player.id) % 1600);
+        return true;
+    };
+
+    constexpr int LOBBIES = 200000;
+    LobbyRankCache cache(256, std::chrono::hours(1));
+    auto now = LobbyRankCache::Clock::now();
+    cache.Resolve(lobby, 11, table, fetch, now);
+
+    double checksum = 0.0;
+    auto start = Clock::now();
+    for (int i = 0; i < LOBBIES; i++) {
+        checksum += cache.Resolve(lobby, 11, table, fetch, now)[3].position.tier;
+    }
+    double cachedMicroseconds = MicrosecondsSince(start);
+
+    LobbyRankCache uncached(1, std::chrono::seconds(0));
+    start = Clock::now();
+    for (int i = 0; i < LOBBIES; i++) {
+        checksum += uncached.Resolve(lobby, 11, table, fetch, now)[3].position.tier;
+    }
+    double uncachedMicroseconds = MicrosecondsSince(start);
+
+    std::printf("lobby: 8 players cached %.2f us, fetched every time %.2f us (%llu fetches, checksum %.0f)\n",
+        cachedMicroseconds / LOBBIES, uncachedMicroseconds / LOBBIES, static_cast<unsigned long long>(fetches), checksum);
+}
+
+struct Bench {
+    const char* name;
+    std::function<void()> run;
+};
+
+int main(int argc, char** argv) {
+    const std::vector<Bench> benches = {
+        { "lookup", BenchLookup },
+        { "load", BenchLoad },
+        { "parse", BenchParse },
+        { "percentile", BenchPercentile },
+        { "history", BenchHistory },
+        { "lobby", BenchLobby },
+    };
+
+    for (const Bench& bench : benches) {
+        bool selected = (argc < 2);
+        for (int i = 1; i < argc; i++) {
+            selected |= (std::strcmp(argv[i], bench.name) == 0);
+        }
+        if (selected) {
+            bench.run();
+        }
+    }
+    return 0;
+}
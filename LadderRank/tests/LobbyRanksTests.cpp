@@ -0,0 +1,193 @@
+#include "LobbyRanks.h"
+#include "TestCheck.h"
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// TEST DOUBLE
+// ============================================================================
+
+/**
+ * @brief Stands in for MMRWrapper: a fixed MMR per player, counts every fetch
+ */
+struct FakeMMR {
+    std::map<std::string, float> mmr;
+    std::set<std::string> unsynced;
+    std::map<std::string, int> calls;
+
+    LobbyRankCache::Fetch Fetch() {
+        return [this](const LobbyPlayer& player, int playlist, float& value) {
+            calls[player.id]++;
+            if (unsynced.count(player.id) != 0) {
+                return false;
+            }
+            auto found = mmr.find(player.id);
+            value = (found != mmr.end()) ? found->second : 500.0f + playlist;
+            return true;
+        };
+    }
+
+    int Calls() const {
+        int total = 0;
+        for (const auto& [id, count] : calls) {
+            total += count;
+        }
+        return total;
+    }
+};
+
+static LobbyPlayer Player(const std::string& id) {
+    return LobbyPlayer{ id, "Player " + id, 0 };
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief Cached players are not fetched again, ranks match RankTable::Locate()
+ */
+static void TestHitsAndRanks() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    FakeMMR fake;
+    fake.mmr = { { "a", 250.0f }, { "b", 812.5f }, { "c", 1430.0f }, { "d", 2100.0f } };
+    LobbyRankCache cache(8, 60s);
+    LobbyRankCache::Clock::time_point t{};
+    std::vector<LobbyPlayer> lobby = { Player("a"), Player("b"), Player("c"), Player("d") };
+
+    for (int match = 0; match < 3; match++) {
+        std::vector<LobbyRank> ranks = cache.Resolve(lobby, 11, table, fake.Fetch(), t + match * 1s);
+        CHECK(ranks.size() == lobby.size());
+        for (size_t i = 0; i < ranks.size() && i < lobby.size(); i++) {
+            RankPosition expected = table.Locate(11, fake.mmr[lobby[i].id]);
+            CHECK(ranks[i].known);
+            CHECK(ranks[i].player.id == lobby[i].id);
+            CHECK(ranks[i].mmr == fake.mmr[lobby[i].id]);
+            CHECK(ranks[i].position.tier == expected.tier && ranks[i].position.division == expected.division);
+        }
+    }
+    CHECK(fake.Calls() == 4);
+    CHECK(cache.Misses() == 4 && cache.Hits() == 8);
+    CHECK(cache.Size() == 4);
+
+    // Playlists are cached apart
+    cache.Resolve({ Player("a") }, 13, table, fake.Fetch(), t);
+    CHECK(fake.calls["a"] == 2);
+    CHECK(cache.Size() == 5);
+
+    cache.Clear();
+    CHECK(cache.Size() == 0);
+    cache.Resolve({ Player("a") }, 11, table, fake.Fetch(), t);
+    CHECK(fake.calls["a"] == 3);
+}
+
+/**
+ * @brief A full cache drops the least recently seen player
+ */
+static void TestEviction() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    FakeMMR fake;
+    LobbyRankCache cache(2, 60s);
+    LobbyRankCache::Clock::time_point t{};
+
+    cache.Resolve({ Player("a"), Player("b") }, 11, table, fake.Fetch(), t);
+    cache.Resolve({ Player("a") }, 11, table, fake.Fetch(), t + 1s);   // b is now the oldest
+    cache.Resolve({ Player("c") }, 11, table, fake.Fetch(), t + 2s);
+    CHECK(cache.Evictions() == 1);
+    CHECK(cache.Size() == 2);
+
+    cache.Resolve({ Player("a"), Player("c") }, 11, table, fake.Fetch(), t + 3s);
+    CHECK(fake.calls["a"] == 1 && fake.calls["c"] == 1);
+    cache.Resolve({ Player("b") }, 11, table, fake.Fetch(), t + 4s);
+    CHECK(fake.calls["b"] == 2);
+    CHECK(cache.Evictions() == 2);
+    CHECK(cache.Size() == 2);
+}
+
+/**
+ * @brief Entries older than the TTL are fetched again, unsynced players are not cached
+ */
+static void TestExpiry() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    FakeMMR fake;
+    fake.mmr["a"] = 900.0f;
+    LobbyRankCache cache(8, 60s);
+    LobbyRankCache::Clock::time_point t{};
+
+    cache.Resolve({ Player("a") }, 11, table, fake.Fetch(), t);
+    cache.Resolve({ Player("a") }, 11, table, fake.Fetch(), t + 59s);
+    CHECK(fake.calls["a"] == 1);
+
+    fake.mmr["a"] = 950.0f;
+    std::vector<LobbyRank> ranks = cache.Resolve({ Player("a") }, 11, table, fake.Fetch(), t + 60s);
+    CHECK(fake.calls["a"] == 2);
+    CHECK(cache.Expired() == 1);
+    CHECK(ranks[0].mmr == 950.0f);
+    CHECK(cache.Size() == 1);
+
+    fake.unsynced.insert("b");
+    ranks = cache.Resolve({ Player("b"), Player("a") }, 11, table, fake.Fetch(), t + 61s);
+    CHECK(!ranks[0].known && ranks[1].known);
+    CHECK(ranks[1].mmr == 950.0f);
+    fake.unsynced.clear();
+    ranks = cache.Resolve({ Player("b") }, 11, table, fake.Fetch(), t + 62s);
+    CHECK(ranks[0].known);
+    CHECK(fake.calls["b"] == 2);
+}
+
+/**
+ * @brief A season of lobbies drawn from a pool of regular opponents
+ *
+ * Opponents follow a geometric distribution over 5000 players, matches are
+ * 400 s apart over about 23 days and the TTL is a day. A bigger cache never
+ * hits less, and a cache of a few hundred players already saves most fetches.
+ */
+static void TestSeasonHitRate() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    double previous = 0.0;
+
+    for (size_t capacity : { 16, 64, 256, 1024 }) {
+        FakeMMR fake;
+        LobbyRankCache cache(capacity, 24h);
+        LobbyRankCache::Clock::time_point t{};
+        std::mt19937 rng(7);
+        std::geometric_distribution<int> opponent(0.01);
+
+        for (int match = 0; match < 5000; match++) {
+            t += 400s;
+            std::vector<LobbyPlayer> lobby = { Player("self") };
+            for (int i = 1; i < 6; i++) {
+                lobby.push_back(Player(std::to_string(opponent(rng) % 5000)));
+            }
+            cache.Resolve(lobby, 11, table, fake.Fetch(), t);
+        }
+
+        double hitRate = static_cast<double>(cache.Hits()) / (cache.Hits() + cache.Misses());
+        CHECK(static_cast<uint64_t>(fake.Calls()) == cache.Misses());
+        CHECK(cache.Size() <= capacity);
+        CHECK(hitRate >= previous);
+        previous = hitRate;
+        if (capacity >= 256) {
+            CHECK(hitRate > 0.5);
+            CHECK(cache.Expired() > 0);
+        }
+    }
+}
+
+int main() {
+    RUN_TEST(TestHitsAndRanks);
+    RUN_TEST(TestEviction);
+    RUN_TEST(TestExpiry);
+    RUN_TEST(TestSeasonHitRate);
+    return TestResult();
+}
@@ -0,0 +1,223 @@
+#include "MMRHistory.h"
+#include "TestCheck.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+constexpr int64_t START = 1700000000000;  // Milliseconds since the epoch
+constexpr int PLAYLISTS[] = { 10, 11, 13, 27, 28, 29, 30, 34 };
+
+static std::filesystem::path HistoryPath() {
+    return std::filesystem::temp_directory_path() / "LadderRankTests_MMRHistory.bin";
+}
+
+/**
+ * @brief Record i of the test sequence, one second apart over every playlist
+ */
+static MMRHistoryRecord SequenceRecord(int i) {
+    return MakeHistoryRecord(START + i * 1000LL, PLAYLISTS[i % 8], 1000.0f + (i % 97) + 0.25f,
+        10 + (i % 5), i % 4, static_cast<MatchOutcome>(i % 3));
+}
+
+/**
+ * @brief Writes records 0..count-1 of the sequence to a fresh file
+ */
+static void WriteSequence(int count) {
+    std::filesystem::remove(HistoryPath());
+    MMRHistoryWriter writer;
+    std::string error;
+    CHECK(writer.Open(HistoryPath(), std::chrono::milliseconds(10), error));
+    for (int i = 0; i < count; i++) {
+        writer.Append(SequenceRecord(i));
+    }
+    writer.Close();
+    CHECK(writer.FailedRecords() == 0);
+}
+
+static bool SameRecord(const MMRHistoryRecord& a, const MMRHistoryRecord& b) {
+    return a.timestamp == b.timestamp && a.playlist == b.playlist && a.mmr == b.mmr
+        && a.tier == b.tier && a.division == b.division && a.outcome == b.outcome && a.check == b.check;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief Every appended record reads back unchanged, also across reopens
+ */
+static void TestRoundTrip() {
+    WriteSequence(1000);
+
+    std::string error;
+    MMRHistoryWriter writer;
+    CHECK(writer.Open(HistoryPath(), std::chrono::milliseconds(10), error));
+    for (int i = 1000; i < 1500; i++) {
+        writer.Append(SequenceRecord(i));
+    }
+    writer.Close();
+
+    MMRHistory history;
+    CHECK(history.Open(HistoryPath(), error));
+    CHECK(history.Count() == 1500);
+    for (size_t i = 0; i < history.Count(); i++) {
+        CHECK(IsValidRecord(history.All()[i]));
+        CHECK(SameRecord(history.All()[i], SequenceRecord(static_cast<int>(i))));
+    }
+    history.Close();
+    std::filesystem::remove(HistoryPath());
+}
+
+/**
+ * @brief Range() and Query() return what a linear filter returns
+ */
+static void TestQueries() {
+    WriteSequence(5000);
+
+    std::string error;
+    MMRHistory history;
+    CHECK(history.Open(HistoryPath(), error));
+
+    int64_t from = START + 1234 * 1000LL;
+    int64_t to = START + 3456 * 1000LL;
+    auto range = history.Range(from, to);
+    CHECK(range.size() == 3456 - 1234);
+    CHECK(!range.empty() && range.front().timestamp == from);
+
+    for (int playlist : { 0, 11, 34, 12 }) {
+        std::vector<MMRHistoryRecord> expected;
+        for (const MMRHistoryRecord& record : history.All()) {
+            if (record.timestamp >= from && record.timestamp < to && (playlist == 0 || record.playlist == playlist)) {
+                expected.push_back(record);
+            }
+        }
+        std::vector<MMRHistoryRecord> found = history.Query(playlist, from, to);
+        CHECK(found.size() == expected.size());
+        for (size_t i = 0; i < found.size() && i < expected.size(); i++) {
+            CHECK(SameRecord(found[i], expected[i]));
+        }
+    }
+
+    CHECK(history.Query(0, START - 10000, START).empty());
+    CHECK(history.Query(0, to, from).empty());
+    history.Close();
+    std::filesystem::remove(HistoryPath());
+}
+
+/**
+ * @brief A clock that goes back is clamped, the file stays in order
+ */
+static void TestClockGoingBack() {
+    std::filesystem::remove(HistoryPath());
+    std::string error;
+    MMRHistoryWriter writer;
+    CHECK(writer.Open(HistoryPath(), std::chrono::milliseconds(10), error));
+    writer.Append(MakeHistoryRecord(START + 5000, 11, 1000.0f, 10, 1, MatchOutcome::None));
+    writer.Append(MakeHistoryRecord(START, 11, 1010.0f, 10, 1, MatchOutcome::Win));
+    writer.Close();
+
+    MMRHistory history;
+    CHECK(history.Open(HistoryPath(), error));
+    CHECK(history.Count() == 2);
+    CHECK(history.Count() == 2 && history.All()[1].timestamp >= history.All()[0].timestamp);
+    CHECK(history.Count() == 2 && IsValidRecord(history.All()[1]));
+    history.Close();
+    std::filesystem::remove(HistoryPath());
+}
+
+/**
+ * @brief A torn last record is ignored by readers and cut by the next writer
+ */
+static void TestTornTail() {
+    WriteSequence(100);
+    std::ofstream(HistoryPath(), std::ios::binary | std::ios::app) << "torn recor";
+
+    std::string error;
+    {
+        MMRHistory history;
+        CHECK(history.Open(HistoryPath(), error));
+        CHECK(history.Count() == 100);
+    }
+
+    MMRHistoryWriter writer;
+    CHECK(writer.Open(HistoryPath(), std::chrono::milliseconds(10), error));
+    writer.Append(SequenceRecord(100));
+    writer.Close();
+
+    MMRHistory history;
+    CHECK(history.Open(HistoryPath(), error));
+    CHECK(history.Count() == 101);
+    CHECK(history.Count() == 101 && SameRecord(history.All()[100], SequenceRecord(100)));
+    history.Close();
+    std::filesystem::remove(HistoryPath());
+}
+
+/**
+ * @brief Compaction drops corrupt, old and repeated readings and keeps the rest
+ */
+static void TestCompaction() {
+    std::string error;
+
+    // Corrupt record 10: skipped by Query(), removed by compaction
+    WriteSequence(100);
+    {
+        std::fstream file(HistoryPath(), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(sizeof(MMRHistoryHeader) + 10 * sizeof(MMRHistoryRecord) + 8);
+        file.put(0x55);
+    }
+    {
+        MMRHistory history;
+        CHECK(history.Open(HistoryPath(), error));
+        CHECK(!IsValidRecord(history.All()[10]));
+        CHECK(history.Query(0, START, START + 100 * 1000LL).size() == 99);
+    }
+    CHECK(CompactMMRHistory(HistoryPath(), 0, error) == 1);
+
+    // Older than keepFrom
+    CHECK(CompactMMRHistory(HistoryPath(), START + 50 * 1000LL, error) == 49);
+    {
+        MMRHistory history;
+        CHECK(history.Open(HistoryPath(), error));
+        CHECK(history.Count() == 50);
+        CHECK(history.Count() == 50 && history.All().front().timestamp == START + 50 * 1000LL);
+    }
+
+    // Repeated readings collapse, a match outcome or a new MMR is kept
+    std::filesystem::remove(HistoryPath());
+    {
+        MMRHistoryWriter writer;
+        CHECK(writer.Open(HistoryPath(), std::chrono::milliseconds(10), error));
+        for (int i = 0; i < 10; i++) {
+            writer.Append(MakeHistoryRecord(START + i, 11, 1000.0f, 10, 1, MatchOutcome::None));
+        }
+        writer.Append(MakeHistoryRecord(START + 20, 11, 1000.0f, 10, 1, MatchOutcome::Loss));
+        writer.Append(MakeHistoryRecord(START + 21, 11, 1010.0f, 10, 1, MatchOutcome::None));
+        writer.Append(MakeHistoryRecord(START + 22, 13, 1010.0f, 10, 1, MatchOutcome::None));
+    }
+    CHECK(CompactMMRHistory(HistoryPath(), 0, error) == 9);
+    {
+        MMRHistory history;
+        CHECK(history.Open(HistoryPath(), error));
+        CHECK(history.Count() == 4);
+    }
+
+    CHECK(CompactMMRHistory(HistoryPath().string() + ".missing", 0, error) == -1);
+    std::filesystem::remove(HistoryPath());
+}
+
+int main() {
+    RUN_TEST(TestRoundTrip);
+    RUN_TEST(TestQueries);
+    RUN_TEST(TestClockGoingBack);
+    RUN_TEST(TestTornTail);
+    RUN_TEST(TestCompaction);
+    return TestResult();
+}
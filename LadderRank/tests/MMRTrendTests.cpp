@@ -0,0 +1,131 @@
+#include "MMRTrend.h"
+#include "RankSnapshot.h"
+#include "TestCheck.h"
+
+#include <cmath>
+#include <vector>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static MMRTrend Replay(const std::vector<float>& readings) {
+    MMRTrend trend;
+    for (float mmr : readings) {
+        trend.Update(mmr);
+    }
+    return trend;
+}
+
+static bool Near(float a, float b) {
+    return std::fabs(a - b) < 1e-4f;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief A recorded 2v2 evening, averages computed by hand
+ *
+ * Gains 9, 9, 9, 10, 9 average to 9.1875 and losses 8, 8, 9, 8 to 8.1875;
+ * the +110 jump after the seventh match is a placement and is skipped.
+ */
+static void TestRecordedSession() {
+    MMRTrend trend = Replay({ 1012, 1021, 1030, 1022, 1031, 1023, 1014, 1024, 1134, 1143, 1135 });
+    CHECK(trend.hasReading);
+    CHECK(trend.lastMMR == 1135.0f);
+    CHECK(trend.gains == 5 && trend.losses == 4);
+    CHECK(Near(trend.gain, 9.1875f));
+    CHECK(Near(trend.loss, 8.1875f));
+}
+
+/**
+ * @brief The first step seeds the average, repeated readings are not matches
+ */
+static void TestSeedAndRepeats() {
+    MMRTrend trend = Replay({ 500 });
+    CHECK(trend.hasReading && trend.gains == 0 && trend.losses == 0);
+    CHECK(trend.gain == 0.0f && trend.loss == 0.0f);
+
+    trend = Replay({ 500, 500, 512, 512, 512 });
+    CHECK(trend.gains == 1 && trend.losses == 0);
+    CHECK(trend.gain == 12.0f && trend.loss == 0.0f);
+
+    trend = Replay({ 700, 693 });
+    CHECK(trend.gains == 0 && trend.losses == 1);
+    CHECK(trend.loss == 7.0f);
+}
+
+/**
+ * @brief Steps up to MMR_TREND_MAX_STEP count, larger jumps only move the reference
+ */
+static void TestStepLimit() {
+    MMRTrend trend = Replay({ 1000, 1000 + MMR_TREND_MAX_STEP, 1000 });
+    CHECK(trend.gains == 1 && trend.losses == 1);
+    CHECK(trend.gain == MMR_TREND_MAX_STEP && trend.loss == MMR_TREND_MAX_STEP);
+
+    // Season reset: soft reset down, then normal matches from the new MMR
+    trend = Replay({ 1400, 1409, 1200, 1190, 1199 });
+    CHECK(trend.gains == 2 && trend.losses == 1);
+    CHECK(Near(trend.gain, 9.0f) && Near(trend.loss, 10.0f));
+}
+
+/**
+ * @brief A long streak converges to the new step size
+ */
+static void TestConvergence() {
+    std::vector<float> readings = { 1000 };
+    for (int i = 0; i < 8; i++) {
+        readings.push_back(readings.back() + 12);
+    }
+    for (int i = 0; i < 40; i++) {
+        readings.push_back(readings.back() + 8);
+    }
+    MMRTrend trend = Replay(readings);
+    CHECK(trend.gains == 48);
+    CHECK(Near(trend.gain, 8.0f + 4.0f * std::pow(1.0f - MMR_TREND_ALPHA, 40.0f)));
+    CHECK(std::fabs(trend.gain - 8.0f) < 0.01f);
+}
+
+/**
+ * @brief Matches needed to cover a distance
+ */
+static void TestProjectMatches() {
+    CHECK(ProjectMatches(20.0f, 9.0f) == 3);
+    CHECK(ProjectMatches(18.0f, 9.0f) == 2);
+    CHECK(ProjectMatches(0.5f, 9.0f) == 1);
+    CHECK(ProjectMatches(0.0f, 9.0f) == -1);
+    CHECK(ProjectMatches(-4.0f, 9.0f) == -1);
+    CHECK(ProjectMatches(5.0f, 0.0f) == -1);
+}
+
+/**
+ * @brief The snapshot projects wins and losses from the trend
+ */
+static void TestSnapshotProjection() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    MMRTrend trend = Replay({ 1012, 1021, 1030, 1022, 1031, 1023, 1014, 1024, 1134, 1143, 1135 });
+    RankPosition position = table.Locate(11, trend.lastMMR);
+
+    RankSnapshot snapshot = BuildRankSnapshot(table, 1, 11, trend.lastMMR, position.tier, position.division,
+        trend.gain, trend.loss);
+    CHECK(snapshot.winsToNext == static_cast<int>(std::ceil((snapshot.nextLower - trend.lastMMR) / trend.gain)));
+    CHECK(snapshot.lossesToPrevious == static_cast<int>(std::ceil((trend.lastMMR - snapshot.beforeUpper) / trend.loss)));
+    CHECK(snapshot.projectionText.find(" W up") != std::string::npos);
+
+    RankSnapshot unknown = BuildRankSnapshot(table, 1, 11, trend.lastMMR, position.tier, position.division);
+    CHECK(unknown.winsToNext == -1 && unknown.lossesToPrevious == -1);
+    CHECK(unknown.projectionText.empty());
+}
+
+int main() {
+    RUN_TEST(TestRecordedSession);
+    RUN_TEST(TestSeedAndRepeats);
+    RUN_TEST(TestStepLimit);
+    RUN_TEST(TestConvergence);
+    RUN_TEST(TestProjectMatches);
+    RUN_TEST(TestSnapshotProjection);
+    return TestResult();
+}
@@ -0,0 +1,140 @@
+#include "PerfCounters.h"
+#include "TestCheck.h"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief Aggregates of a known set of samples
+ */
+static void TestSummarize() {
+    std::vector<float> samples;
+    for (int i = 100; i >= 1; i--) {
+        samples.push_back(static_cast<float>(i));
+    }
+    PerfStats stats = SummarizePerf(samples);
+    CHECK(stats.samples == 100);
+    CHECK(stats.average == 50.5);
+    CHECK(stats.p50 == 51.0);
+    CHECK(stats.p99 == 99.0);
+    CHECK(stats.max == 100.0);
+
+    std::vector<float> one = { 7.0f };
+    stats = SummarizePerf(one);
+    CHECK(stats.samples == 1 && stats.p50 == 7.0 && stats.p99 == 7.0 && stats.max == 7.0);
+
+    std::vector<float> none;
+    stats = SummarizePerf(none);
+    CHECK(stats.samples == 0 && stats.max == 0.0);
+}
+
+/**
+ * @brief The ring keeps the newest samples, Reset() starts a new window
+ *
+ * Once the ring has wrapped, the slot the writer fills next is left out, so
+ * a snapshot holds PERF_RING_SIZE - 1 samples.
+ */
+static void TestRingWindow() {
+    PerfRing ring;
+    std::vector<float> out;
+    ring.Snapshot(out);
+    CHECK(out.empty());
+
+    for (int i = 1; i <= 100; i++) {
+        ring.Record(static_cast<float>(i));
+    }
+    ring.Snapshot(out);
+    CHECK(out.size() == 100 && out.front() == 1.0f && out.back() == 100.0f);
+
+    for (int i = 101; i <= 3000; i++) {
+        ring.Record(static_cast<float>(i));
+    }
+    ring.Snapshot(out);
+    CHECK(out.size() == PERF_RING_SIZE - 1);
+    CHECK(out.front() == 3002.0f - PERF_RING_SIZE && out.back() == 3000.0f);
+    CHECK(ring.Recorded() == 3000);
+
+    ring.Reset();
+    ring.Snapshot(out);
+    CHECK(out.empty());
+    ring.Record(5.0f);
+    ring.Snapshot(out);
+    CHECK(out.size() == 1 && out[0] == 5.0f);
+    CHECK(ring.Recorded() == 3001);
+
+    for (size_t probe = 0; probe < PERF_PROBE_COUNT; probe++) {
+        CHECK(std::strlen(PerfProbeName(static_cast<PerfProbe>(probe))) > 0);
+    }
+}
+
+/**
+ * @brief Snapshots taken while the writer laps the ring are never torn
+ *
+ * The writer records 0, 1, 2... so any consistent snapshot is a run of
+ * consecutive values.
+ */
+static void TestConcurrentSnapshots() {
+    PerfRing ring;
+    std::atomic<bool> stop{ false };
+    std::thread writer([&]() {
+        float value = 0.0f;
+        while (!stop.load(std::memory_order_relaxed)) {
+            ring.Record(value);
+            value = (value >= 1e7f) ? 0.0f : value + 1.0f;
+        }
+    });
+
+    // Snapshot only once the writer has lapped the ring
+    while (ring.Recorded() < 4 * PERF_RING_SIZE) {
+        std::this_thread::yield();
+    }
+
+    std::vector<float> out;
+    int torn = 0;
+    int copied = 0;
+    for (int snapshot = 0; snapshot < 50000; snapshot++) {
+        ring.Snapshot(out);
+        copied += !out.empty();
+        for (size_t i = 1; i < out.size(); i++) {
+            if (out[i] != out[i - 1] + 1.0f && out[i] != 0.0f) {
+                torn++;
+                break;
+            }
+        }
+    }
+    stop = true;
+    writer.join();
+
+    CHECK(torn == 0);
+    CHECK(copied > 0);
+}
+
+/**
+ * @brief PerfTimer records one sample per scope
+ */
+static void TestTimer() {
+    PerfRing ring;
+    for (int i = 0; i < 10; i++) {
+        LADDERRANK_PERF_SCOPE(ring);
+    }
+    std::vector<float> out;
+    ring.Snapshot(out);
+    CHECK(out.size() == 10);
+    for (float sample : out) {
+        CHECK(sample >= 0.0f);
+    }
+}
+
+int main() {
+    RUN_TEST(TestSummarize);
+    RUN_TEST(TestRingWindow);
+    RUN_TEST(TestConcurrentSnapshots);
+    RUN_TEST(TestTimer);
+    return TestResult();
+}
@@ -0,0 +1,205 @@
+#include "RankSnapshotWorker.h"
+#include "TestCheck.h"
+#include "json.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Checks whether every playlist of a table matches a reference
+ */
+static bool MatchesAll(const RankTable& table, const RankTable& reference) {
+    for (int playlist : RankTable::rankedPlaylists) {
+        if (!table.Matches(reference, playlist)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// TABLE STORE
+// ============================================================================
+
+/**
+ * @brief Readers pinning tables while the store publishes 300 generations
+ *
+ * Alternates between the embedded defaults and a shifted copy, so a
+ * reader that saw a half built or freed table fails the match. Run it with
+ * LADDERRANK_SANITIZER=thread or address to catch use after free.
+ */
+static void TestStoreReadersVsPublishes() {
+    RankTable defaults;
+    defaults.LoadEmbeddedDefaults();
+
+    // Same thresholds as the defaults except one playlist shifted by 1 MMR
+    std::ifstream in(std::string(LADDERRANK_DATA_DIR) + "/RankNumbers/11.json");
+    nlohmann::json shifted = nlohmann::json::parse(in);
+    for (auto& division : shifted["data"]["data"]) {
+        division["minMMR"] = division["minMMR"].get<int>() + 1;
+        division["maxMMR"] = division["maxMMR"].get<int>() + 1;
+    }
+    auto shiftedFile = std::filesystem::temp_directory_path() / "LadderRankTests_11.json";
+    std::ofstream(shiftedFile) << shifted.dump();
+
+    RankTable other(defaults);
+    std::string error;
+    CHECK(other.LoadPlaylistFile(11, shiftedFile, error));
+    CHECK(!MatchesAll(other, defaults));
+    std::filesystem::remove(shiftedFile);
+
+    RankTableStore store;
+    store.Publish(std::make_unique<RankTable>(defaults));
+
+    constexpr int PUBLISHES = 300;
+    std::atomic<bool> done{ false };
+    std::atomic<int> started{ 0 };
+    std::atomic<uint64_t> reads{ 0 };
+    std::atomic<uint64_t> torn{ 0 };
+    std::atomic<uint64_t> backwards{ 0 };
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; r++) {
+        readers.emplace_back([&] {
+            started++;
+            uint64_t lastGeneration = 0;
+            while (!done.load()) {
+                auto table = store.Read();
+                if (table.Generation() < lastGeneration) {
+                    backwards++;
+                }
+                lastGeneration = table.Generation();
+                if (!MatchesAll(*table, defaults) && !MatchesAll(*table, other)) {
+                    torn++;
+                }
+                reads++;
+            }
+            });
+    }
+
+    // Publish only once every reader is pinning, or the readers may miss it all
+    while (started.load() < 4) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < PUBLISHES; i++) {
+        store.Publish(std::make_unique<RankTable>((i % 2) ? defaults : other));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(store.Generation() == PUBLISHES + 1);
+    CHECK(reads.load() > 0);
+    CHECK(torn.load() == 0);
+    CHECK(backwards.load() == 0);
+}
+
+// ============================================================================
+// SNAPSHOT WORKER
+// ============================================================================
+
+/**
+ * @brief Game thread submits, render threads read and a reloader republishes
+ *
+ * Every published set must be complete and versions must never go back.
+ * Afterwards a known sample has to show up built from the newest table.
+ */
+static void TestWorkerStress() {
+    RankTableStore store;
+    auto initial = std::make_unique<RankTable>();
+    initial->LoadEmbeddedDefaults();
+    store.Publish(std::move(initial));
+
+    RankSnapshotWorker worker;
+    std::atomic<int> published{ 0 };
+    worker.Start(store, [&](std::shared_ptr<const RankSnapshotSet>, int) { published++; });
+
+    std::atomic<bool> done{ false };
+    std::thread game([&] {
+        std::mt19937 rng(1);
+        for (int i = 0; i < 20000; i++) {
+            std::vector<MMRSample> samples;
+            for (int playlist : RankTable::rankedPlaylists) {
+                if (rng() % 3 == 0) {
+                    samples.push_back({ playlist, static_cast<float>(rng() % 2000), static_cast<int>(rng() % 25) - 1, static_cast<int>(rng() % 5) - 1 });
+                }
+            }
+            worker.Submit(samples);
+            if (i % 500 == 0) {
+                worker.Rebuild();
+            }
+        }
+        done = true;
+        });
+
+    std::atomic<uint64_t> bad{ 0 };
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; r++) {
+        readers.emplace_back([&] {
+            uint64_t lastVersion = 0;
+            while (!done.load()) {
+                auto set = worker.Current();
+                if (set->version < lastVersion) {
+                    bad++;
+                }
+                lastVersion = set->version;
+                for (const auto& snapshot : set->snapshots) {
+                    if (snapshot && (snapshot->tier < 0 || snapshot->tier >= RANK_TIER_COUNT || snapshot->nameCurrent.empty())) {
+                        bad++;
+                    }
+                }
+            }
+            });
+    }
+
+    std::thread reloader([&] {
+        while (!done.load()) {
+            auto table = std::make_unique<RankTable>();
+            table->LoadEmbeddedDefaults();
+            store.Publish(std::move(table));
+            worker.Rebuild();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        });
+
+    game.join();
+    reloader.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    worker.Submit({ { 11, 1000.0f, 15, 2 } });
+    std::shared_ptr<const RankSnapshot> snapshot;
+    for (int i = 0; i < 2000; i++) {
+        snapshot = worker.Current()->Find(11);
+        if (snapshot && snapshot->mmr == 1000.0f && snapshot->tableGeneration == store.Generation()) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    worker.Stop();
+
+    CHECK(bad.load() == 0);
+    CHECK(published.load() > 0);
+    CHECK(snapshot != nullptr);
+    CHECK(snapshot && snapshot->mmr == 1000.0f);
+    CHECK(snapshot && snapshot->tableGeneration == store.Generation());
+}
+
+int main() {
+    RUN_TEST(TestStoreReadersVsPublishes);
+    RUN_TEST(TestWorkerStress);
+    return TestResult();
+}
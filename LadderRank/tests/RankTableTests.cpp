@@ -0,0 +1,542 @@
+#include "RankTable.h"
+#include "TestCheck.h"
+#include "json.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static std::string RankNumbersFile(int playlist) {
+    return std::string(LADDERRANK_DATA_DIR) + "/RankNumbers/" + std::to_string(playlist) + ".json";
+}
+
+static json ReadRankNumbers(int playlist) {
+    std::ifstream file(RankNumbersFile(playlist));
+    return json::parse(file);
+}
+
+static std::filesystem::path TempPath(const std::string& name) {
+    return std::filesystem::temp_directory_path() / ("LadderRankTests_" + name);
+}
+
+static bool MatchesAll(const RankTable& table, const RankTable& reference) {
+    for (int playlist : RankTable::rankedPlaylists) {
+        if (!table.Matches(reference, playlist)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Loads a playlist from JSON text into a copy of the embedded defaults
+ *
+ * Every text that loads in these tests carries the shipped thresholds, so a
+ * successful load must leave the table equal to the defaults, and a failed
+ * one must leave it untouched.
+ * @param error Receives the load error
+ * @return True if the text loaded
+ */
+static bool LoadText(int playlist, const std::string& text, std::string& error) {
+    auto file = TempPath(std::to_string(playlist) + ".json");
+    std::ofstream(file, std::ios::binary) << text;
+
+    RankTable defaults;
+    defaults.LoadEmbeddedDefaults();
+    RankTable table(defaults);
+    error.clear();
+    bool loaded = table.LoadPlaylistFile(playlist, file, error);
+    std::filesystem::remove(file);
+
+    CHECK(loaded == error.empty());
+    CHECK(MatchesAll(table, defaults));
+    return loaded;
+}
+
+// ============================================================================
+// SOURCES
+// ============================================================================
+
+/**
+ * @brief Lookup() returns the minMMR and maxMMR of every entry of the
+ * RankNumbers files, what unranker() used to parse on every call
+ */
+static void TestLookupMatchesJson() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+
+    for (int playlist : RankTable::rankedPlaylists) {
+        json file = ReadRankNumbers(playlist);
+        for (const auto& entry : file["data"]["data"]) {
+            int tier = entry["tier"];
+            int div = entry["division"];
+            CHECK(table.Lookup(playlist, tier, div, false) == entry["minMMR"].get<int>());
+            CHECK(table.Lookup(playlist, tier, div, true) == entry["maxMMR"].get<int>());
+        }
+    }
+
+    // Unknown playlists, tiers and divisions read as 0
+    CHECK(table.Lookup(12, 1, 0, false) == 0);
+    CHECK(table.Lookup(10, RANK_TIER_COUNT, 0, true) == 0);
+    CHECK(table.Lookup(10, 1, -1, false) == 0);
+    CHECK(table.Lookup(10, 1, RANK_DIVISION_COUNT, false) == 0);
+}
+
+/**
+ * @brief The shipped JSON files, the committed RankNumbers.bin and the
+ * compiled-in defaults all hold the same thresholds
+ */
+static void TestJsonBinaryAndEmbeddedMatch() {
+    std::string folder = std::string(LADDERRANK_DATA_DIR) + "/RankNumbers";
+    std::string error;
+
+    RankTable fromJson;
+    CHECK(fromJson.LoadFolder(folder, error) == RANK_PLAYLIST_COUNT);
+    CHECK(error.empty());
+
+    RankTable fromBinary;
+    CHECK(fromBinary.LoadBinary(std::string(LADDERRANK_DATA_DIR) + "/RankNumbers.bin", folder, error));
+    CHECK(error.empty());
+
+    RankTable embedded;
+    embedded.LoadEmbeddedDefaults();
+
+    for (int playlist : RankTable::rankedPlaylists) {
+        CHECK(fromJson.HasPlaylist(playlist));
+        CHECK(fromBinary.Matches(fromJson, playlist));
+        CHECK(embedded.Matches(fromJson, playlist));
+
+        for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+            for (int div = 0; div < RankDivisionCount(tier); div++) {
+                CHECK(fromBinary.Lookup(playlist, tier, div, false) == fromJson.Lookup(playlist, tier, div, false));
+                CHECK(fromBinary.Lookup(playlist, tier, div, true) == fromJson.Lookup(playlist, tier, div, true));
+            }
+        }
+    }
+}
+
+// ============================================================================
+// STREAMING PARSER
+// ============================================================================
+
+/**
+ * @brief Keys the loader does not know, including nested "data" keys
+ * outside the entries, are skipped without changing the result
+ */
+static void TestParserSkipsUnknownValues() {
+    json file = ReadRankNumbers(34);
+    file["meta"] = { { "data", { 1, 2, { { "minMMR", 5 }, { "tier", 3 } } } }, { "version", 2.5 } };
+    file["data"]["extra"] = { { "data", json::array({ { { "tier", 1 } } }) } };
+    for (auto& entry : file["data"]["data"]) {
+        entry["name"] = "ignored";
+        entry["nested"] = { { "minMMR", -1 }, { "list", { true, nullptr, "x" } } };
+    }
+
+    std::string error;
+    CHECK(LoadText(34, file.dump(), error));
+    CHECK(error.empty());
+
+    // Order of the keys inside an entry does not matter either
+    CHECK(LoadText(34, ReadRankNumbers(34).dump(2), error));
+}
+
+/**
+ * @brief Broken files are rejected with a reason and change nothing
+ */
+static void TestParserRejectsBadFiles() {
+    std::string error;
+    std::string valid = ReadRankNumbers(11).dump();
+
+    CHECK(!LoadText(11, "", error));
+    CHECK(!LoadText(11, "{\"data\":", error));
+    CHECK(!LoadText(11, valid.substr(0, valid.size() / 2), error));
+    CHECK(!LoadText(11, valid + "}", error));
+    CHECK(!LoadText(11, "[1, 2, 3]", error));
+
+    json missingField = ReadRankNumbers(11);
+    missingField["data"]["data"][7].erase("maxMMR");
+    CHECK(!LoadText(11, missingField.dump(), error));
+    CHECK(error.find("lacks") != std::string::npos);
+
+    json textNumber = ReadRankNumbers(11);
+    textNumber["data"]["data"][7]["minMMR"] = "500";
+    CHECK(!LoadText(11, textNumber.dump(), error));
+
+    RankTable table;
+    CHECK(!table.LoadPlaylistFile(12, RankNumbersFile(11), error));
+    CHECK(error.find("not ranked") != std::string::npos);
+    CHECK(!table.LoadPlaylistFile(11, TempPath("missing.json"), error));
+    CHECK(error.find("cannot open") != std::string::npos);
+    CHECK(!table.HasPlaylist(11));
+}
+
+// ============================================================================
+// KEYED ENTRIES
+// ============================================================================
+
+/**
+ * @brief Entries are placed by their tier and division fields, so any order
+ * of the array loads the same table
+ */
+static void TestShuffledEntries() {
+    std::mt19937 rng(7);
+    std::string error;
+    for (int playlist : RankTable::rankedPlaylists) {
+        for (int round = 0; round < 4; round++) {
+            json file = ReadRankNumbers(playlist);
+            auto& entries = file["data"]["data"];
+            std::shuffle(entries.begin(), entries.end(), rng);
+            CHECK(LoadText(playlist, file.dump(), error));
+        }
+
+        json reversed = ReadRankNumbers(playlist);
+        auto& entries = reversed["data"]["data"];
+        std::reverse(entries.begin(), entries.end());
+        CHECK(LoadText(playlist, reversed.dump(), error));
+    }
+}
+
+/**
+ * @brief Missing, repeated and impossible divisions are reported by key
+ */
+static void TestSparseAndInvalidEntries() {
+    std::string error;
+
+    json sparse = ReadRankNumbers(34);
+    auto& entries = sparse["data"]["data"];
+    int tier = entries[5]["tier"];
+    int division = entries[5]["division"];
+    entries.erase(entries.begin() + 5);
+    CHECK(!LoadText(34, sparse.dump(), error));
+    CHECK(error.find("missing tier/division " + std::to_string(tier) + "/" + std::to_string(division)) != std::string::npos);
+
+    json empty = ReadRankNumbers(34);
+    empty["data"]["data"] = json::array();
+    CHECK(!LoadText(34, empty.dump(), error));
+    CHECK(error.find("missing") != std::string::npos);
+
+    json repeated = ReadRankNumbers(34);
+    repeated["data"]["data"].push_back(repeated["data"]["data"][3]);
+    CHECK(!LoadText(34, repeated.dump(), error));
+    CHECK(error.find("repeats") != std::string::npos);
+
+    // Supersonic Legend has a single division, tier 23 does not exist
+    for (auto [badTier, badDivision] : { std::pair{ RANK_TIER_COUNT - 1, 2 }, std::pair{ RANK_TIER_COUNT, 0 },
+        std::pair{ 5, RANK_DIVISION_COUNT }, std::pair{ -1, 0 } }) {
+        json invalid = ReadRankNumbers(34);
+        invalid["data"]["data"][0]["tier"] = badTier;
+        invalid["data"]["data"][0]["division"] = badDivision;
+        CHECK(!LoadText(34, invalid.dump(), error));
+        CHECK(error.find("has no slot") != std::string::npos);
+    }
+}
+
+// ============================================================================
+// PERCENTILE
+// ============================================================================
+
+/**
+ * @brief A RankNumbers file with a bell curve of players centred on a tier
+ */
+static json WithPopulation(int playlist, int centreTier) {
+    json file = ReadRankNumbers(playlist);
+    for (auto& entry : file["data"]["data"]) {
+        int tier = entry["tier"];
+        double distance = tier - centreTier;
+        entry["players"] = (tier == 0) ? 0 : static_cast<int>(100000 * std::exp(-distance * distance / 20.0));
+    }
+    return file;
+}
+
+/**
+ * @brief Share of players above an MMR by scanning every division, the
+ * same model as TopPercent() without the index
+ *
+ * Divisions are taken in minMMR order. Everyone in the divisions before
+ * the one the MMR falls into is below it, and players are spread evenly
+ * inside that division.
+ */
+static double TopPercentByScan(const json& file, float mmr) {
+    struct Division {
+        double minMMR;
+        double maxMMR;
+        double players;
+    };
+    std::vector<Division> divisions;
+    for (const auto& entry : file["data"]["data"]) {
+        if (entry["tier"].get<int>() != 0) {
+            divisions.push_back({ entry["minMMR"], entry["maxMMR"], entry["players"] });
+        }
+    }
+    std::stable_sort(divisions.begin(), divisions.end(),
+        [](const Division& a, const Division& b) { return a.minMMR < b.minMMR; });
+
+    double total = 0.0;
+    size_t inside = 0;
+    for (size_t i = 0; i < divisions.size(); i++) {
+        total += divisions[i].players;
+        if (divisions[i].minMMR <= mmr) {
+            inside = i;
+        }
+    }
+
+    double below = 0.0;
+    for (size_t i = 0; i < inside; i++) {
+        below += divisions[i].players;
+    }
+    const Division& division = divisions[inside];
+    double width = division.maxMMR - division.minMMR;
+    below += division.players * std::clamp((mmr - division.minMMR) / width, 0.0, 1.0);
+    return 100.0 * (total - below) / total;
+}
+
+/**
+ * @brief TopPercent() agrees with a full scan and never rises with MMR
+ */
+static void TestTopPercentMatchesScan() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+    CHECK(table.TopPercent(11, 1000.0f) == -1.0f);
+
+    json file = WithPopulation(11, 11);
+    auto path = TempPath("11.json");
+    std::ofstream(path) << file.dump();
+    std::string error;
+    CHECK(table.LoadPlaylistFile(11, path, error));
+    std::filesystem::remove(path);
+
+    float previous = 100.0f;
+    for (float mmr = -50.0f; mmr < 2500.0f; mmr += 0.5f) {
+        float top = table.TopPercent(11, mmr);
+        CHECK(std::abs(top - TopPercentByScan(file, mmr)) < 1e-3);
+        CHECK(top <= previous + 1e-4f);
+        previous = top;
+    }
+    CHECK(table.TopPercent(11, -1000.0f) == 100.0f);
+    CHECK(table.TopPercent(11, 10000.0f) == 0.0f);
+
+    // Playlists without player counts still have none
+    CHECK(table.TopPercent(13, 1000.0f) == -1.0f);
+}
+
+/**
+ * @brief Reloading one playlist rebuilds its index and leaves the others
+ */
+static void TestTopPercentFollowsReload() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+
+    std::string error;
+    auto path = TempPath("population.json");
+    std::ofstream(path) << WithPopulation(13, 11).dump();
+    CHECK(table.LoadPlaylistFile(13, path, error));
+    std::ofstream(path) << WithPopulation(11, 6).dump();
+    CHECK(table.LoadPlaylistFile(11, path, error));
+    float before = table.TopPercent(11, 1000.0f);
+    float other = table.TopPercent(13, 1000.0f);
+
+    // Players move up, so the same MMR is now a smaller share from the top
+    std::ofstream(path) << WithPopulation(11, 16).dump();
+    CHECK(table.LoadPlaylistFile(11, path, error));
+    std::filesystem::remove(path);
+
+    CHECK(table.TopPercent(11, 1000.0f) > before);
+    CHECK(table.TopPercent(13, 1000.0f) == other);
+}
+
+// ============================================================================
+// BINARY FORMAT
+// ============================================================================
+
+/**
+ * @brief SaveBinary() then LoadBinary() gives back the JSON tables
+ */
+static void TestBinaryRoundTrip() {
+    std::string folder = std::string(LADDERRANK_DATA_DIR) + "/RankNumbers";
+    std::string error;
+
+    RankTable fromJson;
+    CHECK(fromJson.LoadFolder(folder, error) == RANK_PLAYLIST_COUNT);
+
+    auto file = TempPath("RankNumbers.bin");
+    CHECK(fromJson.SaveBinary(file, folder, error));
+
+    RankTable fromBinary;
+    CHECK(fromBinary.LoadBinary(file, folder, error));
+    CHECK(MatchesAll(fromBinary, fromJson));
+    std::filesystem::remove(file);
+}
+
+/**
+ * @brief Corrupt, truncated and stale binaries are rejected and leave the
+ * table as it was
+ */
+static void TestBinaryRejectsBadFiles() {
+    std::string folder = std::string(LADDERRANK_DATA_DIR) + "/RankNumbers";
+    auto shipped = std::string(LADDERRANK_DATA_DIR) + "/RankNumbers.bin";
+    auto file = TempPath("RankNumbers.bin");
+
+    RankTable defaults;
+    defaults.LoadEmbeddedDefaults();
+
+    auto expectRejected = [&](const std::filesystem::path& jsonFolder) {
+        RankTable table(defaults);
+        std::string error;
+        CHECK(!table.LoadBinary(file, jsonFolder, error));
+        CHECK(!error.empty());
+        CHECK(MatchesAll(table, defaults));
+        return error;
+    };
+
+    // One flipped byte in the thresholds
+    std::filesystem::copy_file(shipped, file, std::filesystem::copy_options::overwrite_existing);
+    {
+        std::fstream stream(file, std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekp(-16, std::ios::end);
+        char byte = 0;
+        stream.read(&byte, 1);
+        stream.seekp(-16, std::ios::end);
+        stream.put(static_cast<char>(byte ^ 0x40));
+    }
+    expectRejected(folder);
+
+    // Cut in the middle of the data
+    std::filesystem::copy_file(shipped, file, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) / 2);
+    expectRejected(folder);
+
+    // A JSON file edited after the binary was built
+    std::filesystem::copy_file(shipped, file, std::filesystem::copy_options::overwrite_existing);
+    auto editedFolder = TempPath("RankNumbers");
+    std::filesystem::remove_all(editedFolder);
+    std::filesystem::copy(folder, editedFolder);
+    std::ofstream(editedFolder / "11.json", std::ios::app) << "\n";
+    CHECK(expectRejected(editedFolder).find("stale") != std::string::npos);
+
+    std::filesystem::remove_all(editedFolder);
+    std::filesystem::remove(file);
+}
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+/**
+ * @brief Locate() agrees with a linear scan of the JSON at the start and
+ * middle of every division
+ */
+static void TestLocateMatchesJson() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+
+    for (int playlist : RankTable::rankedPlaylists) {
+        json file = ReadRankNumbers(playlist);
+        const json& divisions = file["data"]["data"];
+        for (const auto& entry : divisions) {
+            if (entry["tier"].get<int>() == 0) {
+                continue;
+            }
+            int minMMR = entry["minMMR"];
+            int maxMMR = entry["maxMMR"];
+            for (int mmr : { minMMR, minMMR + (maxMMR - minMMR) / 2 }) {
+                // Expected: the ranked division with the highest minMMR <= mmr
+                int expectedTier = 0;
+                int expectedDivision = 0;
+                int best = INT32_MIN;
+                for (const auto& other : divisions) {
+                    int otherMin = other["minMMR"];
+                    if (other["tier"].get<int>() != 0 && otherMin <= mmr && otherMin >= best) {
+                        best = otherMin;
+                        expectedTier = other["tier"];
+                        expectedDivision = other["division"];
+                    }
+                }
+
+                RankPosition position = table.Locate(playlist, static_cast<float>(mmr));
+                CHECK(position.tier == expectedTier);
+                CHECK(position.division == expectedDivision);
+            }
+        }
+    }
+}
+
+/**
+ * @brief LocateMany() returns the same positions as Locate()
+ */
+static void TestLocateManyMatchesLocate() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+
+    std::vector<float> mmr;
+    for (int i = -100; i < 2500; i += 7) {
+        mmr.push_back(static_cast<float>(i) + 0.5f);
+    }
+    std::vector<RankPosition> positions(mmr.size());
+    table.LocateMany(11, mmr.data(), positions.data(), mmr.size());
+
+    for (size_t i = 0; i < mmr.size(); i++) {
+        RankPosition single = table.Locate(11, mmr[i]);
+        CHECK(positions[i].tier == single.tier);
+        CHECK(positions[i].division == single.division);
+        CHECK(positions[i].minMMR == single.minMMR);
+    }
+}
+
+/**
+ * @brief NaN, infinities and values outside int32_t land on the lowest or
+ * highest division instead of converting out of range
+ */
+static void TestLocateOutOfRange() {
+    RankTable table;
+    table.LoadEmbeddedDefaults();
+
+    RankPosition lowest = table.Locate(11, -1.0e6f);
+    RankPosition highest = table.Locate(11, 1.0e6f);
+    CHECK(lowest.tier == 1 && lowest.division == 0);
+    CHECK(highest.tier == RANK_TIER_COUNT - 1);
+
+    for (float mmr : { std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity() }) {
+        RankPosition position = table.Locate(11, mmr);
+        CHECK(position.tier == lowest.tier && position.division == lowest.division);
+        CHECK(table.TopPercent(11, mmr) == -1.0f);
+    }
+
+    for (float mmr : { 3.0e9f, 1.0e30f, std::numeric_limits<float>::max() }) {
+        CHECK(table.Locate(11, mmr).tier == highest.tier);
+    }
+    for (float mmr : { -3.0e9f, -1.0e30f, std::numeric_limits<float>::lowest() }) {
+        CHECK(table.Locate(11, mmr).tier == lowest.tier);
+    }
+
+    // Playlists that are not ranked give an all zero position
+    CHECK(table.Locate(12, 1000.0f).tier == 0);
+}
+
+int main() {
+    RUN_TEST(TestLookupMatchesJson);
+    RUN_TEST(TestJsonBinaryAndEmbeddedMatch);
+    RUN_TEST(TestParserSkipsUnknownValues);
+    RUN_TEST(TestParserRejectsBadFiles);
+    RUN_TEST(TestShuffledEntries);
+    RUN_TEST(TestSparseAndInvalidEntries);
+    RUN_TEST(TestTopPercentMatchesScan);
+    RUN_TEST(TestTopPercentFollowsReload);
+    RUN_TEST(TestBinaryRoundTrip);
+    RUN_TEST(TestBinaryRejectsBadFiles);
+    RUN_TEST(TestLocateMatchesJson);
+    RUN_TEST(TestLocateManyMatchesLocate);
+    RUN_TEST(TestLocateOutOfRange);
+    return TestResult();
+}
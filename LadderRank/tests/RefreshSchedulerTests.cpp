@@ -0,0 +1,208 @@
+#include "RefreshScheduler.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+
+// ============================================================================
+// FAKE TIMER
+// ============================================================================
+
+/**
+ * @brief Deterministic stand-in for gameWrapper->SetTimeout
+ *
+ * Callbacks fire in deadline order when time is advanced, a callback armed
+ * while firing runs in the same Advance() if its deadline has passed.
+ */
+class FakeTimer {
+public:
+    RefreshScheduler::Timer Bind() {
+        return [this](float delaySeconds, std::function<void()> callback) {
+            pending.push_back({ now + delaySeconds, std::move(callback) });
+        };
+    }
+
+    void Advance(float seconds) {
+        float end = now + seconds;
+        for (;;) {
+            size_t next = pending.size();
+            for (size_t i = 0; i < pending.size(); i++) {
+                if (pending[i].deadline <= end && (next == pending.size() || pending[i].deadline < pending[next].deadline)) {
+                    next = i;
+                }
+            }
+            if (next == pending.size()) {
+                break;
+            }
+            Timeout timeout = std::move(pending[next]);
+            pending.erase(pending.begin() + next);
+            now = std::max(now, timeout.deadline);
+            timeout.callback();
+        }
+        now = end;
+    }
+
+    size_t Pending() const { return pending.size(); }
+
+private:
+    struct Timeout {
+        float deadline;
+        std::function<void()> callback;
+    };
+
+    float now = 0.0f;
+    std::vector<Timeout> pending;
+};
+
+/**
+ * @brief Fetch double that counts calls and fails a key a set number of times
+ */
+struct FakeFetch {
+    std::map<int, int> calls;
+    std::map<int, int> failures;
+
+    RefreshScheduler::Fetch Bind() {
+        return [this](int key) {
+            calls[key]++;
+            return calls[key] > failures[key];
+        };
+    }
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief N rapid triggers of one key lead to exactly one fetch
+ */
+static void TestRapidTriggersCoalesce() {
+    FakeTimer timer;
+    FakeFetch fetch;
+    RefreshScheduler scheduler(timer.Bind(), fetch.Bind(), 2);
+
+    for (int i = 0; i < 100; i++) {
+        scheduler.Request(11, 0.1f);
+    }
+    CHECK(timer.Pending() == 1);
+    timer.Advance(1.0f);
+
+    CHECK(fetch.calls[11] == 1);
+    CHECK(scheduler.Requests() == 100);
+    CHECK(scheduler.Coalesced() == 99);
+    CHECK(scheduler.Fetches() == 1);
+    CHECK(scheduler.InFlight() == 0);
+
+    // Once done, the next trigger fetches again
+    scheduler.Request(11, 0.1f);
+    timer.Advance(1.0f);
+    CHECK(fetch.calls[11] == 2);
+}
+
+/**
+ * @brief Failed fetches retry until one succeeds or the attempts run out
+ */
+static void TestRetries() {
+    FakeTimer timer;
+    FakeFetch fetch;
+    RefreshScheduler scheduler(timer.Bind(), fetch.Bind(), 2);
+
+    fetch.failures[13] = 3;
+    scheduler.Request(13, 3.0f, 5, 0.5f);
+    timer.Advance(2.9f);
+    CHECK(fetch.calls[13] == 0);
+    timer.Advance(10.0f);
+    CHECK(fetch.calls[13] == 4);
+
+    fetch.failures[27] = 100;
+    scheduler.Request(27, 0.0f, 5, 0.5f);
+    timer.Advance(10.0f);
+    CHECK(fetch.calls[27] == 5);
+
+    // A merged request keeps the deadline and raises the attempts
+    fetch.failures[10] = 100;
+    scheduler.Request(10, 1.0f, 2, 0.5f);
+    scheduler.Request(10, 5.0f, 4, 0.5f);
+    timer.Advance(10.0f);
+    CHECK(fetch.calls[10] == 4);
+    CHECK(scheduler.InFlight() == 0);
+}
+
+/**
+ * @brief A cancelled refresh never fetches, its timer fires into nothing
+ */
+static void TestCancel() {
+    FakeTimer timer;
+    FakeFetch fetch;
+    RefreshScheduler scheduler(timer.Bind(), fetch.Bind(), 2);
+
+    scheduler.Request(28, 1.0f);
+    scheduler.Cancel(28);
+    timer.Advance(2.0f);
+    CHECK(fetch.calls[28] == 0);
+    CHECK(scheduler.Dropped() == 1);
+
+    // Cancelled then requested again: only the new generation fetches
+    scheduler.Request(29, 1.0f);
+    scheduler.Cancel(29);
+    scheduler.Request(29, 1.5f);
+    timer.Advance(3.0f);
+    CHECK(fetch.calls[29] == 1);
+
+    scheduler.Request(1, 1.0f);
+    scheduler.Request(2, 1.0f);
+    scheduler.CancelAll();
+    timer.Advance(2.0f);
+    CHECK(fetch.calls[1] == 0 && fetch.calls[2] == 0);
+    CHECK(scheduler.InFlight() == 0);
+}
+
+/**
+ * @brief Keys beyond maxInFlight wait and run as slots free up
+ */
+static void TestMaxInFlight() {
+    FakeTimer timer;
+    FakeFetch fetch;
+    RefreshScheduler scheduler(timer.Bind(), fetch.Bind(), 2);
+
+    for (int key : { 1, 2, 3, 4, 5 }) {
+        scheduler.Request(key, 1.0f);
+    }
+    CHECK(scheduler.InFlight() == 2);
+    CHECK(timer.Pending() == 2);
+
+    timer.Advance(1.0f);
+    CHECK(fetch.calls[1] == 1 && fetch.calls[2] == 1);
+    CHECK(fetch.calls[3] == 0);
+
+    timer.Advance(5.0f);
+    for (int key : { 1, 2, 3, 4, 5 }) {
+        CHECK(fetch.calls[key] == 1);
+    }
+    CHECK(scheduler.InFlight() == 0);
+}
+
+/**
+ * @brief Timers that fire after the scheduler is gone do nothing
+ */
+static void TestDestroyedScheduler() {
+    FakeTimer timer;
+    FakeFetch fetch;
+    {
+        RefreshScheduler scheduler(timer.Bind(), fetch.Bind(), 2);
+        scheduler.Request(30, 1.0f);
+    }
+    timer.Advance(5.0f);
+    CHECK(fetch.calls[30] == 0);
+}
+
+int main() {
+    RUN_TEST(TestRapidTriggersCoalesce);
+    RUN_TEST(TestRetries);
+    RUN_TEST(TestCancel);
+    RUN_TEST(TestMaxInFlight);
+    RUN_TEST(TestDestroyedScheduler);
+    return TestResult();
+}
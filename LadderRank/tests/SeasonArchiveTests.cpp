@@ -0,0 +1,296 @@
+#include "SeasonArchive.h"
+#include "TestCheck.h"
+#include "json.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static std::filesystem::path TempPath(const std::string& name) {
+    return std::filesystem::temp_directory_path() / ("LadderRankTests_" + name);
+}
+
+/**
+ * @brief Writes the shipped thresholds of some playlists as one season
+ * folder, every minMMR and maxMMR moved by a per-playlist shift
+ * @param folder Season folder, created with a RankNumbers/ subfolder
+ * @param shifts Playlist and MMR shift of every file to write
+ */
+static void WriteSeason(const std::filesystem::path& folder, const std::vector<std::pair<int, int>>& shifts) {
+    std::filesystem::create_directories(folder / "RankNumbers");
+    for (auto [playlist, shift] : shifts) {
+        std::ifstream shipped(std::string(LADDERRANK_DATA_DIR) + "/RankNumbers/" + std::to_string(playlist) + ".json");
+        json file = json::parse(shipped);
+        for (json& entry : file["data"]["data"]) {
+            entry["minMMR"] = entry["minMMR"].get<int>() + shift;
+            entry["maxMMR"] = entry["maxMMR"].get<int>() + shift;
+        }
+        std::ofstream(folder / "RankNumbers" / (std::to_string(playlist) + ".json")) << file.dump();
+    }
+}
+
+/**
+ * @brief Imports three seasons, the base one without Tournaments (34):
+ *
+ *   season14  every playlist but 34, as shipped
+ *   15        every playlist moved by +7, 34 included
+ *   16        Duel (10) moved by +100000, every other playlist by -20
+ *
+ * @param root Folder that receives the season folders
+ * @param seasons Receives the imported seasons, oldest first
+ */
+static void ImportTestSeasons(const std::filesystem::path& root, std::vector<SeasonTables>& seasons) {
+    std::filesystem::remove_all(root);
+
+    std::vector<std::pair<int, int>> base, shifted, wide;
+    for (int playlist : RankTable::rankedPlaylists) {
+        if (playlist != 34) {
+            base.push_back({ playlist, 0 });
+        }
+        shifted.push_back({ playlist, 7 });
+        wide.push_back({ playlist, playlist == 10 ? 100000 : -20 });
+    }
+    WriteSeason(root / "season14", base);
+    WriteSeason(root / "15", shifted);
+    WriteSeason(root / "16", wide);
+
+    std::string error;
+    CHECK(ImportSeasonFolders(root, seasons, error) == 3);
+    CHECK(error.empty());
+}
+
+/**
+ * @brief Reads the column directory of an archive file the way Open() finds it
+ */
+static std::vector<SeasonArchiveColumn> ReadColumns(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    SeasonArchiveHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    size_t presentBytes = (header.seasonCount * header.playlistCount + 3) & ~static_cast<size_t>(3);
+    file.seekg(static_cast<std::streamoff>(sizeof(header) + (header.seasonCount + header.playlistCount) * sizeof(int32_t) + presentBytes));
+    std::vector<SeasonArchiveColumn> columns(header.playlistCount * 2);
+    file.read(reinterpret_cast<char*>(columns.data()), static_cast<std::streamsize>(columns.size() * sizeof(SeasonArchiveColumn)));
+    return columns;
+}
+
+static int PlaylistIndex(int playlist) {
+    for (int p = 0; p < RANK_PLAYLIST_COUNT; p++) {
+        if (RankTable::rankedPlaylists[p] == playlist) {
+            return p;
+        }
+    }
+    return -1;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief Every value written reads back from the reopened archive, as the
+ * RankPack --seasons self-check does
+ */
+static void TestRoundTrip() {
+    auto root = TempPath("Seasons");
+    auto path = TempPath("Seasons.bin");
+    std::vector<SeasonTables> seasons;
+    ImportTestSeasons(root, seasons);
+
+    std::string error;
+    CHECK(WriteSeasonArchive(seasons, path, error));
+
+    SeasonArchive archive;
+    CHECK(archive.Open(path, error));
+    CHECK(archive.SeasonCount() == 3);
+    CHECK(archive.SeasonNumber(0) == 14);
+    CHECK(archive.SeasonNumber(2) == 16);
+    CHECK(archive.FindSeason(15) == 1);
+    CHECK(archive.FindSeason(13) == -1);
+
+    int mismatches = 0;
+    for (int s = 0; s < archive.SeasonCount(); s++) {
+        for (int playlist : RankTable::rankedPlaylists) {
+            CHECK(archive.HasPlaylist(s, playlist) == seasons[s].table.HasPlaylist(playlist));
+            for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+                for (int div = 0; div < RANK_DIVISION_COUNT; div++) {
+                    for (bool upper : { false, true }) {
+                        if (archive.Lookup(s, playlist, tier, div, upper) != seasons[s].table.Lookup(playlist, tier, div, upper)) {
+                            mismatches++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+
+    // Every ranked division of Doubles moved by 7 between 14 and 15
+    std::vector<SeasonThresholdChange> changes = archive.Diff(0, 1, 11);
+    CHECK(!changes.empty());
+    for (const SeasonThresholdChange& change : changes) {
+        CHECK(change.playlist == 11);
+        CHECK(change.to.minMMR == change.from.minMMR + 7);
+        CHECK(change.to.maxMMR == change.from.maxMMR + 7);
+    }
+    CHECK(archive.Diff(1, 1).empty());
+
+    std::filesystem::remove_all(root);
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief Columns whose deltas fit int16 are stored narrow, a column with one
+ * larger delta is stored as int32 and still reads back exactly
+ */
+static void TestDeltaWidths() {
+    auto root = TempPath("Seasons");
+    auto path = TempPath("Seasons.bin");
+    std::vector<SeasonTables> seasons;
+    ImportTestSeasons(root, seasons);
+
+    std::string error;
+    CHECK(WriteSeasonArchive(seasons, path, error));
+    std::vector<SeasonArchiveColumn> columns = ReadColumns(path);
+    CHECK(columns.size() == RANK_PLAYLIST_COUNT * 2);
+
+    for (int playlist : RankTable::rankedPlaylists) {
+        int p = PlaylistIndex(playlist);
+        uint32_t expected = (playlist == 10) ? 4 : 2;
+        CHECK(columns[p * 2].deltaBytes == expected);
+        CHECK(columns[p * 2 + 1].deltaBytes == expected);
+    }
+
+    SeasonArchive archive;
+    CHECK(archive.Open(path, error));
+    for (int tier = 1; tier < RANK_TIER_COUNT; tier++) {
+        for (bool upper : { false, true }) {
+            CHECK(archive.Lookup(2, 10, tier, 0, upper) == archive.Lookup(0, 10, tier, 0, upper) + 100000);
+            CHECK(archive.Lookup(2, 11, tier, 0, upper) == archive.Lookup(0, 11, tier, 0, upper) - 20);
+        }
+    }
+
+    std::filesystem::remove_all(root);
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief A playlist the base season lacks is based on the first season that
+ * holds it, and reads as absent before that
+ */
+static void TestPlaylistMissingFromBase() {
+    auto root = TempPath("Seasons");
+    auto path = TempPath("Seasons.bin");
+    std::vector<SeasonTables> seasons;
+    ImportTestSeasons(root, seasons);
+    CHECK(!seasons[0].table.HasPlaylist(34));
+
+    std::string error;
+    CHECK(WriteSeasonArchive(seasons, path, error));
+    SeasonArchive archive;
+    CHECK(archive.Open(path, error));
+
+    CHECK(!archive.HasPlaylist(0, 34));
+    CHECK(archive.HasPlaylist(1, 34));
+    CHECK(archive.HasPlaylist(2, 34));
+    for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+        for (int div = 0; div < RANK_DIVISION_COUNT; div++) {
+            for (bool upper : { false, true }) {
+                CHECK(archive.Lookup(0, 34, tier, div, upper) == 0);
+                CHECK(archive.Lookup(1, 34, tier, div, upper) == seasons[1].table.Lookup(34, tier, div, upper));
+                CHECK(archive.Lookup(2, 34, tier, div, upper) == seasons[2].table.Lookup(34, tier, div, upper));
+            }
+        }
+    }
+
+    // No diff against a season without the playlist
+    CHECK(archive.Diff(0, 1, 34).empty());
+    CHECK(!archive.Diff(1, 2, 34).empty());
+
+    std::filesystem::remove_all(root);
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief Corrupt files are rejected, and lookups on a closed archive or out
+ * of range indices return nothing instead of reading past the mapping
+ */
+static void TestRejectsBadFiles() {
+    auto root = TempPath("Seasons");
+    auto good = TempPath("Seasons.bin");
+    auto bad = TempPath("SeasonsBad.bin");
+    std::vector<SeasonTables> seasons;
+    ImportTestSeasons(root, seasons);
+
+    std::string error;
+    CHECK(WriteSeasonArchive(seasons, good, error));
+
+    auto expectRejected = [&](const std::string& reason) {
+        SeasonArchive archive;
+        std::string openError;
+        CHECK(!archive.Open(bad, openError));
+        CHECK(openError == reason);
+        CHECK(!archive.IsOpen());
+        CHECK(archive.SeasonCount() == 0);
+        CHECK(archive.SeasonNumber(0) == -1);
+        CHECK(!archive.HasPlaylist(0, 11));
+        CHECK(archive.Lookup(0, 11, 5, 0, false) == 0);
+    };
+
+    // One flipped byte in the last delta column
+    std::filesystem::copy_file(good, bad, std::filesystem::copy_options::overwrite_existing);
+    {
+        std::fstream stream(bad, std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekp(-8, std::ios::end);
+        char byte = 0;
+        stream.read(&byte, 1);
+        stream.seekp(-8, std::ios::end);
+        stream.put(static_cast<char>(byte ^ 0x40));
+    }
+    expectRejected("checksum mismatch");
+
+    // Column offsets past the end and misaligned, checked before the checksum
+    std::vector<SeasonArchiveColumn> columns = ReadColumns(good);
+    size_t directoryOffset = sizeof(SeasonArchiveHeader) + (3 + RANK_PLAYLIST_COUNT) * sizeof(int32_t) + ((3 * RANK_PLAYLIST_COUNT + 3) & ~3);
+    for (uint32_t offset : { static_cast<uint32_t>(std::filesystem::file_size(good)), columns[1].offset + 2 }) {
+        std::filesystem::copy_file(good, bad, std::filesystem::copy_options::overwrite_existing);
+        {
+            std::fstream stream(bad, std::ios::in | std::ios::out | std::ios::binary);
+            stream.seekp(static_cast<std::streamoff>(directoryOffset + sizeof(SeasonArchiveColumn)));
+            stream.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+        expectRejected("bad column 1");
+    }
+
+    // Cut inside the directory
+    std::filesystem::copy_file(good, bad, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::resize_file(bad, directoryOffset + 4);
+    expectRejected("truncated directory");
+
+    // The good file still opens, and out of range indices are rejected
+    SeasonArchive archive;
+    CHECK(archive.Open(good, error));
+    CHECK(archive.SeasonNumber(-1) == -1);
+    CHECK(archive.SeasonNumber(3) == -1);
+    CHECK(!archive.HasPlaylist(3, 11));
+    CHECK(archive.Lookup(-1, 11, 5, 0, false) == 0);
+
+    std::filesystem::remove_all(root);
+    std::filesystem::remove(good);
+    std::filesystem::remove(bad);
+}
+
+int main() {
+    RUN_TEST(TestRoundTrip);
+    RUN_TEST(TestDeltaWidths);
+    RUN_TEST(TestPlaylistMissingFromBase);
+    RUN_TEST(TestRejectsBadFiles);
+    return TestResult();
+}
@@ -0,0 +1,145 @@
+#include "SessionStats.h"
+#include "TestCheck.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief One match of a synthetic session: the outcome, then the MMR after it
+ */
+struct Match {
+    MatchOutcome outcome;
+    float mmr;
+};
+
+static void Play(SessionTracker& tracker, int playlist, const std::vector<Match>& matches) {
+    for (const Match& match : matches) {
+        tracker.RecordMatch(playlist, match.outcome);
+        tracker.RecordMMR(playlist, match.mmr);
+    }
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief Streaks grow with repeated results and flip sign on a change
+ */
+static void TestStreaks() {
+    SessionTracker tracker;
+    tracker.RecordMMR(11, 1000.0f);
+    CHECK(tracker.Read(11).streak == 0);
+
+    const MatchOutcome W = MatchOutcome::Win;
+    const MatchOutcome L = MatchOutcome::Loss;
+    const std::vector<std::pair<MatchOutcome, int>> expected = {
+        { W, 1 }, { W, 2 }, { W, 3 }, { L, -1 }, { L, -2 }, { W, 1 }, { L, -1 }, { W, 1 }, { W, 2 },
+    };
+    float mmr = 1000.0f;
+    for (const auto& [outcome, streak] : expected) {
+        mmr += (outcome == W) ? 9.0f : -8.0f;
+        Play(tracker, 11, { { outcome, mmr } });
+        CHECK(tracker.Read(11).streak == streak);
+    }
+
+    PlaylistSession session = tracker.Read(11);
+    CHECK(session.games == 9 && session.wins == 6 && session.losses == 3);
+    CHECK(session.startMMR == 1000.0f && session.currentMMR == mmr);
+    CHECK(session.MMRDelta() == 6 * 9.0f - 3 * 8.0f);
+}
+
+/**
+ * @brief Win rate over the matches with a known outcome
+ */
+static void TestWinRate() {
+    SessionTracker tracker;
+    CHECK(tracker.Read(13).WinRate() == 0.0f);
+
+    Play(tracker, 13, { { MatchOutcome::Win, 810 }, { MatchOutcome::Win, 820 }, { MatchOutcome::Loss, 811 },
+        { MatchOutcome::Win, 821 }, { MatchOutcome::Win, 830 }, { MatchOutcome::Loss, 822 }, { MatchOutcome::Win, 831 } });
+    PlaylistSession session = tracker.Read(13);
+    CHECK(session.games == 7 && session.wins == 5 && session.losses == 2);
+    CHECK(session.WinRate() == 5.0f / 7.0f);
+
+    // Other playlists keep their own sessions
+    CHECK(tracker.Read(11).games == 0 && !tracker.Read(11).hasMMR);
+    CHECK(tracker.Read(13).playlist == 13);
+}
+
+/**
+ * @brief Reset() starts every playlist again from its latest MMR
+ */
+static void TestReset() {
+    SessionTracker tracker;
+    Play(tracker, 11, { { MatchOutcome::Win, 1010 }, { MatchOutcome::Win, 1019 } });
+    tracker.RecordMMR(10, 700.0f);
+    tracker.Reset();
+
+    PlaylistSession session = tracker.Read(11);
+    CHECK(session.hasMMR);
+    CHECK(session.startMMR == 1019.0f && session.currentMMR == 1019.0f);
+    CHECK(session.games == 0 && session.wins == 0 && session.losses == 0 && session.streak == 0);
+    CHECK(session.MMRDelta() == 0.0f);
+    CHECK(tracker.Read(10).startMMR == 700.0f);
+    CHECK(!tracker.Read(13).hasMMR);
+
+    Play(tracker, 11, { { MatchOutcome::Loss, 1011 } });
+    CHECK(tracker.Read(11).MMRDelta() == -8.0f);
+    CHECK(tracker.Read(11).streak == -1);
+}
+
+/**
+ * @brief Unranked playlists and matches without an outcome are not counted
+ */
+static void TestIgnored() {
+    SessionTracker tracker;
+    for (int playlist : { 0, 1, 6, 12, 99, -1 }) {
+        Play(tracker, playlist, { { MatchOutcome::Win, 1000 } });
+        PlaylistSession session = tracker.Read(playlist);
+        CHECK(!session.hasMMR && session.games == 0 && session.playlist == 0);
+    }
+
+    tracker.RecordMMR(11, 1000.0f);
+    tracker.RecordMatch(11, MatchOutcome::None);
+    PlaylistSession session = tracker.Read(11);
+    CHECK(session.games == 0 && session.streak == 0);
+    CHECK(session.hasMMR && session.startMMR == 1000.0f);
+}
+
+/**
+ * @brief Overlay text for an empty session, a reading only and played matches
+ */
+static void TestFormatSession() {
+    SessionTracker tracker;
+    CHECK(FormatSession(tracker.Read(11)).empty());
+
+    tracker.RecordMMR(11, 1000.0f);
+    CHECK(FormatSession(tracker.Read(11)) == "Session +0");
+
+    Play(tracker, 11, { { MatchOutcome::Win, 1009 }, { MatchOutcome::Win, 1018 }, { MatchOutcome::Loss, 1010 },
+        { MatchOutcome::Win, 1019 }, { MatchOutcome::Win, 1028 }, { MatchOutcome::Win, 1037 }, { MatchOutcome::Win, 1046 } });
+    CHECK(FormatSession(tracker.Read(11)) == "Session +46  W4  6-1 (86%)");
+
+    Play(tracker, 11, { { MatchOutcome::Loss, 1037 }, { MatchOutcome::Loss, 1029 }, { MatchOutcome::Loss, 990.4f } });
+    CHECK(FormatSession(tracker.Read(11)) == "Session -10  L3  6-4 (60%)");
+
+    // Matches counted before any MMR reading
+    SessionTracker noMMR;
+    noMMR.RecordMatch(13, MatchOutcome::Loss);
+    CHECK(FormatSession(noMMR.Read(13)) == "Session +0  L1  0-1 (0%)");
+}
+
+int main() {
+    RUN_TEST(TestStreaks);
+    RUN_TEST(TestWinRate);
+    RUN_TEST(TestReset);
+    RUN_TEST(TestIgnored);
+    RUN_TEST(TestFormatSession);
+    return TestResult();
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdio>
+
+// ============================================================================
+// TEST HELPERS
+// ============================================================================
+
+/**
+ * @brief Number of failed checks in this test executable
+ */
+inline int& TestFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+/**
+ * @brief Records a failure with its location instead of aborting, so one run
+ * reports every broken case
+ */
+#define CHECK(expr)                                                                     \
+    do {                                                                                \
+        if (!(expr)) {                                                                  \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); \
+            TestFailures()++;                                                           \
+        }                                                                               \
+    } while (0)
+
+/**
+ * @brief Runs one test case and prints its name
+ */
+#define RUN_TEST(test)                          \
+    do {                                        \
+        std::printf("%s\n", #test);             \
+        test();                                 \
+    } while (0)
+
+/**
+ * @brief Exit code of the test executable
+ */
+inline int TestResult() {
+    if (TestFailures() != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", TestFailures());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+# Writes IconImageFixtures.h, the PNGs IconImageTests decodes:
+#   python3 make_png_fixtures.py > IconImageFixtures.h
+# zlib picks the deflate block type from the strategy: stored at level 0,
+# fixed Huffman with Z_FIXED, dynamic Huffman by default.
+
+import zlib, struct
+
+W = H = 16
+
+def chunk(kind, data):
+    return struct.pack('>I', len(data)) + kind + data + struct.pack('>I', zlib.crc32(kind + data))
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc: return a
+    return b if pb <= pc else c
+
+def filtered(rows, bpp):
+    out = b''
+    prev = bytes(len(rows[0]))
+    for y, row in enumerate(rows):
+        f = y % 5
+        line = bytearray([f])
+        for i, v in enumerate(row):
+            a = row[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            pred = [0, a, b, (a + b) // 2, paeth(a, b, c)][f]
+            line.append((v - pred) & 255)
+        out += bytes(line)
+        prev = row
+    return out
+
+def pixel(x, y):
+    return ((x * 16 + y) & 255, 255 - x * 8 - y * 4, (x * y * 3) & 255, 255 - y * 8)
+
+def rows(kind):
+    out = []
+    for y in range(H):
+        row = bytearray()
+        for x in range(W):
+            r, g, b, a = pixel(x, y)
+            if kind == 0: row += bytes([r])
+            elif kind == 2: row += bytes([r, g, b])
+            elif kind == 3: row += bytes([(x + y) % 16])
+            elif kind == 4: row += bytes([r, a])
+            else: row += bytes([r, g, b, a])
+        out.append(bytes(row))
+    return out
+
+BPP = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+def btype(z):
+    return (z[2] >> 1) & 3
+
+def png(kind, z, idats=1, extra=b''):
+    ihdr = struct.pack('>IIBBBBB', W, H, 8, kind, 0, 0, 0)
+    out = b'\x89PNG\r\n\x1a\n' + chunk(b'IHDR', ihdr) + extra
+    step = (len(z) + idats - 1) // idats
+    for i in range(0, len(z), step):
+        out += chunk(b'IDAT', z[i:i + step])
+    return out + chunk(b'IEND', b'')
+
+def compress(raw, level=9, strategy=zlib.Z_DEFAULT_STRATEGY):
+    c = zlib.compressobj(level, zlib.DEFLATED, 15, 9, strategy)
+    return c.compress(raw) + c.flush()
+
+palette = b''.join(bytes([i * 16, 255 - i * 16, i * 5]) for i in range(16))
+trns = bytes(255 - i * 10 for i in range(16))
+PAL = chunk(b'PLTE', palette) + chunk(b'tRNS', trns)
+
+fixtures = {}
+raw = filtered(rows(6), 4)
+z = compress(raw, 0); assert btype(z) == 0; fixtures['RGBA_STORED'] = png(6, z)
+z = compress(raw, 9, zlib.Z_FIXED); assert btype(z) == 1; fixtures['RGBA_FIXED'] = png(6, z)
+z = compress(raw, 9); assert btype(z) == 2, btype(z); fixtures['RGBA_DYNAMIC'] = png(6, z)
+fixtures['RGBA_SPLIT'] = png(6, z, idats=3)
+# Fixed block, the empty stored block of a sync flush, then a final stored block
+c = zlib.compressobj(9, zlib.DEFLATED, -15, 9, zlib.Z_FIXED)
+half = len(raw) // 2
+mixed = c.compress(raw[:half]) + c.flush(zlib.Z_SYNC_FLUSH)
+rest = raw[half:]
+mixed += bytes([1]) + struct.pack('<HH', len(rest), len(rest) ^ 0xFFFF) + rest
+fixtures['RGBA_MIXED'] = png(6, b'\x78\x01' + mixed + struct.pack('>I', zlib.adler32(raw)))
+for kind, name in ((0, 'GREY'), (4, 'GREY_ALPHA'), (2, 'RGB'), (3, 'PALETTE')):
+    z = compress(filtered(rows(kind), BPP[kind]), 9)
+    fixtures[name] = png(kind, z, extra=PAL if kind == 3 else b'')
+
+# Broken streams, every chunk checksum valid so only the inflater can catch them
+good = compress(raw, 9)
+fixtures['BAD_ADLER'] = png(6, good[:-1] + bytes([good[-1] ^ 1]))
+fixtures['BAD_BLOCK_TYPE'] = png(6, b'\x78\x01' + bytes([0b111]) + good[3:])
+stored = compress(raw, 0)
+fixtures['BAD_STORED_LENGTH'] = png(6, stored[:5] + bytes([stored[5] ^ 0xFF]) + stored[6:])
+fixtures['TRUNCATED_DEFLATE'] = png(6, good[:len(good) // 2])
+fixtures['BAD_ZLIB_HEADER'] = png(6, b'\x79' + good[1:])
+# Fixed block: BFINAL, BTYPE 01, length code 257, distance code 0 with no output yet, end of block
+bits = [1, 1, 0] + [0, 0, 0, 0, 0, 0, 1] + [0] * 5 + [0] * 7
+data = bytearray((len(bits) + 7) // 8)
+for i, bit in enumerate(bits):
+    data[i // 8] |= bit << (i % 8)
+fixtures['DISTANCE_TOO_FAR'] = png(6, b'\x78\x01' + bytes(data) + b'\x00\x00\x00\x01')
+badfilter = bytearray(raw); badfilter[0] = 5
+# Streams that inflate past the 16x16 image: 1 MB of zeros, and a 2 KB stored block
+fixtures['BOMB_DEFLATE'] = png(6, compress(bytes(1 << 20), 9))
+fixtures['BOMB_STORED'] = png(6, compress(bytes(2048), 0))
+fixtures['BAD_FILTER'] = png(6, compress(bytes(badfilter), 9))
+
+print('#pragma once')
+print()
+print('// Generated by make_png_fixtures.py, do not edit.')
+print('//')
+print('// 16x16 PNGs of the image TestPixel() describes, one filter type per row')
+print('// in turn, deflated by zlib. The BAD_, BOMB_ and truncated ones keep valid')
+print('// chunk checksums, so only the inflater or the unfilter can reject them.')
+print()
+print('#include <cstdint>')
+print()
+for name, data in fixtures.items():
+    print(f'static const uint8_t {name}[] = {{')
+    for i in range(0, len(data), 16):
+        print('    ' + ', '.join(f'0x{b:02x}' for b in data[i:i + 16]) + ',')
+    print('};')
+    if name != list(fixtures)[-1]:
+        print()
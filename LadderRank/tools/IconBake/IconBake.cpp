@@ -0,0 +1,125 @@
+// IconBake - bakes the RankIcons PNGs into IconBundle.bin: every icon
+// decoded, scaled down with an area filter into a few size buckets, and
+// each bucket packed into an atlas. The plugin loads the one bucket that
+// fits the configured icon size instead of decoding the PNGs.
+// The plugin build runs it through bake_icon_bundle.ps1, the bundle is
+// not committed.
+//
+// Usage:
+//   IconBake <RankIcons folder> <output file> [cell sizes...]   (default 64 128 256)
+//
+// Build (from this folder):
+//   g++ -std=c++20 -O2 -I../../LadderRank IconBake.cpp ../../LadderRank/IconBundle.cpp
+//       ../../LadderRank/IconAtlas.cpp ../../LadderRank/IconImage.cpp
+//       ../../LadderRank/MappedFile.cpp ../../LadderRank/RankBinary.cpp -o IconBake
+//   cl /std:c++20 /O2 /EHsc /I..\..\LadderRank IconBake.cpp ..\..\LadderRank\IconBundle.cpp
+//       ..\..\LadderRank\IconAtlas.cpp ..\..\LadderRank\IconImage.cpp
+//       ..\..\LadderRank\MappedFile.cpp ..\..\LadderRank\RankBinary.cpp
+
+#include "IconBundle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int ICON_COUNT = 23;      // RANK_TIER_COUNT of the plugin
+constexpr int ICON_PADDING = 2;     // ICON_ATLAS_PADDING of the plugin
+
+static double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: IconBake <RankIcons folder> <output file> [cell sizes...]\n";
+        return 2;
+    }
+
+    std::filesystem::path folder = argv[1];
+    std::filesystem::path output = argv[2];
+
+    std::vector<int> cellSizes;
+    for (int i = 3; i < argc; i++) {
+        int size = std::atoi(argv[i]);
+        if (size <= 0 || size > 1024) {
+            std::cerr << "invalid cell size " << argv[i] << "\n";
+            return 2;
+        }
+        cellSizes.push_back(size);
+    }
+    if (cellSizes.empty()) {
+        cellSizes = { 64, 128, 256 };
+    }
+
+    // Decode once at full size, every bucket is scaled from the originals
+    auto start = Clock::now();
+    std::vector<std::filesystem::path> sources;
+    std::vector<IconImage> icons(ICON_COUNT);
+    std::vector<uint32_t> sourceSizes;
+    uint64_t pngBytes = 0;
+    for (int tier = 0; tier < ICON_COUNT; tier++) {
+        auto path = folder / (std::to_string(tier) + ".png");
+        std::string error;
+        if (!LoadPNG(path, icons[tier], error)) {
+            std::cerr << path.string() << ": " << error << "\n";
+            return 1;
+        }
+        sources.push_back(path);
+        sourceSizes.push_back(static_cast<uint32_t>(std::filesystem::file_size(path)));
+        pngBytes += sourceSizes.back();
+    }
+    double decodeMilliseconds = MillisecondsSince(start);
+
+    std::vector<BakedBucket> buckets;
+    for (int cellSize : cellSizes) {
+        BakedBucket bucket;
+        bucket.cellSize = cellSize;
+        std::string error;
+        if (!BuildIconAtlas(icons, cellSize, ICON_PADDING, bucket.atlas, error)) {
+            std::cerr << "bucket " << cellSize << ": " << error << "\n";
+            return 1;
+        }
+        buckets.push_back(std::move(bucket));
+    }
+
+    std::string error;
+    if (!WriteIconBundle(buckets, sourceSizes, output, error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    // Read it back through the same path the plugin uses
+    IconBundle bundle;
+    if (!bundle.Open(output, error) || !bundle.MatchesSources(sources, error)) {
+        std::cerr << "written file does not validate: " << error << "\n";
+        return 1;
+    }
+
+    std::cout << "baked " << ICON_COUNT << " icons into " << output.string()
+        << " (" << std::filesystem::file_size(output) << " bytes)\n"
+        << "  sources: " << pngBytes << " bytes of PNG, decoded in " << decodeMilliseconds << " ms\n";
+
+    std::vector<int> baked = bundle.CellSizes();
+    for (size_t b = 0; b < baked.size(); b++) {
+        IconAtlas atlas;
+        auto readStart = Clock::now();
+        if (!bundle.ReadBucket(static_cast<int>(b), atlas, error)) {
+            std::cerr << "written file does not validate: " << error << "\n";
+            return 1;
+        }
+        double readMilliseconds = MillisecondsSince(readStart);
+
+        const BakedBucket& expected = *std::find_if(buckets.begin(), buckets.end(),
+            [&](const BakedBucket& bucket) { return bucket.cellSize == baked[b]; });
+        if (atlas.image.rgba != expected.atlas.image.rgba) {
+            std::cerr << "bucket " << baked[b] << " reads back different pixels\n";
+            return 1;
+        }
+
+        std::cout << "  bucket " << baked[b] << ": " << atlas.image.width << "x" << atlas.image.height
+            << ", " << atlas.image.Bytes() / 1048576.0 << " MB, read in " << readMilliseconds << " ms\n";
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+// IconBench - measures how fast AssetLoader decodes the rank icons, the work
+// the plugin keeps off the game thread, and how fast the uncompressed copies
+// it writes for single icons read back.
+//
+// Usage:
+//   IconBench <RankIcons folder> [workers] [rounds]
+//
+// Build (from this folder):
+//   g++ -std=c++20 -O2 -pthread -I../../LadderRank IconBench.cpp ../../LadderRank/AssetLoader.cpp
+//       ../../LadderRank/IconBundle.cpp ../../LadderRank/IconAtlas.cpp ../../LadderRank/IconImage.cpp
+//       ../../LadderRank/MappedFile.cpp ../../LadderRank/RankBinary.cpp -o IconBench
+//   cl /std:c++20 /O2 /EHsc /I..\..\LadderRank IconBench.cpp ..\..\LadderRank\AssetLoader.cpp
+//       ..\..\LadderRank\IconBundle.cpp ..\..\LadderRank\IconAtlas.cpp ..\..\LadderRank\IconImage.cpp
+//       ..\..\LadderRank\MappedFile.cpp ..\..\LadderRank\RankBinary.cpp
+
+#include "AssetLoader.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int ICON_COUNT = 23;
+constexpr int CELL_SIZE = 256;  // ICON_ATLAS_CELL of the plugin
+
+static double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Decodes every source `rounds` times, one request per file
+ * @return Milliseconds for all rounds, negative if a file failed
+ */
+static double DecodeAll(const std::vector<std::filesystem::path>& sources, int workers, int rounds, int maxSide,
+    uint64_t& decodedBytes) {
+    AssetLoader loader(16);
+    std::atomic<int> done{ 0 };
+    std::atomic<int> failed{ 0 };
+    loader.Start(workers, [&](AssetResult& result) {
+        failed += static_cast<int>(result.Failures());
+        done++;
+        });
+
+    auto start = Clock::now();
+    int total = rounds * static_cast<int>(sources.size());
+    for (int i = 0; i < total; i++) {
+        // Waits for room instead of dropping, the plugin would rather decode in place
+        AssetRequest request{ i, { sources[i % sources.size()] }, maxSide };
+        while (loader.Submit(request) == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    while (done < total) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    double milliseconds = MillisecondsSince(start);
+
+    decodedBytes = loader.DecodedBytes();
+    return failed == 0 ? milliseconds : -1.0;
+}
+
+static void Report(const char* label, int workers, int rounds, size_t files, uint64_t inputBytes,
+    uint64_t decodedBytes, double milliseconds) {
+    double seconds = milliseconds / 1000.0;
+    std::cout << "  " << label << ", " << workers << " worker(s): "
+        << milliseconds / rounds << " ms per set, "
+        << static_cast<int>(rounds * files / seconds) << " icons/s, "
+        << rounds * inputBytes / 1048576.0 / seconds << " MB/s of PNG, "
+        << decodedBytes / 1048576.0 / seconds << " MB/s of RGBA\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 4) {
+        std::cerr << "usage: IconBench <RankIcons folder> [workers] [rounds]\n";
+        return 2;
+    }
+
+    std::filesystem::path folder = argv[1];
+    int maxWorkers = (argc > 2) ? std::max(1, std::stoi(argv[2])) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int rounds = (argc > 3) ? std::max(1, std::stoi(argv[3])) : 5;
+
+    std::vector<std::filesystem::path> sources;
+    uint64_t sourceBytes = 0;
+    for (int tier = 0; tier < ICON_COUNT; tier++) {
+        auto path = folder / (std::to_string(tier) + ".png");
+        if (!std::filesystem::exists(path)) {
+            std::cerr << "missing " << path.string() << "\n";
+            return 1;
+        }
+        sources.push_back(path);
+        sourceBytes += std::filesystem::file_size(path);
+    }
+
+    // The copies the plugin writes for single icons: scaled to a cell, stored uncompressed
+    auto decodedFolder = std::filesystem::temp_directory_path() / "IconBench";
+    std::filesystem::create_directories(decodedFolder);
+    std::vector<std::filesystem::path> decoded;
+    uint64_t decodedFileBytes = 0;
+    for (const auto& source : sources) {
+        IconImage image;
+        std::string error;
+        if (!LoadPNG(source, image, error)) {
+            std::cerr << source.string() << ": " << error << "\n";
+            return 1;
+        }
+        int longest = std::max(image.width, image.height);
+        if (longest > CELL_SIZE) {
+            image = ResizeIcon(image, image.width * CELL_SIZE / longest, image.height * CELL_SIZE / longest);
+        }
+        auto path = decodedFolder / source.filename();
+        if (!SavePNG(path, image, error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+        decoded.push_back(path);
+        decodedFileBytes += std::filesystem::file_size(path);
+    }
+
+    std::cout << ICON_COUNT << " icons, " << sourceBytes << " bytes of PNG, " << rounds << " rounds\n";
+    for (int workers = 1; workers <= maxWorkers; workers *= 2) {
+        uint64_t bytes = 0;
+        double full = DecodeAll(sources, workers, rounds, 0, bytes);
+        if (full < 0) {
+            std::cerr << "an icon failed to decode\n";
+            return 1;
+        }
+        Report("full size", workers, rounds, sources.size(), sourceBytes, bytes, full);
+
+        double scaled = DecodeAll(sources, workers, rounds, CELL_SIZE, bytes);
+        Report("scaled to cell", workers, rounds, sources.size(), sourceBytes, bytes, scaled);
+
+        double stored = DecodeAll(decoded, workers, rounds, 0, bytes);
+        Report("stored copies", workers, rounds, decoded.size(), decodedFileBytes, bytes, stored);
+    }
+
+    std::filesystem::remove_all(decodedFolder);
+    return 0;
+}
@@ -0,0 +1,145 @@
+// RankPack - compiles the RankNumbers JSON files into the binary threshold
+// format read by RankTable::LoadBinary(), and warns when the JSON no longer
+// matches the defaults embedded in RankTablesEmbedded.h. With --seasons it
+// imports a folder of past seasons into a season archive instead.
+//
+// Usage:
+//   RankPack <RankNumbers folder> <output file>
+//   RankPack --seasons <seasons folder> <output file>
+//
+// Build (from this folder):
+//   g++ -std=c++20 -O2 -I../../LadderRank RankPack.cpp ../../LadderRank/RankTable.cpp
+//       ../../LadderRank/RankBinary.cpp ../../LadderRank/MappedFile.cpp
+//       ../../LadderRank/SeasonArchive.cpp -o RankPack
+//   cl /std:c++20 /O2 /EHsc /I..\..\LadderRank RankPack.cpp ..\..\LadderRank\RankTable.cpp
+//       ..\..\LadderRank\RankBinary.cpp ..\..\LadderRank\MappedFile.cpp
+//       ..\..\LadderRank\SeasonArchive.cpp
+
+#include "RankTable.h"
+#include "SeasonArchive.h"
+
+#include <chrono>
+#include <iostream>
+
+using Clock = std::chrono::steady_clock;
+
+static double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static int PackSeasons(const std::filesystem::path& seasonsFolder, const std::filesystem::path& output) {
+    std::string error;
+    std::vector<SeasonTables> seasons;
+
+    auto start = Clock::now();
+    int count = ImportSeasonFolders(seasonsFolder, seasons, error);
+    double jsonMilliseconds = MillisecondsSince(start);
+    if (!error.empty()) {
+        std::cerr << error;
+    }
+    if (count == 0) {
+        std::cerr << "no season folder found in " << seasonsFolder.string() << "\n";
+        return 1;
+    }
+
+    if (!WriteSeasonArchive(seasons, output, error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    // Read it back and compare every value with the JSON it came from
+    start = Clock::now();
+    SeasonArchive archive;
+    if (!archive.Open(output, error)) {
+        std::cerr << "written file does not validate: " << error << "\n";
+        return 1;
+    }
+    double archiveMilliseconds = MillisecondsSince(start);
+
+    size_t jsonBytes = 0;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(seasonsFolder)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".json") {
+            jsonBytes += static_cast<size_t>(entry.file_size());
+        }
+    }
+
+    int mismatches = 0;
+    for (int s = 0; s < count; s++) {
+        for (int playlist : RankTable::rankedPlaylists) {
+            if (!seasons[s].table.HasPlaylist(playlist)) {
+                continue;
+            }
+
+            for (int tier = 0; tier < RANK_TIER_COUNT; tier++) {
+                for (int div = 0; div < RANK_DIVISION_COUNT; div++) {
+                    for (bool upper : { false, true }) {
+                        if (archive.Lookup(s, playlist, tier, div, upper) != seasons[s].table.Lookup(playlist, tier, div, upper)) {
+                            mismatches++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (mismatches != 0) {
+        std::cerr << mismatches << " values differ from the JSON files\n";
+        return 1;
+    }
+
+    std::cout << "archived " << count << " seasons into " << output.string() << "\n"
+        << "  JSON:    " << jsonBytes << " bytes, imported in " << jsonMilliseconds << " ms\n"
+        << "  archive: " << std::filesystem::file_size(output) << " bytes, opened in " << archiveMilliseconds << " ms\n";
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 4 && std::string(argv[1]) == "--seasons") {
+        return PackSeasons(argv[2], argv[3]);
+    }
+
+    if (argc != 3) {
+        std::cerr << "usage: RankPack <RankNumbers folder> <output file>\n"
+            << "       RankPack --seasons <seasons folder> <output file>\n";
+        return 2;
+    }
+
+    std::filesystem::path jsonFolder = argv[1];
+    std::filesystem::path output = argv[2];
+
+    RankTable table;
+    std::string error;
+    int loaded = table.LoadFolder(jsonFolder, error);
+    if (loaded == 0) {
+        std::cerr << "no playlist could be loaded:\n" << error;
+        return 1;
+    }
+    if (!error.empty()) {
+        std::cerr << error;
+    }
+
+    if (!table.SaveBinary(output, jsonFolder, error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    // Read it back through the same path the plugin uses
+    RankTable check;
+    if (!check.LoadBinary(output, jsonFolder, error)) {
+        std::cerr << "written file does not validate: " << error << "\n";
+        return 1;
+    }
+
+    // The plugin starts from the tables compiled into it, they should agree
+    RankTable embedded;
+    embedded.LoadEmbeddedDefaults();
+    for (int playlist : RankTable::rankedPlaylists) {
+        if (table.HasPlaylist(playlist) && !table.Matches(embedded, playlist)) {
+            std::cerr << "warning: playlist " << playlist
+                << " differs from RankTablesEmbedded.h, rebuild the plugin to embed it\n";
+        }
+    }
+
+    std::cout << "packed " << loaded << " playlists into " << output.string()
+        << " (" << std::filesystem::file_size(output) << " bytes)\n";
+    return 0;
+}